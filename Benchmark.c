@@ -0,0 +1,777 @@
+/*
+ * @File: Benchmark.c
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Microbenchmark suite measuring throughput and latency percentiles of every container API
+ * @LastUpdate: October 18, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ *
+ * Build: cc -O2 Benchmark.c -o Benchmark
+ * Usage: ./Benchmark [--format csv|json] [--min-size N] [--max-size N] [--seed N] [--filter TEXT]
+ *                    [--op-cap N] [--work-budget N]
+ *
+ * Every benchmark fills a container with "size" elements (sizes are powers of 10 between --min-size and --max-size),
+ * then times each call of one public function. The random arguments are generated from --seed before the timing starts,
+ * so two builds given the same seed execute the exact same workload and their results can be compared line by line.
+ * Functions whose cost grows with the container size run fewer calls per round, bounded by --work-budget element visits.
+ * Results are written to stdout, progress is written to stderr.
+ */
+
+#define _DEFAULT_SOURCE // clock_gettime() and strcasecmp()
+
+#include "Instrumentation.c"
+#include "BinaryBuilder.c"
+#include "StringBuilder.c"
+#include "DynamicArray.c"
+#include "DynamicStringArray.c"
+#include "Dictionary.c"
+#include "SinglyLinkedList.c"
+#include "Hash.h"
+
+#include <time.h>
+
+#define BENCHMARK_DEFAULT_MINSIZE 10
+#define BENCHMARK_DEFAULT_MAXSIZE 10000000
+#define BENCHMARK_DEFAULT_SEED 42
+#define BENCHMARK_DEFAULT_OPCAP 100000          // max timed calls per round
+#define BENCHMARK_DEFAULT_WORKBUDGET 200000000  // max element visits per round of a size dependent function
+#define BENCHMARK_MINSAMPLES 1000               // small sizes are repeated in rounds until this many calls are timed
+#define BENCHMARK_DATASIZE 16                   // payload size of dictionary values
+
+typedef enum {
+    CONTAINER_DYNAMICARRAY,
+    CONTAINER_DICTIONARY,
+    CONTAINER_DYNAMICSTRINGARRAY,
+    CONTAINER_BINARYBUILDER,
+    CONTAINER_STRINGBUILDER,
+    CONTAINER_SINGLYLINKEDLIST
+} benchmarkcontainer_t;
+
+typedef enum {
+    COST_CONSTANT, // cost of a call doesn't depend on the container size
+    COST_LINEAR,   // cost of a call grows with the container size
+    COST_WHOLE     // a call processes the whole container, once per round
+} benchmarkcost_t;
+
+typedef struct {
+    size_t size;
+    dynamicarray_t dynamicArray;
+    dynamicarray_t dynamicArrayAux;
+    dictionary_t dictionary;
+    dictionary_t dictionaryAux;
+    dynamicstringarray_t stringArray;
+    binarybuilder_t binaryBuilder;
+    binarybuilder_t binaryBuilderAux;
+    binarydata_t binaryData;
+    binarydata_t binaryDataAux;
+    stringbuilder_t stringBuilder;
+    td_SinglyLinkedList_info list;
+    td_SinglyLinkedList_info listAux;
+} benchmarkfixture_t;
+
+typedef struct {
+    benchmarkcontainer_t container;
+    const char* operation;
+    benchmarkcost_t cost;
+    bool isShrinking; // each call removes an element, so a round can't have more calls than the size
+    void (*Run)(benchmarkfixture_t* const _fixture, const uint64_t _argument);
+} benchmark_t;
+
+typedef struct {
+    const char* format;
+    size_t minSize;
+    size_t maxSize;
+    uint64_t seed;
+    const char* filter;
+    size_t opCap;
+    size_t workBudget;
+} benchmarkoptions_t;
+
+static const char* const containerNames[] = {
+    "DynamicArray", "Dictionary", "DynamicStringArray", "BinaryBuilder", "StringBuilder", "SinglyLinkedList"
+};
+
+static volatile uint64_t benchmarkSink; // keeps results alive so the compiler can't discard the measured calls
+static uint64_t timerOverhead;          // nanoseconds spent by the timer itself
+
+static inline uint64_t GetNanoseconds(void) {
+    struct timespec _now;
+    clock_gettime(CLOCK_MONOTONIC, &_now);
+    return ((uint64_t)_now.tv_sec * 1000000000ULL) + (uint64_t)_now.tv_nsec;
+}
+
+// seed of a benchmark round, independent from the order and the selection of the benchmarks
+static uint64_t GetRoundSeed(const uint64_t _seed, const char* const _name, const size_t _size, const size_t _round) {
+    return _seed ^ Hash_FNV1a(_name, strlen(_name)) ^ ((uint64_t)_size * 0x9E3779B97F4A7C15ULL) ^ ((uint64_t)_round << 48);
+}
+
+static void CalibrateTimer(void) {
+    timerOverhead = UINT64_MAX;
+    for (size_t i = 0; i < 10000; i++) {
+        const uint64_t _start = GetNanoseconds();
+        const uint64_t _elapsed = GetNanoseconds() - _start;
+        if (_elapsed < timerOverhead) {
+            timerOverhead = _elapsed;
+        }
+    }
+}
+
+/* ---------------------------------------------------------------- fixtures */
+
+static void SetupFixture(benchmarkfixture_t* const _fixture, const benchmarkcontainer_t _container, const size_t _size, uint64_t* const _random) {
+    memset(_fixture, 0, sizeof(benchmarkfixture_t));
+    _fixture->size = _size;
+    switch (_container) {
+    case CONTAINER_DYNAMICARRAY:
+        DynamicArray_Init(&_fixture->dynamicArray, sizeof(uint64_t));
+        DynamicArray_Init(&_fixture->dynamicArrayAux, sizeof(uint64_t));
+        for (size_t i = 0; i < _size; i++) {
+            const uint64_t _value = Hash_SplitMix64(_random) | 1; // odd values, searched values are even
+            DynamicArray_Push(&_fixture->dynamicArray, &_value);
+        }
+    break; case CONTAINER_DICTIONARY: {
+        uint8_t _data[BENCHMARK_DATASIZE] = {0};
+        Dictionary_Init(&_fixture->dictionary);
+        Dictionary_Init(&_fixture->dictionaryAux);
+        for (uint64_t i = 0; i < _size; i++) { // ascending keys are appended without shifting
+            const uint64_t _key = (i * 2) + 1;
+            Dictionary_Set(&_fixture->dictionary, &_key, sizeof(_key), _data, sizeof(_data));
+        }
+    } break; case CONTAINER_DYNAMICSTRINGARRAY: {
+        char _string[32];
+        DynamicStringArray_Init(&_fixture->stringArray);
+        for (size_t i = 0; i < _size; i++) {
+            snprintf(_string, sizeof(_string), "item-%016llx", (unsigned long long)Hash_SplitMix64(_random));
+            DynamicStringArray_Push(&_fixture->stringArray, _string);
+        }
+    } break; case CONTAINER_BINARYBUILDER:
+        BinaryBuilder_Init(&_fixture->binaryBuilder);
+        BinaryBuilder_Init(&_fixture->binaryBuilderAux);
+        BinaryData_Init(&_fixture->binaryData);
+        BinaryData_Init(&_fixture->binaryDataAux);
+        BinaryBuilder_SetMinSize(&_fixture->binaryBuilder, _size + 1);
+        memset(_fixture->binaryBuilder.data, 0xAB, _size);
+        BinaryBuilder_SetUsedSize(&_fixture->binaryBuilder, _size);
+        BinaryBuilder_SetWriteOffset(&_fixture->binaryBuilder, _size);
+        BinaryData_SetMinSize(&_fixture->binaryData, _size);
+    break; case CONTAINER_STRINGBUILDER:
+        StringBuilder_Init(&_fixture->stringBuilder);
+        StringBuilder_SetMinSize(&_fixture->stringBuilder, _size + 1);
+        memset(_fixture->stringBuilder.string, 'x', _size);
+        _fixture->stringBuilder.string[_size] = '\0';
+        _fixture->stringBuilder.endPtr = _fixture->stringBuilder.string + _size;
+        _fixture->stringBuilder.writePtr = _fixture->stringBuilder.endPtr;
+    break; case CONTAINER_SINGLYLINKEDLIST:
+        SinglyLinkedList_Reset(&_fixture->list, sizeof(uint64_t));
+        SinglyLinkedList_Reset(&_fixture->listAux, sizeof(uint64_t));
+        for (size_t i = 0; i < _size; i++) {
+            const uint64_t _value = Hash_SplitMix64(_random) | 1;
+            SinglyLinkedList_AddNode(&_fixture->list, &_value);
+        }
+        DynamicArray_InitAll(&_fixture->dynamicArrayAux, sizeof(uint64_t), 64, 0.5);
+        for (uint64_t i = 0; i < 64; i++) {
+            DynamicArray_Push(&_fixture->dynamicArrayAux, &i);
+        }
+    break;
+    }
+}
+
+static void TeardownFixture(benchmarkfixture_t* const _fixture, const benchmarkcontainer_t _container) {
+    switch (_container) {
+    case CONTAINER_DYNAMICARRAY:
+        DynamicArray_FreeBuffer(&_fixture->dynamicArray);
+        DynamicArray_FreeBuffer(&_fixture->dynamicArrayAux);
+    break; case CONTAINER_DICTIONARY:
+        Dictionary_Free_Storage(&_fixture->dictionary);
+        Dictionary_Free_Storage(&_fixture->dictionaryAux);
+    break; case CONTAINER_DYNAMICSTRINGARRAY:
+        DynamicStringArray_FreeStorage(&_fixture->stringArray);
+    break; case CONTAINER_BINARYBUILDER:
+        BinaryBuilder_FreeBuffer(&_fixture->binaryBuilder);
+        BinaryBuilder_FreeBuffer(&_fixture->binaryBuilderAux);
+        BinaryData_FreeBuffer(&_fixture->binaryData);
+        BinaryData_FreeBuffer(&_fixture->binaryDataAux);
+    break; case CONTAINER_STRINGBUILDER:
+        StringBuilder_FreeBuffer(&_fixture->stringBuilder);
+    break; case CONTAINER_SINGLYLINKEDLIST:
+        SinglyLinkedList_DeleteAllNodes(&_fixture->list);
+        SinglyLinkedList_DeleteAllNodes(&_fixture->listAux);
+        DynamicArray_FreeBuffer(&_fixture->dynamicArrayAux);
+    break;
+    }
+}
+
+/* ---------------------------------------------------------------- DynamicArray */
+
+static void Run_DynamicArray_Push(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    benchmarkSink += DynamicArray_Push(&_fixture->dynamicArray, &_argument);
+}
+static void Run_DynamicArray_Pop(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    benchmarkSink += DynamicArray_Pop(&_fixture->dynamicArray);
+}
+static void Run_DynamicArray_Insert(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    benchmarkSink += DynamicArray_Insert(&_fixture->dynamicArray, _argument % (_fixture->dynamicArray.elementCount + 1), &_argument);
+}
+static void Run_DynamicArray_Delete(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    if (_fixture->dynamicArray.elementCount) {
+        benchmarkSink += DynamicArray_Delete(&_fixture->dynamicArray, _argument % _fixture->dynamicArray.elementCount);
+    }
+}
+static void Run_DynamicArray_HasValue(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    const uint64_t _value = _argument & ~1ULL; // absent, scans the whole array
+    benchmarkSink += DynamicArray_HasValue(&_fixture->dynamicArray, &_value);
+}
+static void Run_DynamicArray_GetElementNumberContainingValue(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    const uint64_t _value = _argument & ~1ULL;
+    benchmarkSink += DynamicArray_GetElementNumberContainingValue(&_fixture->dynamicArray, 1, &_value);
+}
+static void Run_DynamicArray_ReserveElements(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    benchmarkSink += DynamicArray_ReserveElements(&_fixture->dynamicArray, 1 + (_argument & 7));
+}
+static void Run_DynamicArray_SetMinElementsWithSize(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument; // grows by one element, forcing a reallocation on every call
+    benchmarkSink += DynamicArray_SetMinElementsWithSize(&_fixture->dynamicArray, _fixture->dynamicArray.maxElementCount + 1, sizeof(uint64_t));
+}
+static void Run_DynamicArray_InitAllFree(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    dynamicarray_t* const _object = DynamicArray_InitAll(NULL, sizeof(uint64_t), _fixture->size ? _fixture->size : 1, 0.5);
+    benchmarkSink += (uintptr_t)_object;
+    DynamicArray_Free(_object);
+}
+
+/* ---------------------------------------------------------------- Dictionary */
+
+static void Run_Dictionary_SetNewKey(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    const uint64_t _key = (_argument % (_fixture->size + 1)) * 2; // even keys are absent from the fixture
+    benchmarkSink += (uintptr_t)Dictionary_Set(&_fixture->dictionary, &_key, sizeof(_key), &_argument, sizeof(_argument));
+}
+static void Run_Dictionary_SetExistingKey(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    const uint64_t _key = ((_argument % _fixture->size) * 2) + 1;
+    benchmarkSink += (uintptr_t)Dictionary_Set(&_fixture->dictionary, &_key, sizeof(_key), &_argument, sizeof(_argument));
+}
+static void Run_Dictionary_Get(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    const uint64_t _key = ((_argument % _fixture->size) * 2) + 1;
+    size_t _dataSize;
+    benchmarkSink += (uintptr_t)Dictionary_Get(&_fixture->dictionary, &_key, sizeof(_key), &_dataSize);
+}
+static void Run_Dictionary_Get_Entry(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    const uint64_t _key = ((_argument % _fixture->size) * 2) + 1;
+    benchmarkSink += (uintptr_t)Dictionary_Get_Entry(&_fixture->dictionary, &_key, sizeof(_key));
+}
+static void Run_Dictionary_Has_KeyHit(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    const uint64_t _key = ((_argument % _fixture->size) * 2) + 1;
+    benchmarkSink += Dictionary_Has_Key(&_fixture->dictionary, &_key, sizeof(_key));
+}
+static void Run_Dictionary_Has_KeyMiss(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    const uint64_t _key = (_argument % (_fixture->size + 1)) * 2;
+    benchmarkSink += Dictionary_Has_Key(&_fixture->dictionary, &_key, sizeof(_key));
+}
+static void Run_Dictionary_Has_Data(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    uint8_t _data[BENCHMARK_DATASIZE];
+    memset(_data, (int)(_argument | 1) & 0xFF, sizeof(_data)); // absent, scans every entry
+    benchmarkSink += Dictionary_Has_Data(&_fixture->dictionary, _data, sizeof(_data));
+}
+static void Run_Dictionary_DeleteKey(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    const uint64_t _key = ((_argument % _fixture->size) * 2) + 1;
+    benchmarkSink += Dictionary_DeleteKey(&_fixture->dictionary, &_key, sizeof(_key));
+}
+static void Run_Dictionary_Free_Entry(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    const uint64_t _key = ((_argument % _fixture->size) * 2) + 1;
+    Dictionary_Free_Entry(&_fixture->dictionary, &_key, sizeof(_key));
+    benchmarkSink += _fixture->dictionary.elementCount;
+}
+static void Run_Dictionary_Merge(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    Dictionary_DeleteAllKeys(&_fixture->dictionaryAux);
+    benchmarkSink += Dictionary_Merge(&_fixture->dictionaryAux, &_fixture->dictionary, _argument & 1);
+}
+static void Run_Dictionary_Clone(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    benchmarkSink += (uintptr_t)Dictionary_Clone(&_fixture->dictionaryAux, &_fixture->dictionary);
+}
+static void Run_Dictionary_DeleteAllKeys(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    Dictionary_DeleteAllKeys(&_fixture->dictionary);
+    benchmarkSink += _fixture->dictionary.elementCount;
+}
+static void Run_Dictionary_Free_AllEntries(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    Dictionary_Free_AllEntries(&_fixture->dictionary);
+    benchmarkSink += _fixture->dictionary.elementCount;
+}
+static void Run_Dictionary_ReserveElements(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    benchmarkSink += Dictionary_ReserveElements(&_fixture->dictionary, 1 + (_argument & 7));
+}
+static void Run_Dictionary_InitFree(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_fixture;
+    (void)_argument;
+    dictionary_t* const _object = Dictionary_Init(NULL);
+    benchmarkSink += (uintptr_t)_object;
+    Dictionary_Free(_object);
+}
+
+/* ---------------------------------------------------------------- DynamicStringArray */
+
+static void Run_DynamicStringArray_PushSubString(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    benchmarkSink += DynamicStringArray_PushSubString(&_fixture->stringArray, "pushed-string-value", 8 + (_argument & 7));
+}
+static void Run_DynamicStringArray_Pop(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    benchmarkSink += DynamicStringArray_Pop(&_fixture->stringArray);
+}
+static void Run_DynamicStringArray_InsertSubString(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    if (_fixture->stringArray.elementCount) {
+        benchmarkSink += DynamicStringArray_InsertSubString(&_fixture->stringArray, _argument % _fixture->stringArray.elementCount, "inserted-string", 15);
+    }
+}
+static void Run_DynamicStringArray_Delete(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    if (_fixture->stringArray.elementCount) {
+        benchmarkSink += DynamicStringArray_Delete(&_fixture->stringArray, _argument % _fixture->stringArray.elementCount);
+    }
+}
+static void Run_DynamicStringArray_Search(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    benchmarkSink += DynamicStringArray_Search(&_fixture->stringArray, "absent-string", _argument & 1);
+}
+static void Run_DynamicStringArray_ReserveBufferSize(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    benchmarkSink += DynamicStringArray_ReserveBufferSize(&_fixture->stringArray, 1 + (_argument & 63));
+}
+static void Run_DynamicStringArray_ReserveElements(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    benchmarkSink += DynamicStringArray_ReserveElements(&_fixture->stringArray, 1 + (_argument & 7));
+}
+static void Run_DynamicStringArray_Clear(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    DynamicStringArray_Clear(&_fixture->stringArray);
+    benchmarkSink += _fixture->stringArray.elementCount;
+}
+static void Run_DynamicStringArray_InitFree(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_fixture;
+    (void)_argument;
+    dynamicstringarray_t* const _object = DynamicStringArray_Init(NULL);
+    benchmarkSink += (uintptr_t)_object;
+    DynamicStringArray_Free(_object);
+}
+
+/* ---------------------------------------------------------------- BinaryBuilder */
+
+static void Run_BinaryBuilder_SetByte(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    benchmarkSink += BinaryBuilder_SetByte(&_fixture->binaryBuilder, (uint8_t)_argument);
+}
+static void Run_BinaryBuilder_SetBytes(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    const uint64_t _bytes[2] = {_argument, ~_argument};
+    benchmarkSink += BinaryBuilder_SetBytes(&_fixture->binaryBuilder, _bytes, sizeof(_bytes));
+}
+static void Run_BinaryBuilder_InsertByte(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    BinaryBuilder_SetWriteOffset(&_fixture->binaryBuilder, _argument % (BinaryBuilder_GetCurrentSize(&_fixture->binaryBuilder) + 1));
+    benchmarkSink += BinaryBuilder_InsertByte(&_fixture->binaryBuilder, (uint8_t)_argument);
+}
+static void Run_BinaryBuilder_InsertBytes(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    const uint64_t _bytes[2] = {_argument, ~_argument};
+    BinaryBuilder_SetWriteOffset(&_fixture->binaryBuilder, _argument % (BinaryBuilder_GetCurrentSize(&_fixture->binaryBuilder) + 1));
+    benchmarkSink += BinaryBuilder_InsertBytes(&_fixture->binaryBuilder, _bytes, sizeof(_bytes));
+}
+static void Run_BinaryBuilder_Delete(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    BinaryBuilder_SetWriteOffset(&_fixture->binaryBuilder, _argument % (BinaryBuilder_GetCurrentSize(&_fixture->binaryBuilder) + 1));
+    benchmarkSink += BinaryBuilder_Delete(&_fixture->binaryBuilder, 1);
+}
+static void Run_BinaryBuilder_SetWriteOffset(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    benchmarkSink += BinaryBuilder_SetWriteOffset(&_fixture->binaryBuilder, _argument % (BinaryBuilder_GetCurrentSize(&_fixture->binaryBuilder) + 1));
+}
+static void Run_BinaryBuilder_SetUsedSize(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    benchmarkSink += BinaryBuilder_SetUsedSize(&_fixture->binaryBuilder, _argument % _fixture->binaryBuilder.capacity);
+}
+static void Run_BinaryBuilder_ReserveSize(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    benchmarkSink += BinaryBuilder_ReserveSize(&_fixture->binaryBuilder, 1 + (_argument & 63));
+}
+static void Run_BinaryBuilder_Clone(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    benchmarkSink += (uintptr_t)BinaryBuilder_Clone(&_fixture->binaryBuilderAux, &_fixture->binaryBuilder);
+}
+static void Run_BinaryBuilder_Clear(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    BinaryBuilder_Clear(&_fixture->binaryBuilder);
+    benchmarkSink += (uintptr_t)_fixture->binaryBuilder.endPtr;
+}
+static void Run_BinaryData_SetMinSize(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument; // grows by one byte, forcing a reallocation on every call
+    benchmarkSink += BinaryData_SetMinSize(&_fixture->binaryData, _fixture->binaryData.capacity + 1);
+}
+static void Run_BinaryData_Clone(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    benchmarkSink += (uintptr_t)BinaryData_Clone(&_fixture->binaryDataAux, &_fixture->binaryData);
+}
+
+/* ---------------------------------------------------------------- StringBuilder */
+
+static void Run_StringBuilder_InsertCharacter(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    benchmarkSink += StringBuilder_InsertCharacter(&_fixture->stringBuilder, (char)('a' + (_argument % 26)));
+}
+static void Run_StringBuilder_InsertString(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    benchmarkSink += StringBuilder_InsertString(&_fixture->stringBuilder, "appended string");
+}
+static void Run_StringBuilder_InsertFormattedString(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    benchmarkSink += StringBuilder_InsertFormattedString(&_fixture->stringBuilder, "key%u=%llu\n", (unsigned)(_argument & 0xFFFF), (unsigned long long)_argument);
+}
+static void Run_StringBuilder_InsertCharacters(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    StringBuilder_SetWriteOffset(&_fixture->stringBuilder, _argument % (StringBuilder_GetUsedLength(&_fixture->stringBuilder) + 1));
+    benchmarkSink += StringBuilder_InsertCharacters(&_fixture->stringBuilder, "inserted", 8);
+}
+static void Run_StringBuilder_Delete(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    StringBuilder_SetWriteOffset(&_fixture->stringBuilder, _argument % (StringBuilder_GetUsedLength(&_fixture->stringBuilder) + 1));
+    benchmarkSink += StringBuilder_Delete(&_fixture->stringBuilder, 1);
+}
+static void Run_StringBuilder_GetUsedLength(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    benchmarkSink += StringBuilder_GetUsedLength(&_fixture->stringBuilder);
+}
+static void Run_StringBuilder_GetStringWithOffset(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    benchmarkSink += (uintptr_t)StringBuilder_GetStringWithOffset(&_fixture->stringBuilder, _argument % (StringBuilder_GetUsedLength(&_fixture->stringBuilder) + 1));
+}
+static void Run_StringBuilder_Clear(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    StringBuilder_Clear(&_fixture->stringBuilder);
+    benchmarkSink += (uintptr_t)_fixture->stringBuilder.endPtr;
+}
+
+/* ---------------------------------------------------------------- SinglyLinkedList */
+
+static uint64_t searchedValue; // value looked up by the context-less list callbacks
+
+static bool IsSearchedValue(const void* _data) {
+    return *(const uint64_t*)_data == searchedValue;
+}
+static bool IsContextValue(const void* _data, void* _context) {
+    return *(const uint64_t*)_data == *(const uint64_t*)_context;
+}
+static void AccumulateValue(const void* _data) {
+    benchmarkSink += *(const uint64_t*)_data;
+}
+static uint8_t AccumulateValueWithContext(void* _data, void* _context) {
+    *(uint64_t*)_context += *(const uint64_t*)_data;
+    return SINGLYLINKEDLIST_CONTINUE;
+}
+static uint8_t KeepValueWithContext(const void* _data, void* _context) {
+    return (*(const uint64_t*)_data == *(const uint64_t*)_context) ? SINGLYLINKEDLIST_DELETE : SINGLYLINKEDLIST_CONTINUE;
+}
+static int CompareValues(const void* _a, const void* _b, void* _context) {
+    (void)_context;
+    const uint64_t _valueA = *(const uint64_t*)_a;
+    const uint64_t _valueB = *(const uint64_t*)_b;
+    return (_valueA > _valueB) - (_valueA < _valueB);
+}
+
+static void Run_SinglyLinkedList_AddNode(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    benchmarkSink += (uintptr_t)SinglyLinkedList_AddNode(&_fixture->list, &_argument);
+}
+static void Run_SinglyLinkedList_PushFront(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    benchmarkSink += (uintptr_t)SinglyLinkedList_PushFront(&_fixture->list, &_argument);
+}
+static void Run_SinglyLinkedList_PopFront(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    uint64_t _value;
+    benchmarkSink += SinglyLinkedList_PopFront(&_fixture->list, &_value);
+}
+static void Run_SinglyLinkedList_DeleteNodeByCondition(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    searchedValue = _argument & ~1ULL; // absent, visits every node
+    benchmarkSink += SinglyLinkedList_DeleteNodeByCondition(&_fixture->list, IsSearchedValue, true);
+}
+static void Run_SinglyLinkedList_DeleteNodesWithContext(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    uint64_t _value = _argument & ~1ULL;
+    benchmarkSink += SinglyLinkedList_DeleteNodesWithContext(&_fixture->list, KeepValueWithContext, &_value);
+}
+static void Run_SinglyLinkedList_FindFirst(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    uint64_t _value = _argument & ~1ULL;
+    benchmarkSink += (uintptr_t)SinglyLinkedList_FindFirst(&_fixture->list, IsContextValue, &_value);
+}
+static void Run_SinglyLinkedList_ExecuteFunctionForEachNode(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    SinglyLinkedList_ExecuteFunctionForEachNode(&_fixture->list, AccumulateValue);
+}
+static void Run_SinglyLinkedList_ExecuteFunctionForEachNodeWithContext(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    uint64_t _sum = 0;
+    SinglyLinkedList_ExecuteFunctionForEachNodeWithContext(&_fixture->list, AccumulateValueWithContext, &_sum);
+    benchmarkSink += _sum;
+}
+static void Run_SinglyLinkedList_SortedInsert(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    benchmarkSink += (uintptr_t)SinglyLinkedList_SortedInsert(&_fixture->list, &_argument, CompareValues, NULL);
+}
+static void Run_SinglyLinkedList_Sort(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    SinglyLinkedList_Sort(&_fixture->list, CompareValues, NULL);
+    benchmarkSink += (uintptr_t)_fixture->list.first;
+}
+static void Run_SinglyLinkedList_Concat(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument; // moves the list away and back
+    benchmarkSink += SinglyLinkedList_Concat(&_fixture->listAux, &_fixture->list);
+    benchmarkSink += SinglyLinkedList_Concat(&_fixture->list, &_fixture->listAux);
+}
+static void Run_SinglyLinkedList_ToDynamicArray(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    benchmarkSink += (uintptr_t)SinglyLinkedList_ToDynamicArray(&_fixture->list, &_fixture->dynamicArrayAux);
+}
+static void Run_SinglyLinkedList_FromDynamicArray(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    benchmarkSink += SinglyLinkedList_FromDynamicArray(&_fixture->listAux, &_fixture->dynamicArrayAux);
+}
+static void Run_SinglyLinkedList_DeleteAllNodes(benchmarkfixture_t* const _fixture, const uint64_t _argument) {
+    (void)_argument;
+    SinglyLinkedList_DeleteAllNodes(&_fixture->list);
+    benchmarkSink += _fixture->list.nodeCount;
+}
+
+static const benchmark_t benchmarks[] = {
+    {CONTAINER_DYNAMICARRAY, "Push", COST_CONSTANT, false, Run_DynamicArray_Push},
+    {CONTAINER_DYNAMICARRAY, "Pop", COST_CONSTANT, true, Run_DynamicArray_Pop},
+    {CONTAINER_DYNAMICARRAY, "Insert", COST_LINEAR, false, Run_DynamicArray_Insert},
+    {CONTAINER_DYNAMICARRAY, "Delete", COST_LINEAR, true, Run_DynamicArray_Delete},
+    {CONTAINER_DYNAMICARRAY, "HasValue", COST_LINEAR, false, Run_DynamicArray_HasValue},
+    {CONTAINER_DYNAMICARRAY, "GetElementNumberContainingValue", COST_LINEAR, false, Run_DynamicArray_GetElementNumberContainingValue},
+    {CONTAINER_DYNAMICARRAY, "ReserveElements", COST_CONSTANT, false, Run_DynamicArray_ReserveElements},
+    {CONTAINER_DYNAMICARRAY, "SetMinElementsWithSize", COST_LINEAR, false, Run_DynamicArray_SetMinElementsWithSize},
+    {CONTAINER_DYNAMICARRAY, "InitAll+Free", COST_LINEAR, false, Run_DynamicArray_InitAllFree},
+
+    {CONTAINER_DICTIONARY, "Set(new key)", COST_LINEAR, false, Run_Dictionary_SetNewKey},
+    {CONTAINER_DICTIONARY, "Set(existing key)", COST_CONSTANT, false, Run_Dictionary_SetExistingKey},
+    {CONTAINER_DICTIONARY, "Get", COST_CONSTANT, false, Run_Dictionary_Get},
+    {CONTAINER_DICTIONARY, "Get_Entry", COST_CONSTANT, false, Run_Dictionary_Get_Entry},
+    {CONTAINER_DICTIONARY, "Has_Key(hit)", COST_CONSTANT, false, Run_Dictionary_Has_KeyHit},
+    {CONTAINER_DICTIONARY, "Has_Key(miss)", COST_CONSTANT, false, Run_Dictionary_Has_KeyMiss},
+    {CONTAINER_DICTIONARY, "Has_Data", COST_LINEAR, false, Run_Dictionary_Has_Data},
+    {CONTAINER_DICTIONARY, "DeleteKey", COST_LINEAR, true, Run_Dictionary_DeleteKey},
+    {CONTAINER_DICTIONARY, "Free_Entry", COST_LINEAR, true, Run_Dictionary_Free_Entry},
+    {CONTAINER_DICTIONARY, "Merge", COST_WHOLE, false, Run_Dictionary_Merge},
+    {CONTAINER_DICTIONARY, "Clone", COST_WHOLE, false, Run_Dictionary_Clone},
+    {CONTAINER_DICTIONARY, "DeleteAllKeys", COST_CONSTANT, false, Run_Dictionary_DeleteAllKeys},
+    {CONTAINER_DICTIONARY, "Free_AllEntries", COST_WHOLE, false, Run_Dictionary_Free_AllEntries},
+    {CONTAINER_DICTIONARY, "ReserveElements", COST_CONSTANT, false, Run_Dictionary_ReserveElements},
+    {CONTAINER_DICTIONARY, "Init+Free", COST_CONSTANT, false, Run_Dictionary_InitFree},
+
+    {CONTAINER_DYNAMICSTRINGARRAY, "PushSubString", COST_CONSTANT, false, Run_DynamicStringArray_PushSubString},
+    {CONTAINER_DYNAMICSTRINGARRAY, "Pop", COST_CONSTANT, true, Run_DynamicStringArray_Pop},
+    {CONTAINER_DYNAMICSTRINGARRAY, "InsertSubString", COST_LINEAR, false, Run_DynamicStringArray_InsertSubString},
+    {CONTAINER_DYNAMICSTRINGARRAY, "Delete", COST_LINEAR, true, Run_DynamicStringArray_Delete},
+    {CONTAINER_DYNAMICSTRINGARRAY, "Search", COST_LINEAR, false, Run_DynamicStringArray_Search},
+    {CONTAINER_DYNAMICSTRINGARRAY, "ReserveBufferSize", COST_CONSTANT, false, Run_DynamicStringArray_ReserveBufferSize},
+    {CONTAINER_DYNAMICSTRINGARRAY, "ReserveElements", COST_CONSTANT, false, Run_DynamicStringArray_ReserveElements},
+    {CONTAINER_DYNAMICSTRINGARRAY, "Clear", COST_CONSTANT, false, Run_DynamicStringArray_Clear},
+    {CONTAINER_DYNAMICSTRINGARRAY, "InitAll+Free", COST_CONSTANT, false, Run_DynamicStringArray_InitFree},
+
+    {CONTAINER_BINARYBUILDER, "SetByte", COST_CONSTANT, false, Run_BinaryBuilder_SetByte},
+    {CONTAINER_BINARYBUILDER, "SetBytes", COST_CONSTANT, false, Run_BinaryBuilder_SetBytes},
+    {CONTAINER_BINARYBUILDER, "InsertByte", COST_LINEAR, false, Run_BinaryBuilder_InsertByte},
+    {CONTAINER_BINARYBUILDER, "InsertBytes", COST_LINEAR, false, Run_BinaryBuilder_InsertBytes},
+    {CONTAINER_BINARYBUILDER, "Delete", COST_LINEAR, true, Run_BinaryBuilder_Delete},
+    {CONTAINER_BINARYBUILDER, "SetWriteOffset", COST_CONSTANT, false, Run_BinaryBuilder_SetWriteOffset},
+    {CONTAINER_BINARYBUILDER, "SetUsedSize", COST_CONSTANT, false, Run_BinaryBuilder_SetUsedSize},
+    {CONTAINER_BINARYBUILDER, "ReserveSize", COST_CONSTANT, false, Run_BinaryBuilder_ReserveSize},
+    {CONTAINER_BINARYBUILDER, "Clone", COST_WHOLE, false, Run_BinaryBuilder_Clone},
+    {CONTAINER_BINARYBUILDER, "Clear", COST_CONSTANT, false, Run_BinaryBuilder_Clear},
+    {CONTAINER_BINARYBUILDER, "BinaryData_SetMinSize", COST_LINEAR, false, Run_BinaryData_SetMinSize},
+    {CONTAINER_BINARYBUILDER, "BinaryData_Clone", COST_WHOLE, false, Run_BinaryData_Clone},
+
+    {CONTAINER_STRINGBUILDER, "InsertCharacter", COST_CONSTANT, false, Run_StringBuilder_InsertCharacter},
+    {CONTAINER_STRINGBUILDER, "InsertString", COST_CONSTANT, false, Run_StringBuilder_InsertString},
+    {CONTAINER_STRINGBUILDER, "InsertFormattedString", COST_CONSTANT, false, Run_StringBuilder_InsertFormattedString},
+    {CONTAINER_STRINGBUILDER, "InsertCharacters", COST_LINEAR, false, Run_StringBuilder_InsertCharacters},
+    {CONTAINER_STRINGBUILDER, "Delete", COST_LINEAR, true, Run_StringBuilder_Delete},
+    {CONTAINER_STRINGBUILDER, "GetUsedLength", COST_CONSTANT, false, Run_StringBuilder_GetUsedLength},
+    {CONTAINER_STRINGBUILDER, "GetStringWithOffset", COST_CONSTANT, false, Run_StringBuilder_GetStringWithOffset},
+    {CONTAINER_STRINGBUILDER, "Clear", COST_CONSTANT, false, Run_StringBuilder_Clear},
+
+    {CONTAINER_SINGLYLINKEDLIST, "AddNode", COST_CONSTANT, false, Run_SinglyLinkedList_AddNode},
+    {CONTAINER_SINGLYLINKEDLIST, "PushFront", COST_CONSTANT, false, Run_SinglyLinkedList_PushFront},
+    {CONTAINER_SINGLYLINKEDLIST, "PopFront", COST_CONSTANT, true, Run_SinglyLinkedList_PopFront},
+    {CONTAINER_SINGLYLINKEDLIST, "DeleteNodeByCondition", COST_LINEAR, false, Run_SinglyLinkedList_DeleteNodeByCondition},
+    {CONTAINER_SINGLYLINKEDLIST, "DeleteNodesWithContext", COST_LINEAR, false, Run_SinglyLinkedList_DeleteNodesWithContext},
+    {CONTAINER_SINGLYLINKEDLIST, "FindFirst", COST_LINEAR, false, Run_SinglyLinkedList_FindFirst},
+    {CONTAINER_SINGLYLINKEDLIST, "ExecuteFunctionForEachNode", COST_LINEAR, false, Run_SinglyLinkedList_ExecuteFunctionForEachNode},
+    {CONTAINER_SINGLYLINKEDLIST, "ExecuteFunctionForEachNodeWithContext", COST_LINEAR, false, Run_SinglyLinkedList_ExecuteFunctionForEachNodeWithContext},
+    {CONTAINER_SINGLYLINKEDLIST, "SortedInsert", COST_LINEAR, false, Run_SinglyLinkedList_SortedInsert},
+    {CONTAINER_SINGLYLINKEDLIST, "Sort", COST_WHOLE, false, Run_SinglyLinkedList_Sort},
+    {CONTAINER_SINGLYLINKEDLIST, "Concat", COST_CONSTANT, false, Run_SinglyLinkedList_Concat},
+    {CONTAINER_SINGLYLINKEDLIST, "ToDynamicArray", COST_LINEAR, false, Run_SinglyLinkedList_ToDynamicArray},
+    {CONTAINER_SINGLYLINKEDLIST, "FromDynamicArray(64)", COST_CONSTANT, false, Run_SinglyLinkedList_FromDynamicArray},
+    {CONTAINER_SINGLYLINKEDLIST, "DeleteAllNodes", COST_WHOLE, false, Run_SinglyLinkedList_DeleteAllNodes},
+};
+
+/* ---------------------------------------------------------------- driver */
+
+static int CompareSamples(const void* _a, const void* _b) {
+    const uint64_t _sampleA = *(const uint64_t*)_a;
+    const uint64_t _sampleB = *(const uint64_t*)_b;
+    return (_sampleA > _sampleB) - (_sampleA < _sampleB);
+}
+
+static inline uint64_t GetPercentile(const uint64_t* const _sortedSamples, const size_t _sampleCount, const double _percentile) {
+    size_t _index = (size_t)(_percentile * _sampleCount);
+    return _sortedSamples[(_index < _sampleCount) ? _index : (_sampleCount - 1)];
+}
+
+// number of timed calls in one round
+static size_t GetCallsPerRound(const benchmark_t* const _benchmark, const size_t _size, const benchmarkoptions_t* const _options) {
+    size_t _calls;
+    switch (_benchmark->cost) {
+    case COST_CONSTANT:
+        _calls = _options->opCap;
+    break; case COST_LINEAR:
+        _calls = _options->workBudget / (_size ? _size : 1);
+        if (_calls > _options->opCap) {
+            _calls = _options->opCap;
+        }
+    break; default:
+        _calls = 1;
+    break;
+    }
+    if (_size && (_calls > _size) && (_benchmark->isShrinking || (_benchmark->cost == COST_CONSTANT))) {
+        _calls = _size; // keep the container close to its measured size
+    }
+    return _calls ? _calls : 1;
+}
+
+static bool RunBenchmark(const benchmark_t* const _benchmark, const size_t _size, const benchmarkoptions_t* const _options, const bool _isFirstResult) {
+    const size_t _callsPerRound = GetCallsPerRound(_benchmark, _size, _options);
+    size_t _roundCount = (BENCHMARK_MINSAMPLES + _callsPerRound - 1) / _callsPerRound;
+    const size_t _maxRoundCount = _options->workBudget / (_size ? _size : 1); // rebuilding huge fixtures is costly
+    if (_roundCount > _maxRoundCount) {
+        _roundCount = _maxRoundCount;
+    }
+    if (!_roundCount) {
+        _roundCount = 1;
+    }
+    const size_t _sampleCount = _callsPerRound * _roundCount;
+    uint64_t* const _samples = malloc(_sampleCount * sizeof(uint64_t));
+    uint64_t* const _arguments = malloc(_callsPerRound * sizeof(uint64_t));
+    benchmarkfixture_t* const _fixture = malloc(sizeof(benchmarkfixture_t));
+    if (!_samples || !_arguments || !_fixture) {
+        free(_samples);
+        free(_arguments);
+        free(_fixture);
+        return false; // insufficient memory
+    }
+
+    uint64_t _totalNanoseconds = 0;
+    for (size_t _round = 0; _round < _roundCount; _round++) {
+        uint64_t _random = GetRoundSeed(_options->seed, _benchmark->operation, _size, _round) ^ (uint64_t)_benchmark->container;
+        SetupFixture(_fixture, _benchmark->container, _size, &_random);
+        for (size_t i = 0; i < _callsPerRound; i++) {
+            _arguments[i] = Hash_SplitMix64(&_random);
+        }
+        uint64_t* const _roundSamples = _samples + (_round * _callsPerRound);
+        for (size_t i = 0; i < _callsPerRound; i++) {
+            const uint64_t _start = GetNanoseconds();
+            _benchmark->Run(_fixture, _arguments[i]);
+            uint64_t _elapsed = GetNanoseconds() - _start;
+            _elapsed = (_elapsed > timerOverhead) ? (_elapsed - timerOverhead) : 0;
+            _roundSamples[i] = _elapsed;
+            _totalNanoseconds += _elapsed;
+        }
+        TeardownFixture(_fixture, _benchmark->container);
+    }
+
+    qsort(_samples, _sampleCount, sizeof(uint64_t), CompareSamples);
+    const double _callsPerSecond = _totalNanoseconds ? ((double)_sampleCount * 1e9 / (double)_totalNanoseconds) : 0.0;
+    const uint64_t _p50 = GetPercentile(_samples, _sampleCount, 0.50);
+    const uint64_t _p90 = GetPercentile(_samples, _sampleCount, 0.90);
+    const uint64_t _p99 = GetPercentile(_samples, _sampleCount, 0.99);
+    const uint64_t _p999 = GetPercentile(_samples, _sampleCount, 0.999);
+    const uint64_t _max = _samples[_sampleCount - 1];
+    if (!strcmp(_options->format, "json")) {
+        printf("%s    {\"container\": \"%s\", \"operation\": \"%s\", \"size\": %zu, \"calls\": %zu, \"total_ns\": %llu, "
+            "\"calls_per_sec\": %.1f, \"p50_ns\": %llu, \"p90_ns\": %llu, \"p99_ns\": %llu, \"p999_ns\": %llu, \"max_ns\": %llu}",
+            _isFirstResult ? "" : ",\n", containerNames[_benchmark->container], _benchmark->operation, _size, _sampleCount,
+            (unsigned long long)_totalNanoseconds, _callsPerSecond, (unsigned long long)_p50, (unsigned long long)_p90,
+            (unsigned long long)_p99, (unsigned long long)_p999, (unsigned long long)_max
+        );
+    } else {
+        printf("%s,%s,%zu,%zu,%llu,%.1f,%llu,%llu,%llu,%llu,%llu\n",
+            containerNames[_benchmark->container], _benchmark->operation, _size, _sampleCount,
+            (unsigned long long)_totalNanoseconds, _callsPerSecond, (unsigned long long)_p50, (unsigned long long)_p90,
+            (unsigned long long)_p99, (unsigned long long)_p999, (unsigned long long)_max
+        );
+    }
+    fflush(stdout);
+
+    free(_samples);
+    free(_arguments);
+    free(_fixture);
+    return true;
+}
+
+static bool ParseOptions(const int argc, char** const argv, benchmarkoptions_t* const _options) {
+    _options->format = "csv";
+    _options->minSize = BENCHMARK_DEFAULT_MINSIZE;
+    _options->maxSize = BENCHMARK_DEFAULT_MAXSIZE;
+    _options->seed = BENCHMARK_DEFAULT_SEED;
+    _options->filter = NULL;
+    _options->opCap = BENCHMARK_DEFAULT_OPCAP;
+    _options->workBudget = BENCHMARK_DEFAULT_WORKBUDGET;
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc) {
+            return false; // every option requires a value
+        }
+        const char* const _option = argv[i];
+        const char* const _value = argv[++i];
+        if (!strcmp(_option, "--format")) {
+            _options->format = _value;
+        } else if (!strcmp(_option, "--min-size")) {
+            _options->minSize = strtoull(_value, NULL, 10);
+        } else if (!strcmp(_option, "--max-size")) {
+            _options->maxSize = strtoull(_value, NULL, 10);
+        } else if (!strcmp(_option, "--seed")) {
+            _options->seed = strtoull(_value, NULL, 10);
+        } else if (!strcmp(_option, "--filter")) {
+            _options->filter = _value;
+        } else if (!strcmp(_option, "--op-cap")) {
+            _options->opCap = strtoull(_value, NULL, 10);
+        } else if (!strcmp(_option, "--work-budget")) {
+            _options->workBudget = strtoull(_value, NULL, 10);
+        } else {
+            return false; // unknown option
+        }
+    }
+    return (!strcmp(_options->format, "csv") || !strcmp(_options->format, "json")) && _options->minSize && _options->opCap;
+}
+
+int main(int argc, char** argv) {
+    benchmarkoptions_t _options;
+    if (!ParseOptions(argc, argv, &_options)) {
+        fprintf(stderr, "Usage: %s [--format csv|json] [--min-size N] [--max-size N] [--seed N] [--filter TEXT] [--op-cap N] [--work-budget N]\n", argv[0]);
+        return 1;
+    }
+    CalibrateTimer();
+
+    const bool _isJson = !strcmp(_options.format, "json");
+    if (_isJson) {
+        printf("{\n  \"seed\": %llu,\n  \"timer_overhead_ns\": %llu,\n  \"results\": [\n", (unsigned long long)_options.seed, (unsigned long long)timerOverhead);
+    } else {
+        printf("container,operation,size,calls,total_ns,calls_per_sec,p50_ns,p90_ns,p99_ns,p999_ns,max_ns\n");
+    }
+    bool _isFirstResult = true;
+    for (size_t b = 0; b < (sizeof(benchmarks) / sizeof(benchmarks[0])); b++) {
+        const benchmark_t* const _benchmark = &benchmarks[b];
+        if (_options.filter
+        && !strstr(containerNames[_benchmark->container], _options.filter)
+        && !strstr(_benchmark->operation, _options.filter)) {
+            continue; // not selected
+        }
+        for (size_t _size = _options.minSize; _size <= _options.maxSize; _size *= 10) {
+            fprintf(stderr, "%s_%s size=%zu\n", containerNames[_benchmark->container], _benchmark->operation, _size);
+            if (!RunBenchmark(_benchmark, _size, &_options, _isFirstResult)) {
+                fprintf(stderr, "  skipped: insufficient memory\n");
+                continue;
+            }
+            _isFirstResult = false;
+        }
+    }
+    if (_isJson) {
+        printf("\n  ]\n}\n");
+    }
+    return 0;
+}
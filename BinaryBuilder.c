@@ -3,7 +3,7 @@
  * @Author: Aldrin John O. Manalansan (ajom)
  * @Email: aldrinjohnolaermanalansan@gmail.com
  * @Brief: Dynamically construct binaries without worrying about the allocated memory size
- * @LastUpdate: June 16, 2025
+ * @LastUpdate: October 19, 2026
  * 
  * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
  * 
@@ -32,6 +32,8 @@ bool BinaryBuilder_SetMinSize(binarybuilder_t* const _binaryBuilder, size_t _min
 	if (!expandedBuffer) {
 		return false; // failed expanding our buffer's size, therefore initialization requirement wasn't met
 	}
+	INSTRUMENTATION_REALLOCATION(&_binaryBuilder->instrumentation, _minCapacity);
+	INSTRUMENTATION_GROWTH(&_binaryBuilder->instrumentation, _minCapacity);
 	ptrdiff_t _offset = (ptrdiff_t)expandedBuffer - (ptrdiff_t)_binaryBuilder->data;
 	_binaryBuilder->data = expandedBuffer;
 	_binaryBuilder->capacity = _minCapacity;
@@ -79,9 +81,8 @@ bool BinaryBuilder_SetUsedSize(binarybuilder_t* const _binaryBuilder, const uint
 	return true;
 }
 
-// Removes number of bytes at the left of the write offset
-// Returns the number of bytes deleted
-size_t BinaryBuilder_Delete(binarybuilder_t* const _binaryBuilder, size_t _length) {
+// BinaryBuilder_Delete without recording its latency nor its trace
+static inline size_t BinaryBuilder_DeleteUntimed(binarybuilder_t* const _binaryBuilder, size_t _length) {
 	size_t _leftHandLength = (size_t)_binaryBuilder->writePtr - (size_t)_binaryBuilder->data;
 	if (_length > _leftHandLength) { // byte length is more than what is allowed at the lefthand side of our writer
 		_length = _leftHandLength;
@@ -93,6 +94,7 @@ size_t BinaryBuilder_Delete(binarybuilder_t* const _binaryBuilder, size_t _lengt
 				_binaryBuilder->writePtr,
 				(size_t)_binaryBuilder->endPtr - (size_t)_binaryBuilder->writePtr
 			);
+			INSTRUMENTATION_MOVE(&_binaryBuilder->instrumentation, (size_t)_binaryBuilder->endPtr - (size_t)_binaryBuilder->writePtr);
 		}
 		_binaryBuilder->writePtr = (uint8_t*)_binaryBuilder->writePtr - _length;
 		_binaryBuilder->endPtr = (uint8_t*)_binaryBuilder->endPtr - _length;
@@ -100,11 +102,21 @@ size_t BinaryBuilder_Delete(binarybuilder_t* const _binaryBuilder, size_t _lengt
 	return _length;
 }
 
-/* Sets a single byte at the write offset without deleting any bytes at the current binary
+// Removes number of bytes at the left of the write offset
+// Returns the number of bytes deleted
+size_t BinaryBuilder_Delete(binarybuilder_t* const _binaryBuilder, size_t _length) {
+	INSTRUMENTATION_TRACE(INSTRUMENTATION_OPERATION_BINARYBUILDER_DELETE, _binaryBuilder, BinaryBuilder_GetWriteOffset(_binaryBuilder), _length, NULL, 0);
+	INSTRUMENTATION_LATENCY_BEGIN(_start);
+	const size_t _deletedLength = BinaryBuilder_DeleteUntimed(_binaryBuilder, _length);
+	INSTRUMENTATION_LATENCY_END(INSTRUMENTATION_OPERATION_BINARYBUILDER_DELETE, _start);
+	return _deletedLength;
+}
+
+/* Sets a single byte at the write offset, expanding the buffer if necessary. See BinaryBuilder_SetByte
  * Returns an offset to where the byte got written
  * Returns -1 if the byte wasn't written
  */
-uintptr_t BinaryBuilder_SetByte(binarybuilder_t* const _binaryBuilder, const uint8_t byte) {
+uintptr_t BinaryBuilder_SetByteSlow(binarybuilder_t* const _binaryBuilder, const uint8_t byte) {
 	if (UINTPTR_MAX == BinaryBuilder_ReserveSize(_binaryBuilder, 1)) {
 		return UINTPTR_MAX; // insufficient memory
 	}
@@ -144,17 +156,18 @@ uintptr_t BinaryBuilder_SetBytes(binarybuilder_t* const _binaryBuilder, const vo
 	return initialOffset;
 }
 
-/* Inserts a single byte at the write offset without deleting any bytes at the current binary
+/* Inserts a single byte at the write offset, shifting the bytes after it and expanding the buffer if necessary. See BinaryBuilder_InsertByte
  * Returns an offset to where the byte got written
  * Returns -1 if the byte wasn't written
  */
-uintptr_t BinaryBuilder_InsertByte(binarybuilder_t* const _binaryBuilder, const uint8_t byte) {
+uintptr_t BinaryBuilder_InsertByteSlow(binarybuilder_t* const _binaryBuilder, const uint8_t byte) {
 	if (UINTPTR_MAX == BinaryBuilder_ReserveSize(_binaryBuilder, 1)) {
 		return UINTPTR_MAX; // insufficient memory
 	}
 	const uintptr_t initialOffset = BinaryBuilder_GetWriteOffset(_binaryBuilder);
 	if (_binaryBuilder->writePtr < _binaryBuilder->endPtr) { // write pointer is in between the binary content of the buffer
 		memmove((uint8_t*)_binaryBuilder->writePtr + 1, _binaryBuilder->writePtr, (size_t)_binaryBuilder->endPtr - (size_t)_binaryBuilder->writePtr);
+		INSTRUMENTATION_MOVE(&_binaryBuilder->instrumentation, (size_t)_binaryBuilder->endPtr - (size_t)_binaryBuilder->writePtr);
 	}
 	*(uint8_t*)_binaryBuilder->writePtr = byte; // change the byte at the write pointer to our desired byte
 	_binaryBuilder->writePtr = (uint8_t*)_binaryBuilder->writePtr + 1;
@@ -162,13 +175,8 @@ uintptr_t BinaryBuilder_InsertByte(binarybuilder_t* const _binaryBuilder, const
 	return initialOffset;
 }
 
-/* Inserts a number of bytes at the write offset without deleting any bytes at the current binary
- * if _source = 0x0 to 0xFF , fills the field with this bytes, for example:
- * else, set _source with a valid pointer where the copied data is located
- * Returns an offset to where the bytes got written
- * Returns -1 if the bytes wasn't written
- */
-uintptr_t BinaryBuilder_InsertBytes(binarybuilder_t* const _binaryBuilder, const void* const _source, const size_t _length) {
+// BinaryBuilder_InsertBytes without recording its latency nor its trace
+static inline uintptr_t BinaryBuilder_InsertBytesUntimed(binarybuilder_t* const _binaryBuilder, const void* const _source, const size_t _length) {
 	if (_binaryBuilder->writePtr >= _binaryBuilder->endPtr) { // write pointer is NOT in between the binary content of the buffer
 		return BinaryBuilder_SetBytes(_binaryBuilder, _source, _length);
 	}
@@ -192,6 +200,7 @@ uintptr_t BinaryBuilder_InsertBytes(binarybuilder_t* const _binaryBuilder, const
 		memmove((uint8_t*)_binaryBuilder->writePtr + _length, _binaryBuilder->writePtr, (size_t)_binaryBuilder->endPtr - (size_t)_binaryBuilder->writePtr);
 		memset(_binaryBuilder->writePtr, (int)((uintptr_t)_source & UINT_MAX), _length);
 	}
+	INSTRUMENTATION_MOVE(&_binaryBuilder->instrumentation, (size_t)_binaryBuilder->endPtr - (size_t)_binaryBuilder->writePtr);
 
 	const uintptr_t initialOffset = BinaryBuilder_GetWriteOffset(_binaryBuilder);
 	_binaryBuilder->writePtr = (uint8_t*)_binaryBuilder->writePtr + _length;
@@ -199,6 +208,20 @@ uintptr_t BinaryBuilder_InsertBytes(binarybuilder_t* const _binaryBuilder, const
 	return initialOffset;
 }
 
+/* Inserts a number of bytes at the write offset without deleting any bytes at the current binary
+ * if _source = 0x0 to 0xFF , fills the field with this bytes, for example:
+ * else, set _source with a valid pointer where the copied data is located
+ * Returns an offset to where the bytes got written
+ * Returns -1 if the bytes wasn't written
+ */
+uintptr_t BinaryBuilder_InsertBytes(binarybuilder_t* const _binaryBuilder, const void* const _source, const size_t _length) {
+	INSTRUMENTATION_TRACE(INSTRUMENTATION_OPERATION_BINARYBUILDER_INSERTBYTES, _binaryBuilder, BinaryBuilder_GetWriteOffset(_binaryBuilder), _length, NULL, 0);
+	INSTRUMENTATION_LATENCY_BEGIN(_start);
+	const uintptr_t _offset = BinaryBuilder_InsertBytesUntimed(_binaryBuilder, _source, _length);
+	INSTRUMENTATION_LATENCY_END(INSTRUMENTATION_OPERATION_BINARYBUILDER_INSERTBYTES, _start);
+	return _offset;
+}
+
 // Clears the binary making it look blank/empty
 void BinaryBuilder_Clear(binarybuilder_t* const _binaryBuilder) {
 	_binaryBuilder->writePtr = _binaryBuilder->data;
@@ -207,9 +230,11 @@ void BinaryBuilder_Clear(binarybuilder_t* const _binaryBuilder) {
 
 // Only frees the BinaryBuilder's buffer
 void BinaryBuilder_FreeBuffer(binarybuilder_t* const _binaryBuilder) {
+	INSTRUMENTATION_TRACE_FORGET(INSTRUMENTATION_OPERATION_BINARYBUILDER_INSERTBYTES, _binaryBuilder);
 	if ((_binaryBuilder->expansionRate >= 1.0) && _binaryBuilder->data) { // has allocated auto-expanding buffer
 		free(_binaryBuilder->data);
 		_binaryBuilder->data = NULL;
+		INSTRUMENTATION_FREE(&_binaryBuilder->instrumentation);
 	}
 }
 
@@ -217,10 +242,13 @@ void BinaryBuilder_FreeBuffer(binarybuilder_t* const _binaryBuilder) {
  * CAUTION! Do not pass pointer to a permanent BinaryBuilder variable!
  */
 void BinaryBuilder_Free(binarybuilder_t* _binaryBuilder) {
+	INSTRUMENTATION_TRACE_FORGET(INSTRUMENTATION_OPERATION_BINARYBUILDER_INSERTBYTES, _binaryBuilder);
 	if ((_binaryBuilder->expansionRate >= 1.0) && _binaryBuilder->data) { // has allocated auto-expanding buffer
 		free(_binaryBuilder->data);
+		INSTRUMENTATION_FREE(NULL);
 	}
 	free((void*)_binaryBuilder);
+	INSTRUMENTATION_FREE(NULL);
 }
 
 // Copies of the source's contents to the destination
@@ -231,6 +259,7 @@ binarybuilder_t* BinaryBuilder_Clone(binarybuilder_t* restrict _destination, con
 		return NULL;
 	}
 	memcpy(_destination->data, _source->data, _source->capacity);
+	INSTRUMENTATION_MOVE(&_destination->instrumentation, _source->capacity);
 	_destination->writePtr = (uint8_t*)_destination->data + BinaryBuilder_GetWriteOffset(_source);
 	_destination->endPtr = (uint8_t*)_destination->data + BinaryBuilder_GetCurrentSize(_source);
 	return _destination;
@@ -252,6 +281,10 @@ binarybuilder_t* BinaryBuilder_InitWithMinSize(binarybuilder_t* _binaryBuilder,
 	} else {
 		_mallocVar = false;
 	}
+	INSTRUMENTATION_RESET(&_binaryBuilder->instrumentation);
+	if (_mallocVar) {
+		INSTRUMENTATION_ALLOCATION(&_binaryBuilder->instrumentation, sizeof(binarybuilder_t));
+	}
 	_binaryBuilder->expansionRate = _expansionRate + 1.0;
 	if (!_binaryBuilder->data) { // buffer isn't initialized yet
 		_binaryBuilder->data = malloc(_minCapacity);
@@ -261,6 +294,7 @@ binarybuilder_t* BinaryBuilder_InitWithMinSize(binarybuilder_t* _binaryBuilder,
 			}
 			return NULL; // failed allocating buffer to our binarybuilder variable
 		}
+		INSTRUMENTATION_ALLOCATION(&_binaryBuilder->instrumentation, _minCapacity);
 		_binaryBuilder->capacity = _minCapacity;
 	} else if (!BinaryBuilder_SetMinSize(_binaryBuilder, _minCapacity)) {
 		if (_mallocVar) {
@@ -288,6 +322,7 @@ binarybuilder_t* BinaryBuilder_SetAutoExpandWithMinSize(binarybuilder_t* const _
 void BinaryBuilder_InitUsingBuffer(binarybuilder_t* const _binaryBuilder, void* const _data, const size_t _capacity) {
 	if (_binaryBuilder->data && (_binaryBuilder->expansionRate >= 1.0))  { // allocated memory is an autoexpanding type of buffer
 		free(_binaryBuilder->data);
+		INSTRUMENTATION_FREE(&_binaryBuilder->instrumentation);
 	}
 	_binaryBuilder->capacity = _capacity;
 	_binaryBuilder->data = _data;
@@ -301,6 +336,7 @@ void BinaryData_FreeBuffer(binarydata_t* const _binaryData) {
 	if (_binaryData->data) { // has allocated auto-expanding buffer
 		free(_binaryData->data);
 		_binaryData->data = NULL;
+		INSTRUMENTATION_FREE(&_binaryData->instrumentation);
 	}
 }
 
@@ -310,8 +346,10 @@ void BinaryData_FreeBuffer(binarydata_t* const _binaryData) {
 void BinaryData_Free(binarydata_t* _binaryData) {
 	if (_binaryData->data) { // has allocated auto-expanding buffer
 		free(_binaryData->data);
+		INSTRUMENTATION_FREE(NULL);
 	}
 	free((void*)_binaryData);
+	INSTRUMENTATION_FREE(NULL);
 }
 
 // assures the minimum size of the binary buffer. Expanding its memory size if necessary
@@ -323,6 +361,8 @@ bool BinaryData_SetMinSize(binarydata_t* const _binaryData, const size_t _minCap
 	if (!expandedBuffer) {
 		return false; // failed expanding our buffer's size, therefore initialization requirement wasn't met
 	}
+	INSTRUMENTATION_REALLOCATION(&_binaryData->instrumentation, _minCapacity);
+	INSTRUMENTATION_GROWTH(&_binaryData->instrumentation, _minCapacity);
 	_binaryData->data = expandedBuffer;
 	_binaryData->capacity = _minCapacity;
 	return true;
@@ -336,6 +376,7 @@ binarydata_t* BinaryData_Clone(binarydata_t* restrict _destination, const binary
 		return NULL;
 	}
 	memcpy(_destination->data, _source->data, _source->capacity);
+	INSTRUMENTATION_MOVE(&_destination->instrumentation, _source->capacity);
 	return _destination;
 }
 
@@ -355,6 +396,10 @@ binarydata_t* BinaryData_InitWithMinSize(binarydata_t* _binaryData, const size_t
 	} else {
 		_mallocVar = false;
 	}
+	INSTRUMENTATION_RESET(&_binaryData->instrumentation);
+	if (_mallocVar) {
+		INSTRUMENTATION_ALLOCATION(&_binaryData->instrumentation, sizeof(binarydata_t));
+	}
 	if (!_binaryData->data) { // buffer isn't initialized yet
 		_binaryData->data = malloc(_minCapacity);
 		if (!_binaryData->data) {
@@ -363,6 +408,7 @@ binarydata_t* BinaryData_InitWithMinSize(binarydata_t* _binaryData, const size_t
 			}
 			return NULL; // failed allocating buffer to our BinaryData variable
 		}
+		INSTRUMENTATION_ALLOCATION(&_binaryData->instrumentation, _minCapacity);
 		_binaryData->capacity = _minCapacity;
 	} else if (!BinaryData_SetMinSize(_binaryData, _minCapacity)) {
 		if (_mallocVar) {
@@ -3,7 +3,7 @@
  * @Author: Aldrin John O. Manalansan (ajom)
  * @Email: aldrinjohnolaermanalansan@gmail.com
  * @Brief: Dynamically construct binaries without worrying about the allocated memory size
- * @LastUpdate: June 16, 2025
+ * @LastUpdate: October 18, 2026
  * 
  * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
  * 
@@ -23,6 +23,8 @@
 #include <stddef.h>
 #include <limits.h>
 
+#include "Instrumentation.h"
+
 #define _BINARYBUILDER_INITIALCAPACITY 200
 #define _BINARYBUILDER_BUFFEREXPANSIONRATE 0.5
 
@@ -32,11 +34,17 @@ typedef struct {
     void* writePtr;
     void* endPtr;        // buffer <= writePtr <= endPtr <= (buffer + capacity - 1)
 	float expansionRate;	// how much memory is increased every memory expansion
+#ifdef DDS_INSTRUMENTATION
+    instrumentation_counters_t instrumentation; // stringbuilder_t mirrors this member
+#endif
 } binarybuilder_t;
 
 typedef struct {
     size_t capacity;
     void* data;
+#ifdef DDS_INSTRUMENTATION
+    instrumentation_counters_t instrumentation;
+#endif
 } binarydata_t;
 
 bool BinaryBuilder_SetMinSize(binarybuilder_t* const _binaryBuilder, size_t _minCapacity);
@@ -44,9 +52,9 @@ uintptr_t BinaryBuilder_ReserveSize(binarybuilder_t* const _binaryBuilder, const
 bool BinaryBuilder_SetWriteOffset(binarybuilder_t* const _binaryBuilder, const uintptr_t _offset);
 bool BinaryBuilder_SetUsedSize(binarybuilder_t* const _binaryBuilder, const uintptr_t _offset);
 size_t BinaryBuilder_Delete(binarybuilder_t* const _binaryBuilder, size_t _length);
-uintptr_t BinaryBuilder_SetByte(binarybuilder_t* const _binaryBuilder, const uint8_t byte);
+uintptr_t BinaryBuilder_SetByteSlow(binarybuilder_t* const _binaryBuilder, const uint8_t byte);
 uintptr_t BinaryBuilder_SetBytes(binarybuilder_t* const _binaryBuilder, const void* const _source, const size_t _length);
-uintptr_t BinaryBuilder_InsertByte(binarybuilder_t* const _binaryBuilder, const uint8_t byte);
+uintptr_t BinaryBuilder_InsertByteSlow(binarybuilder_t* const _binaryBuilder, const uint8_t byte);
 uintptr_t BinaryBuilder_InsertBytes(binarybuilder_t* const _binaryBuilder, const void* const _source, const size_t _length);
 void BinaryBuilder_Clear(binarybuilder_t* const _binaryBuilder);
 void BinaryBuilder_FreeBuffer(binarybuilder_t* const _binaryBuilder);
@@ -73,4 +81,42 @@ binarydata_t* BinaryData_InitWithMinSize(binarydata_t* _binaryData, const size_t
 
 #define BinaryData_Init(_binaryData) BinaryData_InitWithMinSize(_binaryData, _BINARYBUILDER_INITIALCAPACITY)
 
+/* Sets a single byte at the write offset without deleting any bytes at the current binary
+ * writes the byte inline while the buffer has room, only an expansion calls BinaryBuilder_SetByteSlow
+ * Returns an offset to where the byte got written
+ * Returns -1 if the byte wasn't written
+ */
+static inline uintptr_t BinaryBuilder_SetByte(binarybuilder_t* const _binaryBuilder, const uint8_t byte) {
+	if ((uint8_t*)_binaryBuilder->endPtr >= ((uint8_t*)_binaryBuilder->data + _binaryBuilder->capacity)) { // requires expansion
+		return BinaryBuilder_SetByteSlow(_binaryBuilder, byte);
+	}
+	const uintptr_t initialOffset = BinaryBuilder_GetWriteOffset(_binaryBuilder);
+	uint8_t* const _writePtr = _binaryBuilder->writePtr;
+	*_writePtr = byte;
+	_binaryBuilder->writePtr = _writePtr + 1;
+	if (_binaryBuilder->endPtr < _binaryBuilder->writePtr) { // written byte is beyond the endPtr
+		_binaryBuilder->endPtr = _binaryBuilder->writePtr;
+	}
+	return initialOffset;
+}
+
+/* Inserts a single byte at the write offset without deleting any bytes at the current binary
+ * appends the byte inline while the write offset is at the end and the buffer has room,
+ * else BinaryBuilder_InsertByteSlow shifts the following bytes or expands the buffer
+ * Returns an offset to where the byte got written
+ * Returns -1 if the byte wasn't written
+ */
+static inline uintptr_t BinaryBuilder_InsertByte(binarybuilder_t* const _binaryBuilder, const uint8_t byte) {
+	if ((_binaryBuilder->writePtr != _binaryBuilder->endPtr) // requires shifting
+	|| ((uint8_t*)_binaryBuilder->endPtr >= ((uint8_t*)_binaryBuilder->data + _binaryBuilder->capacity))) { // requires expansion
+		return BinaryBuilder_InsertByteSlow(_binaryBuilder, byte);
+	}
+	const uintptr_t initialOffset = BinaryBuilder_GetWriteOffset(_binaryBuilder);
+	uint8_t* const _writePtr = _binaryBuilder->writePtr;
+	*_writePtr = byte;
+	_binaryBuilder->writePtr = _writePtr + 1;
+	_binaryBuilder->endPtr = _writePtr + 1;
+	return initialOffset;
+}
+
 #endif
@@ -0,0 +1,309 @@
+/*
+ * @File: Bitset.c
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Growable array of bits with popcount rank, SIMD logical operations and set bit iteration
+ * @LastUpdate: October 18, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ */
+
+#include "Bitset.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__AVX2__)
+	#include <immintrin.h>
+#elif defined(__SSE2__)
+	#include <emmintrin.h>
+#endif
+
+static inline unsigned Bitset_PopCount(uint64_t _word) {
+#if defined(__GNUC__) || defined(__clang__)
+	return (unsigned)__builtin_popcountll(_word);
+#else
+	_word -= (_word >> 1) & 0x5555555555555555ULL;
+	_word = (_word & 0x3333333333333333ULL) + ((_word >> 2) & 0x3333333333333333ULL);
+	_word = (_word + (_word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return (unsigned)((_word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// index of the lowest set bit, _word must not be 0
+static inline unsigned Bitset_CountTrailingZeroes(const uint64_t _word) {
+#if defined(__GNUC__) || defined(__clang__)
+	return (unsigned)__builtin_ctzll(_word);
+#else
+	return Bitset_PopCount((_word & (0 - _word)) - 1);
+#endif
+}
+
+static inline uint64_t Bitset_CombineWord(const uint64_t _destination, const uint64_t _source, const bitset_operation_t _operation) {
+	switch (_operation) {
+	case BITSET_OPERATION_AND: return _destination & _source;
+	case BITSET_OPERATION_OR: return _destination | _source;
+	case BITSET_OPERATION_XOR: return _destination ^ _source;
+	default: return _destination & ~_source;
+	}
+}
+
+// the operation is a constant at every call site, so each call compiles into a loop without branches
+static inline void Bitset_CombineWordsWith(uint64_t* restrict const _destination, const uint64_t* restrict const _source, const size_t _wordCount, const bitset_operation_t _operation) {
+	size_t i = 0;
+#if defined(__AVX2__)
+	for (; (i + 4) <= _wordCount; i += 4) {
+		const __m256i _a = _mm256_loadu_si256((const __m256i*)(_destination + i));
+		const __m256i _b = _mm256_loadu_si256((const __m256i*)(_source + i));
+		__m256i _result;
+		switch (_operation) {
+		case BITSET_OPERATION_AND: _result = _mm256_and_si256(_a, _b); break;
+		case BITSET_OPERATION_OR: _result = _mm256_or_si256(_a, _b); break;
+		case BITSET_OPERATION_XOR: _result = _mm256_xor_si256(_a, _b); break;
+		default: _result = _mm256_andnot_si256(_b, _a); break;
+		}
+		_mm256_storeu_si256((__m256i*)(_destination + i), _result);
+	}
+#elif defined(__SSE2__)
+	for (; (i + 2) <= _wordCount; i += 2) {
+		const __m128i _a = _mm_loadu_si128((const __m128i*)(_destination + i));
+		const __m128i _b = _mm_loadu_si128((const __m128i*)(_source + i));
+		__m128i _result;
+		switch (_operation) {
+		case BITSET_OPERATION_AND: _result = _mm_and_si128(_a, _b); break;
+		case BITSET_OPERATION_OR: _result = _mm_or_si128(_a, _b); break;
+		case BITSET_OPERATION_XOR: _result = _mm_xor_si128(_a, _b); break;
+		default: _result = _mm_andnot_si128(_b, _a); break;
+		}
+		_mm_storeu_si128((__m128i*)(_destination + i), _result);
+	}
+#endif
+	for (; i < _wordCount; i++) {
+		_destination[i] = Bitset_CombineWord(_destination[i], _source[i], _operation);
+	}
+}
+
+// destination[i] = destination[i] (operation) source[i], for every word
+void Bitset_CombineWords(uint64_t* restrict const _destination, const uint64_t* restrict const _source, const size_t _wordCount, const bitset_operation_t _operation) {
+	switch (_operation) {
+	case BITSET_OPERATION_AND: Bitset_CombineWordsWith(_destination, _source, _wordCount, BITSET_OPERATION_AND); break;
+	case BITSET_OPERATION_OR: Bitset_CombineWordsWith(_destination, _source, _wordCount, BITSET_OPERATION_OR); break;
+	case BITSET_OPERATION_XOR: Bitset_CombineWordsWith(_destination, _source, _wordCount, BITSET_OPERATION_XOR); break;
+	case BITSET_OPERATION_ANDNOT: Bitset_CombineWordsWith(_destination, _source, _wordCount, BITSET_OPERATION_ANDNOT); break;
+	}
+}
+
+// Returns the number of set bits of the words
+size_t Bitset_CountWords(const uint64_t* const _words, const size_t _wordCount) {
+	size_t _count = 0;
+	for (size_t i = 0; i < _wordCount; i++) {
+		_count += Bitset_PopCount(_words[i]);
+	}
+	return _count;
+}
+
+// assures that the bitset can hold the number of bits without expanding. Expanding its memory size if necessary
+bool Bitset_SetMinBits(bitset_t* const _object, const size_t _minBitCount) {
+	const size_t _minWordCount = (_minBitCount + (BITSET_WORDBITS - 1)) / BITSET_WORDBITS;
+	if (_minWordCount <= _object->maxWordCount) {
+		return true; // already satisfied
+	}
+	size_t _newWordCount = (size_t)(_object->maxWordCount * _object->expansionRate);
+	if (_newWordCount < _minWordCount) {
+		_newWordCount = _minWordCount;
+	}
+	uint64_t* const _newWords = realloc(_object->words, _newWordCount * sizeof(uint64_t));
+	if (!_newWords) {
+		return false; // insufficient memory
+	}
+	INSTRUMENTATION_REALLOCATION(&_object->instrumentation, _newWordCount * sizeof(uint64_t));
+	INSTRUMENTATION_GROWTH(&_object->instrumentation, _newWordCount * sizeof(uint64_t));
+	memset(_newWords + _object->maxWordCount, 0, (_newWordCount - _object->maxWordCount) * sizeof(uint64_t)); // new bits are cleared
+	_object->words = _newWords;
+	_object->maxWordCount = _newWordCount;
+	return true;
+}
+
+/* Changes the number of valid bits
+ * The added bits are cleared, the removed bits are cleared so that they stay cleared once added back
+ */
+bool Bitset_Resize(bitset_t* const _object, const size_t _bitCount) {
+	if (_bitCount < _object->bitCount) {
+		const size_t _wordCount = Bitset_GetWordCount(_object);
+		size_t _firstClearedWord = _bitCount / BITSET_WORDBITS;
+		if (_bitCount % BITSET_WORDBITS) { // keep the lower bits of the last word
+			_object->words[_firstClearedWord] &= (((uint64_t)1) << (_bitCount % BITSET_WORDBITS)) - 1;
+			_firstClearedWord++;
+		}
+		memset(_object->words + _firstClearedWord, 0, (_wordCount - _firstClearedWord) * sizeof(uint64_t));
+	} else if (!Bitset_SetMinBits(_object, _bitCount)) {
+		return false; // insufficient memory
+	}
+	_object->bitCount = _bitCount;
+	return true;
+}
+
+// Sets the bit at the index, the bitset grows to hold the index if necessary
+bool Bitset_Set(bitset_t* const _object, const size_t _index) {
+	if ((_index >= _object->bitCount) && !Bitset_Resize(_object, _index + 1)) {
+		return false; // insufficient memory
+	}
+	_object->words[_index / BITSET_WORDBITS] |= ((uint64_t)1) << (_index % BITSET_WORDBITS);
+	return true;
+}
+
+// Clears the bit at the index
+void Bitset_Reset(bitset_t* const _object, const size_t _index) {
+	if (_index < _object->bitCount) {
+		_object->words[_index / BITSET_WORDBITS] &= ~(((uint64_t)1) << (_index % BITSET_WORDBITS));
+	}
+}
+
+// Clears every bit, the number of valid bits is kept
+void Bitset_ClearAll(bitset_t* const _object) {
+	memset(_object->words, 0, Bitset_GetWordCount(_object) * sizeof(uint64_t));
+}
+
+// Returns the number of set bits
+size_t Bitset_Count(const bitset_t* const _object) {
+	return Bitset_CountWords(_object->words, Bitset_GetWordCount(_object));
+}
+
+// Returns the number of set bits before the index
+size_t Bitset_Rank(const bitset_t* const _object, const size_t _index) {
+	if (_index >= _object->bitCount) {
+		return Bitset_Count(_object);
+	}
+	const size_t _wordIndex = _index / BITSET_WORDBITS;
+	const uint64_t _lowerBits = _object->words[_wordIndex] & ((((uint64_t)1) << (_index % BITSET_WORDBITS)) - 1);
+	return Bitset_CountWords(_object->words, _wordIndex) + Bitset_PopCount(_lowerBits);
+}
+
+/* Returns the index of the first set bit at or after the index
+ * Returns SIZE_MAX if there's none
+ * Iterating: for (size_t i = Bitset_NextSetBit(bitset, 0); i != SIZE_MAX; i = Bitset_NextSetBit(bitset, i + 1))
+ */
+size_t Bitset_NextSetBit(const bitset_t* const _object, const size_t _index) {
+	if (_index >= _object->bitCount) {
+		return SIZE_MAX;
+	}
+	const size_t _wordCount = Bitset_GetWordCount(_object);
+	size_t _wordIndex = _index / BITSET_WORDBITS;
+	uint64_t _word = _object->words[_wordIndex] & (~((uint64_t)0) << (_index % BITSET_WORDBITS)); // ignore the bits before the index
+	while (!_word) {
+		if (++_wordIndex >= _wordCount) {
+			return SIZE_MAX;
+		}
+		_word = _object->words[_wordIndex];
+	}
+	return (_wordIndex * BITSET_WORDBITS) + Bitset_CountTrailingZeroes(_word);
+}
+
+/* Returns the index of the first cleared bit at or after the index
+ * Returns bitCount or the index, whichever is greater, if every bit after the index is set
+ */
+size_t Bitset_NextClearBit(const bitset_t* const _object, const size_t _index) {
+	if (_index >= _object->bitCount) {
+		return _index;
+	}
+	const size_t _wordCount = Bitset_GetWordCount(_object);
+	size_t _wordIndex = _index / BITSET_WORDBITS;
+	uint64_t _word = ~_object->words[_wordIndex] & (~((uint64_t)0) << (_index % BITSET_WORDBITS)); // ignore the bits before the index
+	while (!_word) {
+		if (++_wordIndex >= _wordCount) {
+			return _object->bitCount;
+		}
+		_word = ~_object->words[_wordIndex];
+	}
+	const size_t _clearedIndex = (_wordIndex * BITSET_WORDBITS) + Bitset_CountTrailingZeroes(_word);
+	return (_clearedIndex < _object->bitCount) ? _clearedIndex : _object->bitCount;
+}
+
+/* destination = destination (operation) source
+ * OR and XOR grow the destination to the source's number of bits. AND clears the destination's bits after the source's bits
+ * Returns false if the destination failed expanding
+ */
+bool Bitset_Combine(bitset_t* restrict const _destination, const bitset_t* restrict const _source, const bitset_operation_t _operation) {
+	if (((_operation == BITSET_OPERATION_OR) || (_operation == BITSET_OPERATION_XOR))
+	&& (_source->bitCount > _destination->bitCount)
+	&& !Bitset_Resize(_destination, _source->bitCount)) {
+		return false; // insufficient memory
+	}
+	const size_t _destinationWordCount = Bitset_GetWordCount(_destination);
+	const size_t _sourceWordCount = Bitset_GetWordCount(_source);
+	const size_t _wordCount = (_sourceWordCount < _destinationWordCount) ? _sourceWordCount : _destinationWordCount;
+	Bitset_CombineWords(_destination->words, _source->words, _wordCount, _operation);
+	if (_operation == BITSET_OPERATION_AND) { // the source's missing bits are cleared bits
+		memset(_destination->words + _wordCount, 0, (_destinationWordCount - _wordCount) * sizeof(uint64_t));
+	}
+	return true;
+}
+
+// Only frees the bitset's buffer
+void Bitset_FreeBuffer(bitset_t* const _object) {
+	free(_object->words);
+	INSTRUMENTATION_FREE(&_object->instrumentation);
+	_object->words = NULL;
+	_object->bitCount = 0;
+	_object->maxWordCount = 0;
+}
+
+/* Frees a Bitset object
+ * CAUTION! Do not pass pointer to a permanent Bitset variable!
+ */
+void Bitset_Free(bitset_t* _object) {
+	Bitset_FreeBuffer(_object);
+	free((void*)_object);
+}
+
+/* Properly initializes the bitset variable, with no valid bits
+ * Allocates memory to the bitset variable if its current value is NULL
+ * Reallocates memory to the bitset's buffer that satisfy the required minimum number of bits
+ */
+bitset_t* Bitset_InitAll(bitset_t* _object, const size_t _minBitCount, const float _expansionRate) {
+	bool _mallocVar;
+	if (!_object) { // if we are requesting to initialize it
+		_object = malloc(sizeof(bitset_t));
+		if (!_object) {
+			return NULL; // failed allocating bitset variable
+		}
+		_object->words = NULL; // indicate buffer requires initialization later
+		_mallocVar = true;
+	} else {
+		_mallocVar = false;
+	}
+	INSTRUMENTATION_RESET(&_object->instrumentation);
+	if (_mallocVar) {
+		INSTRUMENTATION_ALLOCATION(&_object->instrumentation, sizeof(bitset_t));
+	}
+	_object->expansionRate = _expansionRate + 1.0;
+	if (!_object->words) { // buffer isn't initialized yet
+		_object->maxWordCount = (_minBitCount + (BITSET_WORDBITS - 1)) / BITSET_WORDBITS;
+		if (!_object->maxWordCount) {
+			_object->maxWordCount = 1;
+		}
+		_object->words = calloc(_object->maxWordCount, sizeof(uint64_t));
+		if (!_object->words) {
+			if (_mallocVar) {
+				free(_object);
+			}
+			return NULL; // failed allocating buffer to our bitset variable
+		}
+		INSTRUMENTATION_ALLOCATION(&_object->instrumentation, _object->maxWordCount * sizeof(uint64_t));
+	} else {
+		memset(_object->words, 0, _object->maxWordCount * sizeof(uint64_t));
+		if (!Bitset_SetMinBits(_object, _minBitCount)) {
+			if (_mallocVar) {
+				free(_object);
+			}
+			return NULL; // minimum size requrement didn't met
+		}
+	}
+	_object->bitCount = 0;
+	return _object; // initialization sucessful
+}
@@ -0,0 +1,74 @@
+/*
+ * @File: Bitset.h
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Growable array of bits with popcount rank, SIMD logical operations and set bit iteration
+ * @LastUpdate: October 18, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ *
+ * The logical operations process 256 bits per instruction when compiled with AVX2 (-mavx2),
+ * 128 bits with SSE2 (always available on x86-64), and 64 bits otherwise.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "Instrumentation.h"
+
+#define BITSET_DEFAULT_INITIALBITCOUNT 256
+#define BITSET_DEFAULT_EXPANSIONRATE 0.5
+#define BITSET_WORDBITS 64
+
+typedef enum {
+	BITSET_OPERATION_AND,
+	BITSET_OPERATION_OR,
+	BITSET_OPERATION_XOR,
+	BITSET_OPERATION_ANDNOT  // destination & ~source
+} bitset_operation_t;
+
+typedef struct {
+    uint64_t* words;        // the bits, bit i is stored at words[i / 64] bit (i % 64)
+    size_t bitCount;        // how much bits is currently valid, the bits after it are always cleared
+    size_t maxWordCount;    // max number of words
+	float expansionRate;    // how much words is additionally added everytime we expand
+#ifdef DDS_INSTRUMENTATION
+    instrumentation_counters_t instrumentation;
+#endif
+} bitset_t;
+
+void Bitset_CombineWords(uint64_t* restrict const _destination, const uint64_t* restrict const _source, const size_t _wordCount, const bitset_operation_t _operation);
+size_t Bitset_CountWords(const uint64_t* const _words, const size_t _wordCount);
+bool Bitset_SetMinBits(bitset_t* const _object, const size_t _minBitCount);
+bool Bitset_Resize(bitset_t* const _object, const size_t _bitCount);
+bool Bitset_Set(bitset_t* const _object, const size_t _index);
+void Bitset_Reset(bitset_t* const _object, const size_t _index);
+void Bitset_ClearAll(bitset_t* const _object);
+size_t Bitset_Count(const bitset_t* const _object);
+size_t Bitset_Rank(const bitset_t* const _object, const size_t _index);
+size_t Bitset_NextSetBit(const bitset_t* const _object, const size_t _index);
+size_t Bitset_NextClearBit(const bitset_t* const _object, const size_t _index);
+bool Bitset_Combine(bitset_t* restrict const _destination, const bitset_t* restrict const _source, const bitset_operation_t _operation);
+void Bitset_FreeBuffer(bitset_t* const _object);
+void Bitset_Free(bitset_t* _object);
+bitset_t* Bitset_InitAll(bitset_t* _object, const size_t _minBitCount, const float _expansionRate);
+
+#define Bitset_Init(_object) Bitset_InitAll(_object, BITSET_DEFAULT_INITIALBITCOUNT, BITSET_DEFAULT_EXPANSIONRATE)
+#define Bitset_GetWordCount(_object) (((_object)->bitCount + (BITSET_WORDBITS - 1)) / BITSET_WORDBITS)
+#define Bitset_And(_destination, _source) Bitset_Combine(_destination, _source, BITSET_OPERATION_AND)
+#define Bitset_Or(_destination, _source) Bitset_Combine(_destination, _source, BITSET_OPERATION_OR)
+#define Bitset_Xor(_destination, _source) Bitset_Combine(_destination, _source, BITSET_OPERATION_XOR)
+#define Bitset_AndNot(_destination, _source) Bitset_Combine(_destination, _source, BITSET_OPERATION_ANDNOT)
+
+// Checks if the bit at the index is set, the bits after bitCount are never set
+static inline bool Bitset_Test(const bitset_t* const _object, const size_t _index) {
+	return (_index < _object->bitCount) && ((_object->words[_index / BITSET_WORDBITS] >> (_index % BITSET_WORDBITS)) & 1);
+}
@@ -0,0 +1,550 @@
+/*
+ * @File: CompressedBitmap.c
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Compressed set of 32-bit values, stored as sorted arrays or bitmaps per 65536 values (roaring style)
+ * @LastUpdate: October 19, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ */
+
+#include "CompressedBitmap.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define COMPRESSEDBITMAP_HEADERSIZE 8
+#define COMPRESSEDBITMAP_DESCRIPTORSIZE 8
+#define COMPRESSEDBITMAP_BITMAPSIZE (COMPRESSEDBITMAP_BITMAPWORDCOUNT * sizeof(uint64_t))
+
+static inline void CompressedBitmap_WriteUInt(uint8_t* const _destination, uint64_t _value, const size_t _size) {
+	for (size_t i = 0; i < _size; i++, _value >>= 8) {
+		_destination[i] = (uint8_t)_value;
+	}
+}
+
+static inline uint64_t CompressedBitmap_ReadUInt(const uint8_t* const _source, const size_t _size) {
+	uint64_t _value = 0;
+	for (size_t i = _size; i--;) {
+		_value = (_value << 8) | _source[i];
+	}
+	return _value;
+}
+
+/* performs a binarysearch algorithm to find the container of the key
+ * returns true if found, _pickedIndex = the container's index
+ * returns false if not found, _pickedIndex = where the container would be inserted
+ */
+static bool CompressedBitmap_FindContainer(const compressedbitmap_t* restrict const _object, const uint16_t _key, size_t* restrict const _pickedIndex) {
+	const compressedbitmap_container_t* const _containers = _object->containers.array;
+	size_t _left = 0;
+	size_t _right = _object->containers.elementCount;
+	while (_left < _right) {
+		const size_t _middle = _left + ((_right - _left) >> 1); // avoid overflow
+		if (_containers[_middle].key < _key) {
+			_left = _middle + 1;
+		} else {
+			_right = _middle;
+		}
+	}
+	*_pickedIndex = _left;
+	return (_left < _object->containers.elementCount) && (_containers[_left].key == _key);
+}
+
+// returns the index of the first value that is not less than _lowBits
+static size_t CompressedBitmap_LowerBound(const uint16_t* const _values, const size_t _count, const uint16_t _lowBits) {
+	size_t _left = 0;
+	size_t _right = _count;
+	while (_left < _right) {
+		const size_t _middle = _left + ((_right - _left) >> 1); // avoid overflow
+		if (_values[_middle] < _lowBits) {
+			_left = _middle + 1;
+		} else {
+			_right = _middle;
+		}
+	}
+	return _left;
+}
+
+static inline bool CompressedBitmap_ContainerHas(const compressedbitmap_container_t* const _container, const uint16_t _lowBits) {
+	if (_container->type == COMPRESSEDBITMAP_CONTAINER_BITMAP) {
+		return (((const uint64_t*)_container->values)[_lowBits / 64] >> (_lowBits % 64)) & 1;
+	}
+	const size_t _index = CompressedBitmap_LowerBound(_container->values, _container->cardinality, _lowBits);
+	return (_index < _container->cardinality) && (((const uint16_t*)_container->values)[_index] == _lowBits);
+}
+
+// expands the bits of the container into COMPRESSEDBITMAP_BITMAPWORDCOUNT words
+static void CompressedBitmap_ContainerToWords(const compressedbitmap_container_t* restrict const _container, uint64_t* restrict const out_words) {
+	if (_container->type == COMPRESSEDBITMAP_CONTAINER_BITMAP) {
+		memcpy(out_words, _container->values, COMPRESSEDBITMAP_BITMAPSIZE);
+		return;
+	}
+	memset(out_words, 0, COMPRESSEDBITMAP_BITMAPSIZE);
+	const uint16_t* const _values = _container->values;
+	for (uint32_t i = 0; i < _container->cardinality; i++) {
+		out_words[_values[i] / 64] |= ((uint64_t)1) << (_values[i] % 64);
+	}
+}
+
+/* allocates the values of a container holding the set bits of the words, an array if they are few enough
+ * returns false due to insufficient memory
+ */
+static bool CompressedBitmap_ContainerFromWords(
+	compressedbitmap_t* restrict const _object, compressedbitmap_container_t* restrict const out_container,
+	const uint16_t _key, const uint64_t* restrict const _words, const uint32_t _cardinality
+) {
+	(void)_object; // only used by the instrumentation
+	out_container->key = _key;
+	out_container->cardinality = _cardinality;
+	if (_cardinality > COMPRESSEDBITMAP_ARRAYMAXCOUNT) {
+		out_container->values = malloc(COMPRESSEDBITMAP_BITMAPSIZE);
+		if (!out_container->values) {
+			return false; // insufficient memory
+		}
+		INSTRUMENTATION_ALLOCATION(&_object->instrumentation, COMPRESSEDBITMAP_BITMAPSIZE);
+		memcpy(out_container->values, _words, COMPRESSEDBITMAP_BITMAPSIZE);
+		out_container->type = COMPRESSEDBITMAP_CONTAINER_BITMAP;
+		out_container->capacity = 0;
+		return true;
+	}
+	uint16_t* const _values = malloc(_cardinality * sizeof(uint16_t));
+	if (!_values) {
+		return false; // insufficient memory
+	}
+	INSTRUMENTATION_ALLOCATION(&_object->instrumentation, _cardinality * sizeof(uint16_t));
+	const bitset_t _bits = {.words = (uint64_t*)_words, .bitCount = COMPRESSEDBITMAP_BITMAPWORDCOUNT * BITSET_WORDBITS};
+	size_t _count = 0;
+	for (size_t _index = Bitset_NextSetBit(&_bits, 0); _index != SIZE_MAX; _index = Bitset_NextSetBit(&_bits, _index + 1)) {
+		_values[_count++] = (uint16_t)_index;
+	}
+	out_container->values = _values;
+	out_container->type = COMPRESSEDBITMAP_CONTAINER_ARRAY;
+	out_container->capacity = (uint16_t)_cardinality;
+	return true;
+}
+
+static void CompressedBitmap_FreeContainer(compressedbitmap_t* restrict const _object, compressedbitmap_container_t* restrict const _container) {
+	(void)_object; // only used by the instrumentation
+	free(_container->values);
+	INSTRUMENTATION_FREE(&_object->instrumentation);
+	_container->values = NULL;
+}
+
+// Adds the value to the set, returns false if it was not added due to insufficient memory
+bool CompressedBitmap_Add(compressedbitmap_t* const _object, const uint32_t _value) {
+	const uint16_t _key = (uint16_t)(_value >> 16);
+	const uint16_t _lowBits = (uint16_t)_value;
+	size_t _containerIndex;
+	if (!CompressedBitmap_FindContainer(_object, _key, &_containerIndex)) { // first value of its container
+		compressedbitmap_container_t _container = {.cardinality = 1, .capacity = 4, .key = _key, .type = COMPRESSEDBITMAP_CONTAINER_ARRAY};
+		_container.values = malloc(_container.capacity * sizeof(uint16_t));
+		if (!_container.values) {
+			return false; // insufficient memory
+		}
+		INSTRUMENTATION_ALLOCATION(&_object->instrumentation, _container.capacity * sizeof(uint16_t));
+		*(uint16_t*)_container.values = _lowBits;
+		if (!DynamicArray_Insert(&_object->containers, _containerIndex, &_container)) {
+			CompressedBitmap_FreeContainer(_object, &_container);
+			return false; // insufficient memory
+		}
+		return true;
+	}
+	compressedbitmap_container_t* const _container = (compressedbitmap_container_t*)_object->containers.array + _containerIndex;
+	if (_container->type == COMPRESSEDBITMAP_CONTAINER_BITMAP) {
+		uint64_t* const _word = (uint64_t*)_container->values + (_lowBits / 64);
+		const uint64_t _bit = ((uint64_t)1) << (_lowBits % 64);
+		_container->cardinality += !(*_word & _bit);
+		*_word |= _bit;
+		return true;
+	}
+	uint16_t* _values = _container->values;
+	const size_t _index = CompressedBitmap_LowerBound(_values, _container->cardinality, _lowBits);
+	if ((_index < _container->cardinality) && (_values[_index] == _lowBits)) {
+		return true; // already added
+	}
+	if (_container->cardinality == COMPRESSEDBITMAP_ARRAYMAXCOUNT) { // becomes a bitmap
+		uint64_t* const _words = malloc(COMPRESSEDBITMAP_BITMAPSIZE);
+		if (!_words) {
+			return false; // insufficient memory
+		}
+		INSTRUMENTATION_ALLOCATION(&_object->instrumentation, COMPRESSEDBITMAP_BITMAPSIZE);
+		CompressedBitmap_ContainerToWords(_container, _words);
+		_words[_lowBits / 64] |= ((uint64_t)1) << (_lowBits % 64);
+		CompressedBitmap_FreeContainer(_object, _container);
+		_container->values = _words;
+		_container->type = COMPRESSEDBITMAP_CONTAINER_BITMAP;
+		_container->capacity = 0;
+		_container->cardinality++;
+		return true;
+	}
+	if (_container->cardinality == _container->capacity) { // array is full
+		size_t _newCapacity = (size_t)_container->capacity * 2;
+		if (_newCapacity > COMPRESSEDBITMAP_ARRAYMAXCOUNT) {
+			_newCapacity = COMPRESSEDBITMAP_ARRAYMAXCOUNT;
+		}
+		_values = realloc(_values, _newCapacity * sizeof(uint16_t));
+		if (!_values) {
+			return false; // insufficient memory
+		}
+		INSTRUMENTATION_REALLOCATION(&_object->instrumentation, _newCapacity * sizeof(uint16_t));
+		INSTRUMENTATION_GROWTH(&_object->instrumentation, _newCapacity * sizeof(uint16_t));
+		_container->values = _values;
+		_container->capacity = (uint16_t)_newCapacity;
+	}
+	memmove(_values + _index + 1, _values + _index, (_container->cardinality - _index) * sizeof(uint16_t));
+	INSTRUMENTATION_MOVE(&_object->instrumentation, (_container->cardinality - _index) * sizeof(uint16_t));
+	_values[_index] = _lowBits;
+	_container->cardinality++;
+	return true;
+}
+
+// Removes the value from the set, returns false if the set doesn't have the value
+bool CompressedBitmap_Remove(compressedbitmap_t* const _object, const uint32_t _value) {
+	const uint16_t _lowBits = (uint16_t)_value;
+	size_t _containerIndex;
+	if (!CompressedBitmap_FindContainer(_object, (uint16_t)(_value >> 16), &_containerIndex)) {
+		return false; // no container
+	}
+	compressedbitmap_container_t* const _container = (compressedbitmap_container_t*)_object->containers.array + _containerIndex;
+	if (_container->type == COMPRESSEDBITMAP_CONTAINER_BITMAP) {
+		uint64_t* const _word = (uint64_t*)_container->values + (_lowBits / 64);
+		const uint64_t _bit = ((uint64_t)1) << (_lowBits % 64);
+		if (!(*_word & _bit)) {
+			return false; // not found
+		}
+		*_word &= ~_bit;
+		_container->cardinality--;
+		if (_container->cardinality <= COMPRESSEDBITMAP_ARRAYMAXCOUNT) { // becomes an array
+			compressedbitmap_container_t _array;
+			if (CompressedBitmap_ContainerFromWords(_object, &_array, _container->key, _container->values, _container->cardinality)) {
+				CompressedBitmap_FreeContainer(_object, _container);
+				*_container = _array;
+			} // else it stays a valid bitmap
+		}
+		return true;
+	}
+	uint16_t* const _values = _container->values;
+	const size_t _index = CompressedBitmap_LowerBound(_values, _container->cardinality, _lowBits);
+	if ((_index >= _container->cardinality) || (_values[_index] != _lowBits)) {
+		return false; // not found
+	}
+	_container->cardinality--;
+	if (!_container->cardinality) { // container is empty
+		CompressedBitmap_FreeContainer(_object, _container);
+		DynamicArray_Delete(&_object->containers, _containerIndex);
+		return true;
+	}
+	memmove(_values + _index, _values + _index + 1, (_container->cardinality - _index) * sizeof(uint16_t));
+	INSTRUMENTATION_MOVE(&_object->instrumentation, (_container->cardinality - _index) * sizeof(uint16_t));
+	return true;
+}
+
+// Checks if the set has the value
+bool CompressedBitmap_Contains(const compressedbitmap_t* const _object, const uint32_t _value) {
+	size_t _containerIndex;
+	return CompressedBitmap_FindContainer(_object, (uint16_t)(_value >> 16), &_containerIndex)
+		&& CompressedBitmap_ContainerHas((const compressedbitmap_container_t*)_object->containers.array + _containerIndex, (uint16_t)_value);
+}
+
+// Returns the number of values inside the set
+uint64_t CompressedBitmap_GetCardinality(const compressedbitmap_t* const _object) {
+	const compressedbitmap_container_t* const _containers = _object->containers.array;
+	uint64_t _cardinality = 0;
+	for (size_t i = 0; i < _object->containers.elementCount; i++) {
+		_cardinality += _containers[i].cardinality;
+	}
+	return _cardinality;
+}
+
+// Returns the number of values inside the set that are less than the value
+uint64_t CompressedBitmap_Rank(const compressedbitmap_t* const _object, const uint32_t _value) {
+	const compressedbitmap_container_t* const _containers = _object->containers.array;
+	const uint16_t _lowBits = (uint16_t)_value;
+	size_t _containerIndex;
+	const bool _isFound = CompressedBitmap_FindContainer(_object, (uint16_t)(_value >> 16), &_containerIndex);
+	uint64_t _rank = 0;
+	for (size_t i = 0; i < _containerIndex; i++) {
+		_rank += _containers[i].cardinality;
+	}
+	if (_isFound) {
+		const compressedbitmap_container_t* const _container = &_containers[_containerIndex];
+		if (_container->type == COMPRESSEDBITMAP_CONTAINER_BITMAP) {
+			const uint64_t* const _words = _container->values;
+			_rank += Bitset_CountWords(_words, _lowBits / 64);
+			const uint64_t _lowerBits = _words[_lowBits / 64] & ((((uint64_t)1) << (_lowBits % 64)) - 1);
+			_rank += Bitset_CountWords(&_lowerBits, 1);
+		} else {
+			_rank += CompressedBitmap_LowerBound(_container->values, _container->cardinality, _lowBits);
+		}
+	}
+	return _rank;
+}
+
+/* Finds the smallest value of the set that is not less than the value
+ * Returns false if there's none
+ * Iterating: for (bool _hasValue = CompressedBitmap_NextValue(set, 0, &v); _hasValue; _hasValue = (v != UINT32_MAX) && CompressedBitmap_NextValue(set, v + 1, &v))
+ */
+bool CompressedBitmap_NextValue(const compressedbitmap_t* restrict const _object, const uint32_t _value, uint32_t* restrict const out_value) {
+	const compressedbitmap_container_t* const _containers = _object->containers.array;
+	size_t _containerIndex;
+	uint32_t _lowBits = 0; // lowest value accepted from the container
+	if (CompressedBitmap_FindContainer(_object, (uint16_t)(_value >> 16), &_containerIndex)) {
+		_lowBits = (uint16_t)_value;
+	}
+	for (; _containerIndex < _object->containers.elementCount; _containerIndex++, _lowBits = 0) {
+		const compressedbitmap_container_t* const _container = &_containers[_containerIndex];
+		if (_container->type == COMPRESSEDBITMAP_CONTAINER_BITMAP) {
+			const bitset_t _bits = {.words = _container->values, .bitCount = COMPRESSEDBITMAP_BITMAPWORDCOUNT * BITSET_WORDBITS};
+			const size_t _index = Bitset_NextSetBit(&_bits, _lowBits);
+			if (_index != SIZE_MAX) {
+				*out_value = ((uint32_t)_container->key << 16) | (uint32_t)_index;
+				return true;
+			}
+		} else {
+			const uint16_t* const _values = _container->values;
+			const size_t _index = CompressedBitmap_LowerBound(_values, _container->cardinality, (uint16_t)_lowBits);
+			if (_index < _container->cardinality) {
+				*out_value = ((uint32_t)_container->key << 16) | _values[_index];
+				return true;
+			}
+		}
+	}
+	return false; // no value left
+}
+
+/* destination = destination (operation) source
+ * Returns false due to insufficient memory, the destination is left unchanged
+ */
+bool CompressedBitmap_Combine(compressedbitmap_t* restrict const _destination, const compressedbitmap_t* restrict const _source, const bitset_operation_t _operation) {
+	const compressedbitmap_container_t* const _destinationContainers = _destination->containers.array;
+	const compressedbitmap_container_t* const _sourceContainers = _source->containers.array;
+	const size_t _destinationCount = _destination->containers.elementCount;
+	const size_t _sourceCount = _source->containers.elementCount;
+	const bool _keepsDestinationOnly = (_operation != BITSET_OPERATION_AND);
+	const bool _keepsSourceOnly = (_operation == BITSET_OPERATION_OR) || (_operation == BITSET_OPERATION_XOR);
+	dynamicarray_t _result = {0};
+	if (!DynamicArray_InitAll(&_result, sizeof(compressedbitmap_container_t), _destinationCount + _sourceCount + 1, _object_DEFAULT_EXPANSIONRATE)) {
+		return false; // insufficient memory
+	}
+	// the result shares the values of the destination only containers, every other container of the result is new
+	uint64_t _words[COMPRESSEDBITMAP_BITMAPWORDCOUNT];
+	uint64_t _sourceWords[COMPRESSEDBITMAP_BITMAPWORDCOUNT];
+	size_t i = 0, j = 0;
+	bool _isCombined = true;
+	while (_isCombined && ((i < _destinationCount) || (j < _sourceCount))) {
+		compressedbitmap_container_t _container;
+		if ((j >= _sourceCount) || ((i < _destinationCount) && (_destinationContainers[i].key < _sourceContainers[j].key))) { // destination only
+			if (_keepsDestinationOnly) {
+				DynamicArray_Push(&_result, &_destinationContainers[i]);
+			}
+			i++;
+		} else if ((i >= _destinationCount) || (_sourceContainers[j].key < _destinationContainers[i].key)) { // source only
+			if (_keepsSourceOnly) {
+				CompressedBitmap_ContainerToWords(&_sourceContainers[j], _words);
+				_isCombined = CompressedBitmap_ContainerFromWords(_destination, &_container, _sourceContainers[j].key, _words, _sourceContainers[j].cardinality);
+				if (_isCombined) {
+					DynamicArray_Push(&_result, &_container);
+				}
+			}
+			j++;
+		} else { // both
+			CompressedBitmap_ContainerToWords(&_destinationContainers[i], _words);
+			CompressedBitmap_ContainerToWords(&_sourceContainers[j], _sourceWords);
+			Bitset_CombineWords(_words, _sourceWords, COMPRESSEDBITMAP_BITMAPWORDCOUNT, _operation);
+			const uint32_t _cardinality = (uint32_t)Bitset_CountWords(_words, COMPRESSEDBITMAP_BITMAPWORDCOUNT);
+			if (_cardinality) {
+				_isCombined = CompressedBitmap_ContainerFromWords(_destination, &_container, _destinationContainers[i].key, _words, _cardinality);
+				if (_isCombined) {
+					DynamicArray_Push(&_result, &_container);
+				}
+			}
+			i++;
+			j++;
+		}
+	}
+	compressedbitmap_container_t* const _resultContainers = _result.array;
+	size_t _sourceIndex;
+	if (!_isCombined) { // free the new containers of the result
+		for (size_t k = 0; k < _result.elementCount; k++) {
+			if (CompressedBitmap_FindContainer(_source, _resultContainers[k].key, &_sourceIndex)) {
+				CompressedBitmap_FreeContainer(_destination, &_resultContainers[k]);
+			}
+		}
+		DynamicArray_FreeBuffer(&_result);
+		return false; // insufficient memory
+	}
+	// free the destination containers that the result doesn't share
+	compressedbitmap_container_t* const _oldContainers = _destination->containers.array;
+	for (size_t k = 0; k < _destinationCount; k++) {
+		if (!_keepsDestinationOnly || CompressedBitmap_FindContainer(_source, _oldContainers[k].key, &_sourceIndex)) {
+			CompressedBitmap_FreeContainer(_destination, &_oldContainers[k]);
+		}
+	}
+	DynamicArray_FreeBuffer(&_destination->containers);
+	_destination->containers = _result;
+	return true;
+}
+
+// Returns the number of bytes written by CompressedBitmap_Serialize
+size_t CompressedBitmap_GetSerializedSize(const compressedbitmap_t* const _object) {
+	const compressedbitmap_container_t* const _containers = _object->containers.array;
+	size_t _size = COMPRESSEDBITMAP_HEADERSIZE + (_object->containers.elementCount * COMPRESSEDBITMAP_DESCRIPTORSIZE);
+	for (size_t i = 0; i < _object->containers.elementCount; i++) {
+		_size += (_containers[i].type == COMPRESSEDBITMAP_CONTAINER_BITMAP) ? COMPRESSEDBITMAP_BITMAPSIZE : (_containers[i].cardinality * sizeof(uint16_t));
+	}
+	return _size;
+}
+
+/* Writes the set at the write offset of the BinaryBuilder
+ * Returns an offset to where the set got written
+ * Returns UINTPTR_MAX if the BinaryBuilder failed expanding
+ */
+uintptr_t CompressedBitmap_Serialize(const compressedbitmap_t* restrict const _object, binarybuilder_t* restrict const _binaryBuilder) {
+	const compressedbitmap_container_t* const _containers = _object->containers.array;
+	const size_t _size = CompressedBitmap_GetSerializedSize(_object);
+	const uintptr_t _offset = BinaryBuilder_SetBytes(_binaryBuilder, NULL, _size); // reserve the bytes
+	if (_offset == UINTPTR_MAX) {
+		return UINTPTR_MAX; // insufficient memory
+	}
+	uint8_t* _writePtr = (uint8_t*)_binaryBuilder->data + _offset;
+	CompressedBitmap_WriteUInt(_writePtr, COMPRESSEDBITMAP_SERIALCOOKIE, sizeof(uint32_t));
+	CompressedBitmap_WriteUInt(_writePtr + 4, _object->containers.elementCount, sizeof(uint32_t));
+	_writePtr += COMPRESSEDBITMAP_HEADERSIZE;
+	for (size_t i = 0; i < _object->containers.elementCount; i++, _writePtr += COMPRESSEDBITMAP_DESCRIPTORSIZE) {
+		CompressedBitmap_WriteUInt(_writePtr, _containers[i].key, sizeof(uint16_t));
+		_writePtr[2] = _containers[i].type;
+		_writePtr[3] = 0;
+		CompressedBitmap_WriteUInt(_writePtr + 4, _containers[i].cardinality, sizeof(uint32_t));
+	}
+	for (size_t i = 0; i < _object->containers.elementCount; i++) {
+		if (_containers[i].type == COMPRESSEDBITMAP_CONTAINER_BITMAP) {
+			const uint64_t* const _words = _containers[i].values;
+			for (size_t k = 0; k < COMPRESSEDBITMAP_BITMAPWORDCOUNT; k++, _writePtr += sizeof(uint64_t)) {
+				CompressedBitmap_WriteUInt(_writePtr, _words[k], sizeof(uint64_t));
+			}
+		} else {
+			const uint16_t* const _values = _containers[i].values;
+			for (size_t k = 0; k < _containers[i].cardinality; k++, _writePtr += sizeof(uint16_t)) {
+				CompressedBitmap_WriteUInt(_writePtr, _values[k], sizeof(uint16_t));
+			}
+		}
+	}
+	return _offset;
+}
+
+/* Replaces the values of the set with a set written by CompressedBitmap_Serialize
+ * Returns the number of bytes read
+ * Returns 0 if the data is malformed or truncated, or due to insufficient memory. The set is left empty
+ */
+size_t CompressedBitmap_Deserialize(compressedbitmap_t* restrict const _object, const void* restrict const _data, const size_t _size) {
+	const uint8_t* const _bytes = _data;
+	CompressedBitmap_Clear(_object);
+	if ((_size < COMPRESSEDBITMAP_HEADERSIZE)
+	|| (CompressedBitmap_ReadUInt(_bytes, sizeof(uint32_t)) != COMPRESSEDBITMAP_SERIALCOOKIE)) {
+		return 0; // not a serialized set
+	}
+	const size_t _containerCount = (size_t)CompressedBitmap_ReadUInt(_bytes + 4, sizeof(uint32_t));
+	if ((_containerCount > 65536)
+	|| ((_size - COMPRESSEDBITMAP_HEADERSIZE) / COMPRESSEDBITMAP_DESCRIPTORSIZE < _containerCount)
+	|| !DynamicArray_ReserveElements(&_object->containers, _containerCount)) {
+		return 0; // truncated, or insufficient memory
+	}
+	const uint8_t* _descriptor = _bytes + COMPRESSEDBITMAP_HEADERSIZE;
+	size_t _offset = COMPRESSEDBITMAP_HEADERSIZE + (_containerCount * COMPRESSEDBITMAP_DESCRIPTORSIZE);
+	uint64_t _words[COMPRESSEDBITMAP_BITMAPWORDCOUNT];
+	for (size_t i = 0; i < _containerCount; i++, _descriptor += COMPRESSEDBITMAP_DESCRIPTORSIZE) {
+		const uint16_t _key = (uint16_t)CompressedBitmap_ReadUInt(_descriptor, sizeof(uint16_t));
+		const uint8_t _type = _descriptor[2];
+		const uint32_t _cardinality = (uint32_t)CompressedBitmap_ReadUInt(_descriptor + 4, sizeof(uint32_t));
+		const size_t _payloadSize = (_type == COMPRESSEDBITMAP_CONTAINER_BITMAP) ? COMPRESSEDBITMAP_BITMAPSIZE : (_cardinality * sizeof(uint16_t));
+		if ((i && (_key <= ((compressedbitmap_container_t*)_object->containers.array)[i - 1].key)) // keys must be increasing
+		|| (_type > COMPRESSEDBITMAP_CONTAINER_BITMAP)
+		|| !_cardinality || (_cardinality > 65536)
+		|| ((_type == COMPRESSEDBITMAP_CONTAINER_ARRAY) && (_cardinality > COMPRESSEDBITMAP_ARRAYMAXCOUNT))
+		|| (_payloadSize > (_size - _offset))) {
+			CompressedBitmap_Clear(_object);
+			return 0; // malformed or truncated
+		}
+		const uint8_t* const _payload = _bytes + _offset;
+		bool _isValid = true;
+		if (_type == COMPRESSEDBITMAP_CONTAINER_BITMAP) {
+			for (size_t k = 0; k < COMPRESSEDBITMAP_BITMAPWORDCOUNT; k++) {
+				_words[k] = CompressedBitmap_ReadUInt(_payload + (k * sizeof(uint64_t)), sizeof(uint64_t));
+			}
+			_isValid = (Bitset_CountWords(_words, COMPRESSEDBITMAP_BITMAPWORDCOUNT) == _cardinality);
+		} else {
+			memset(_words, 0, sizeof(_words));
+			for (size_t k = 0, _previous = 0; _isValid && (k < _cardinality); k++) {
+				const uint16_t _lowBits = (uint16_t)CompressedBitmap_ReadUInt(_payload + (k * sizeof(uint16_t)), sizeof(uint16_t));
+				_isValid = !k || (_lowBits > _previous); // values must be increasing
+				_words[_lowBits / 64] |= ((uint64_t)1) << (_lowBits % 64);
+				_previous = _lowBits;
+			}
+		}
+		compressedbitmap_container_t _container;
+		if (!_isValid || !CompressedBitmap_ContainerFromWords(_object, &_container, _key, _words, _cardinality)) {
+			CompressedBitmap_Clear(_object);
+			return 0; // malformed, or insufficient memory
+		}
+		DynamicArray_Push(&_object->containers, &_container); // already reserved
+		_offset += _payloadSize;
+	}
+	return _offset;
+}
+
+// Removes every value of the set
+void CompressedBitmap_Clear(compressedbitmap_t* const _object) {
+	compressedbitmap_container_t* const _containers = _object->containers.array;
+	for (size_t i = 0; i < _object->containers.elementCount; i++) {
+		CompressedBitmap_FreeContainer(_object, &_containers[i]);
+	}
+	DynamicArray_Clear(&_object->containers);
+}
+
+void CompressedBitmap_FreeStorage(compressedbitmap_t* const _object) {
+	CompressedBitmap_Clear(_object);
+	DynamicArray_FreeBuffer(&_object->containers);
+}
+
+/* Frees a CompressedBitmap object
+ * CAUTION! Do not pass pointer to a permanent CompressedBitmap variable!
+ */
+void CompressedBitmap_Free(compressedbitmap_t* _object) {
+	CompressedBitmap_FreeStorage(_object);
+	free((void*)_object);
+}
+
+/* Properly initializes the CompressedBitmap variable as an empty set, discarding its previous values
+ * Allocates memory to the CompressedBitmap variable if its current value is NULL
+ * A permanent variable must have its containers.array set to NULL, or be already initialized
+ */
+compressedbitmap_t* CompressedBitmap_Init(compressedbitmap_t* _object) {
+	bool _mallocVar;
+	if (!_object) { // if we are requesting to initialize it
+		_object = malloc(sizeof(compressedbitmap_t));
+		if (!_object) {
+			return NULL; // failed allocating compressedbitmap variable
+		}
+		_object->containers.array = NULL; // indicate buffer requires initialization later
+		_mallocVar = true;
+	} else {
+		if (_object->containers.array) { // already initialized, its containers' values must not leak
+			CompressedBitmap_Clear(_object);
+		}
+		_mallocVar = false;
+	}
+	INSTRUMENTATION_RESET(&_object->instrumentation);
+	if (!DynamicArray_InitAll(&_object->containers, sizeof(compressedbitmap_container_t), COMPRESSEDBITMAP_DEFAULT_INITIALCOUNT, _object_DEFAULT_EXPANSIONRATE)) {
+		if (_mallocVar) {
+			free(_object);
+		}
+		return NULL; // insufficient memory
+	}
+	return _object; // initialization sucessful
+}
@@ -0,0 +1,81 @@
+/*
+ * @File: CompressedBitmap.h
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Compressed set of 32-bit values, stored as sorted arrays or bitmaps per 65536 values (roaring style)
+ * @LastUpdate: October 18, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ *
+ * Link CompressedBitmap.c, Bitset.c, DynamicArray.c and BinaryBuilder.c.
+ *
+ * The values are grouped by their upper 16 bits into containers, each holding the lower 16 bits of its values:
+ * up to COMPRESSEDBITMAP_ARRAYMAXCOUNT values as a sorted uint16_t array, more than that as a 65536 bit bitmap.
+ * Both take at most 8KB, so sparse sets cost 2 bytes per value and dense sets 1 bit per value.
+ *
+ * Serialized layout, integers are little endian:
+ *   uint32_t COMPRESSEDBITMAP_SERIALCOOKIE, uint32_t containerCount
+ *   per container: uint16_t key, uint8_t type, uint8_t 0, uint32_t cardinality
+ *   per container: cardinality uint16_t values (array), or COMPRESSEDBITMAP_BITMAPWORDCOUNT uint64_t words (bitmap)
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "Bitset.h"
+#include "BinaryBuilder.h"
+#include "DynamicArray.h"
+#include "Instrumentation.h"
+
+#define COMPRESSEDBITMAP_ARRAYMAXCOUNT 4096        // an array container holding more values becomes a bitmap container
+#define COMPRESSEDBITMAP_BITMAPWORDCOUNT 1024      // 65536 bits
+#define COMPRESSEDBITMAP_SERIALCOOKIE 0x4D42434CU  // "LCBM"
+#define COMPRESSEDBITMAP_DEFAULT_INITIALCOUNT 8
+
+typedef enum {
+	COMPRESSEDBITMAP_CONTAINER_ARRAY,
+	COMPRESSEDBITMAP_CONTAINER_BITMAP
+} compressedbitmap_containertype_t;
+
+typedef struct {
+    void* values;           // sorted uint16_t array, or COMPRESSEDBITMAP_BITMAPWORDCOUNT uint64_t words
+    uint32_t cardinality;   // number of values inside the container, never 0
+    uint16_t capacity;      // max number of values of an array container
+    uint16_t key;           // upper 16 bits of every value inside the container
+    uint8_t type;           // compressedbitmap_containertype_t
+} compressedbitmap_container_t;
+
+typedef struct {
+    dynamicarray_t containers;  // compressedbitmap_container_t sorted by key
+#ifdef DDS_INSTRUMENTATION
+    instrumentation_counters_t instrumentation; // allocations of the containers' values
+#endif
+} compressedbitmap_t;
+
+bool CompressedBitmap_Add(compressedbitmap_t* const _object, const uint32_t _value);
+bool CompressedBitmap_Remove(compressedbitmap_t* const _object, const uint32_t _value);
+bool CompressedBitmap_Contains(const compressedbitmap_t* const _object, const uint32_t _value);
+uint64_t CompressedBitmap_GetCardinality(const compressedbitmap_t* const _object);
+uint64_t CompressedBitmap_Rank(const compressedbitmap_t* const _object, const uint32_t _value);
+bool CompressedBitmap_NextValue(const compressedbitmap_t* restrict const _object, const uint32_t _value, uint32_t* restrict const out_value);
+bool CompressedBitmap_Combine(compressedbitmap_t* restrict const _destination, const compressedbitmap_t* restrict const _source, const bitset_operation_t _operation);
+size_t CompressedBitmap_GetSerializedSize(const compressedbitmap_t* const _object);
+uintptr_t CompressedBitmap_Serialize(const compressedbitmap_t* restrict const _object, binarybuilder_t* restrict const _binaryBuilder);
+size_t CompressedBitmap_Deserialize(compressedbitmap_t* restrict const _object, const void* restrict const _data, const size_t _size);
+void CompressedBitmap_Clear(compressedbitmap_t* const _object);
+void CompressedBitmap_FreeStorage(compressedbitmap_t* const _object);
+void CompressedBitmap_Free(compressedbitmap_t* _object);
+compressedbitmap_t* CompressedBitmap_Init(compressedbitmap_t* _object);
+
+#define CompressedBitmap_And(_destination, _source) CompressedBitmap_Combine(_destination, _source, BITSET_OPERATION_AND)
+#define CompressedBitmap_Or(_destination, _source) CompressedBitmap_Combine(_destination, _source, BITSET_OPERATION_OR)
+#define CompressedBitmap_Xor(_destination, _source) CompressedBitmap_Combine(_destination, _source, BITSET_OPERATION_XOR)
+#define CompressedBitmap_AndNot(_destination, _source) CompressedBitmap_Combine(_destination, _source, BITSET_OPERATION_ANDNOT)
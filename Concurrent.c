@@ -0,0 +1,643 @@
+/*
+ * @File: Concurrent.c
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Thread-safe wrappers of the Dictionary, DynamicArray, DynamicStringArray and SinglyLinkedList
+ * @LastUpdate: October 18, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ */
+
+#include "Concurrent.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// ---------------------------------------------------------------- Dictionary
+
+// Frees the dictionary's storage and the lock. No thread must be using the dictionary
+void ConcurrentDictionary_FreeStorage(concurrentdictionary_t* const _object) {
+	Dictionary_Free_Storage(&_object->dictionary);
+	RWLock_Destroy(&_object->lock);
+}
+
+/* Frees a ConcurrentDictionary object
+ * CAUTION! Do not pass pointer to a permanent ConcurrentDictionary variable!
+ */
+void ConcurrentDictionary_Free(concurrentdictionary_t* _object) {
+	ConcurrentDictionary_FreeStorage(_object);
+	free((void*)_object);
+}
+
+/* Sets the data of a key, the key is created if it doesn't exist
+ * _data = NULL fills the data block with zeroes
+ * Returns false if the entry was not set due to insufficient memory
+ */
+bool ConcurrentDictionary_Set(
+	concurrentdictionary_t* restrict const _object,
+	const void* restrict const _key, const size_t _keySize,
+	const void* restrict const _data, const size_t _dataSize
+) {
+	RWLock_WriteLock(&_object->lock);
+	const bool _isSet = Dictionary_Set(&_object->dictionary, _key, _keySize, _data, _dataSize);
+	RWLock_WriteUnlock(&_object->lock);
+	return _isSet;
+}
+
+/* Sets every pair while holding the lock once
+ * Returns the number of pairs set, it is less than _pairCount if a pair was not set due to insufficient memory
+ */
+size_t ConcurrentDictionary_SetBatch(concurrentdictionary_t* restrict const _object, const concurrentdictionary_pair_t* restrict const _pairs, const size_t _pairCount) {
+	RWLock_WriteLock(&_object->lock);
+	size_t i = 0;
+	if (Dictionary_ReserveElements(&_object->dictionary, _pairCount)) { // avoid expanding the entries more than once
+		for (; i < _pairCount; i++) {
+			if (!Dictionary_Set(&_object->dictionary, _pairs[i].key, _pairs[i].keySize, _pairs[i].data, _pairs[i].dataSize)) {
+				break; // insufficient memory
+			}
+		}
+	}
+	RWLock_WriteUnlock(&_object->lock);
+	return i;
+}
+
+/* Copies up to _maxDataSize bytes of the key's data into out_data
+ * Returns the size of the key's data, it may be larger than _maxDataSize
+ * Returns SIZE_MAX if the key doesn't exist
+ */
+size_t ConcurrentDictionary_Get(
+	concurrentdictionary_t* restrict const _object,
+	const void* restrict const _key, const size_t _keySize,
+	void* restrict const out_data, const size_t _maxDataSize
+) {
+	RWLock_ReadLock(&_object->lock);
+	size_t _dataSize = SIZE_MAX;
+	const dictionary_entry_t* const _entry = Dictionary_Get_Entry(&_object->dictionary, _key, _keySize);
+	if (_entry) {
+		_dataSize = _entry->dataSize;
+		memcpy(out_data, _entry->data, (_dataSize < _maxDataSize) ? _dataSize : _maxDataSize);
+	}
+	RWLock_ReadUnlock(&_object->lock);
+	return _dataSize;
+}
+
+/* Searches every key while holding the lock once
+ * VisitorFunction receives the entry of each key (NULL if the key doesn't exist), the index of the key, and the context
+ * The entry is only valid until VisitorFunction returns, and must not be modified
+ * Returns the number of keys found
+ */
+size_t ConcurrentDictionary_GetBatch(
+	concurrentdictionary_t* restrict const _object,
+	const concurrentdictionary_pair_t* restrict const _keys, const size_t _keyCount,
+	void (*VisitorFunction)(const dictionary_entry_t*, size_t, void*), void* const _context
+) {
+	size_t _foundCount = 0;
+	RWLock_ReadLock(&_object->lock);
+	for (size_t i = 0; i < _keyCount; i++) {
+		const dictionary_entry_t* const _entry = Dictionary_Get_Entry(&_object->dictionary, _keys[i].key, _keys[i].keySize);
+		_foundCount += (_entry != NULL);
+		(*VisitorFunction)(_entry, i, _context);
+	}
+	RWLock_ReadUnlock(&_object->lock);
+	return _foundCount;
+}
+
+bool ConcurrentDictionary_HasKey(concurrentdictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize) {
+	RWLock_ReadLock(&_object->lock);
+	const bool _hasKey = Dictionary_Has_Key(&_object->dictionary, _key, _keySize);
+	RWLock_ReadUnlock(&_object->lock);
+	return _hasKey;
+}
+
+bool ConcurrentDictionary_DeleteKey(concurrentdictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize) {
+	RWLock_WriteLock(&_object->lock);
+	const bool _isDeleted = Dictionary_DeleteKey(&_object->dictionary, _key, _keySize);
+	RWLock_WriteUnlock(&_object->lock);
+	return _isDeleted;
+}
+
+size_t ConcurrentDictionary_GetCount(concurrentdictionary_t* const _object) {
+	RWLock_ReadLock(&_object->lock);
+	const size_t _count = _object->dictionary.elementCount;
+	RWLock_ReadUnlock(&_object->lock);
+	return _count;
+}
+
+// Shares the lock with the other readers and returns the dictionary, which must not be modified until ReadUnlock
+const dictionary_t* ConcurrentDictionary_ReadLock(concurrentdictionary_t* const _object) {
+	RWLock_ReadLock(&_object->lock);
+	return &_object->dictionary;
+}
+
+void ConcurrentDictionary_ReadUnlock(concurrentdictionary_t* const _object) {
+	RWLock_ReadUnlock(&_object->lock);
+}
+
+// Owns the lock and returns the dictionary, which can be freely used until WriteUnlock
+dictionary_t* ConcurrentDictionary_WriteLock(concurrentdictionary_t* const _object) {
+	RWLock_WriteLock(&_object->lock);
+	return &_object->dictionary;
+}
+
+void ConcurrentDictionary_WriteUnlock(concurrentdictionary_t* const _object) {
+	RWLock_WriteUnlock(&_object->lock);
+}
+
+/* Properly initializes the ConcurrentDictionary variable, discarding its previous contents
+ * Allocates memory to the ConcurrentDictionary variable if its current value is NULL
+ * A permanent variable must be zero filled or already initialized
+ */
+concurrentdictionary_t* ConcurrentDictionary_InitWithMinSize(concurrentdictionary_t* _object, const size_t _minCount, const float _expansionRate) {
+	bool _mallocVar;
+	if (!_object) { // if we are requesting to initialize it
+		_object = malloc(sizeof(concurrentdictionary_t));
+		if (!_object) {
+			return NULL; // failed allocating concurrentdictionary variable
+		}
+		_mallocVar = true;
+	} else {
+		if (_object->dictionary.entries) { // already initialized, its contents and lock must not leak
+			ConcurrentDictionary_FreeStorage(_object);
+		}
+		_mallocVar = false;
+	}
+	memset(&_object->dictionary, 0, sizeof(dictionary_t));
+	if (!RWLock_Init(&_object->lock)) {
+		if (_mallocVar) {
+			free(_object);
+		}
+		return NULL; // failed initializing the lock
+	}
+	if (!Dictionary_InitWithMinSize(&_object->dictionary, _minCount, _expansionRate)) {
+		RWLock_Destroy(&_object->lock);
+		if (_mallocVar) {
+			free(_object);
+		}
+		return NULL; // insufficient memory
+	}
+	return _object; // initialization sucessful
+}
+
+// ---------------------------------------------------------------- DynamicArray
+
+// Frees the array's buffer and the lock. No thread must be using the array
+void ConcurrentDynamicArray_FreeStorage(concurrentdynamicarray_t* const _object) {
+	DynamicArray_FreeBuffer(&_object->array);
+	RWLock_Destroy(&_object->lock);
+}
+
+/* Frees a ConcurrentDynamicArray object
+ * CAUTION! Do not pass pointer to a permanent ConcurrentDynamicArray variable!
+ */
+void ConcurrentDynamicArray_Free(concurrentdynamicarray_t* _object) {
+	ConcurrentDynamicArray_FreeStorage(_object);
+	free((void*)_object);
+}
+
+bool ConcurrentDynamicArray_Push(concurrentdynamicarray_t* restrict const _object, const void* restrict const _value) {
+	RWLock_WriteLock(&_object->lock);
+	const bool _isPushed = DynamicArray_Push(&_object->array, _value);
+	RWLock_WriteUnlock(&_object->lock);
+	return _isPushed;
+}
+
+/* Pushes _valueCount contiguous elements while holding the lock once
+ * Returns false if none of the elements were pushed due to insufficient memory
+ */
+bool ConcurrentDynamicArray_PushBatch(concurrentdynamicarray_t* restrict const _object, const void* restrict const _values, const size_t _valueCount) {
+	RWLock_WriteLock(&_object->lock);
+	const bool _isReserved = DynamicArray_ReserveElements(&_object->array, _valueCount);
+	if (_isReserved) { // every push below fits in the reserved elements
+		for (size_t i = 0; i < _valueCount; i++) {
+			DynamicArray_Push(&_object->array, (const uint8_t*)_values + (i * _object->array.elementSize));
+		}
+	}
+	RWLock_WriteUnlock(&_object->lock);
+	return _isReserved;
+}
+
+// Inserts the element at the index, the element is pushed if the index is out of bounds
+bool ConcurrentDynamicArray_Insert(concurrentdynamicarray_t* restrict const _object, const size_t _index, const void* restrict const _value) {
+	RWLock_WriteLock(&_object->lock);
+	const bool _isInserted = DynamicArray_Insert(&_object->array, _index, _value);
+	RWLock_WriteUnlock(&_object->lock);
+	return _isInserted;
+}
+
+// Overwrites the element at the index, returns false if the index is out of bounds
+bool ConcurrentDynamicArray_Set(concurrentdynamicarray_t* restrict const _object, const size_t _index, const void* restrict const _value) {
+	RWLock_WriteLock(&_object->lock);
+	const bool _isInBounds = (_index < _object->array.elementCount);
+	if (_isInBounds) {
+		memcpy((uint8_t*)_object->array.array + (_index * _object->array.elementSize), _value, _object->array.elementSize);
+	}
+	RWLock_WriteUnlock(&_object->lock);
+	return _isInBounds;
+}
+
+// Copies the element at the index, returns false if the index is out of bounds
+bool ConcurrentDynamicArray_Get(concurrentdynamicarray_t* restrict const _object, const size_t _index, void* restrict const out_value) {
+	RWLock_ReadLock(&_object->lock);
+	const bool _isInBounds = (_index < _object->array.elementCount);
+	if (_isInBounds) {
+		memcpy(out_value, (const uint8_t*)_object->array.array + (_index * _object->array.elementSize), _object->array.elementSize);
+	}
+	RWLock_ReadUnlock(&_object->lock);
+	return _isInBounds;
+}
+
+/* Copies up to _count elements starting at _firstIndex while holding the lock once
+ * Returns the number of elements copied, it is less than _count if the array ends earlier
+ */
+size_t ConcurrentDynamicArray_GetBatch(concurrentdynamicarray_t* restrict const _object, const size_t _firstIndex, const size_t _count, void* restrict const out_values) {
+	RWLock_ReadLock(&_object->lock);
+	size_t _copiedCount = 0;
+	if (_firstIndex < _object->array.elementCount) {
+		_copiedCount = _object->array.elementCount - _firstIndex;
+		if (_copiedCount > _count) {
+			_copiedCount = _count;
+		}
+		memcpy(out_values, (const uint8_t*)_object->array.array + (_firstIndex * _object->array.elementSize), _copiedCount * _object->array.elementSize);
+	}
+	RWLock_ReadUnlock(&_object->lock);
+	return _copiedCount;
+}
+
+/* Removes the last element, copying it into out_value unless it is NULL
+ * Returns false if the array is empty
+ */
+bool ConcurrentDynamicArray_Pop(concurrentdynamicarray_t* restrict const _object, void* restrict const out_value) {
+	RWLock_WriteLock(&_object->lock);
+	const bool _hasElement = (_object->array.elementCount != 0);
+	if (_hasElement) {
+		if (out_value) {
+			memcpy(out_value, (const uint8_t*)_object->array.array + ((_object->array.elementCount - 1) * _object->array.elementSize), _object->array.elementSize);
+		}
+		DynamicArray_Pop(&_object->array);
+	}
+	RWLock_WriteUnlock(&_object->lock);
+	return _hasElement;
+}
+
+bool ConcurrentDynamicArray_Delete(concurrentdynamicarray_t* const _object, const size_t _index) {
+	RWLock_WriteLock(&_object->lock);
+	const bool _isDeleted = DynamicArray_Delete(&_object->array, _index);
+	RWLock_WriteUnlock(&_object->lock);
+	return _isDeleted;
+}
+
+size_t ConcurrentDynamicArray_GetCount(concurrentdynamicarray_t* const _object) {
+	RWLock_ReadLock(&_object->lock);
+	const size_t _count = _object->array.elementCount;
+	RWLock_ReadUnlock(&_object->lock);
+	return _count;
+}
+
+// Shares the lock with the other readers and returns the array, which must not be modified until ReadUnlock
+const dynamicarray_t* ConcurrentDynamicArray_ReadLock(concurrentdynamicarray_t* const _object) {
+	RWLock_ReadLock(&_object->lock);
+	return &_object->array;
+}
+
+void ConcurrentDynamicArray_ReadUnlock(concurrentdynamicarray_t* const _object) {
+	RWLock_ReadUnlock(&_object->lock);
+}
+
+// Owns the lock and returns the array, which can be freely used until WriteUnlock
+dynamicarray_t* ConcurrentDynamicArray_WriteLock(concurrentdynamicarray_t* const _object) {
+	RWLock_WriteLock(&_object->lock);
+	return &_object->array;
+}
+
+void ConcurrentDynamicArray_WriteUnlock(concurrentdynamicarray_t* const _object) {
+	RWLock_WriteUnlock(&_object->lock);
+}
+
+/* Properly initializes the ConcurrentDynamicArray variable, discarding its previous contents
+ * Allocates memory to the ConcurrentDynamicArray variable if its current value is NULL
+ * A permanent variable must be zero filled or already initialized
+ */
+concurrentdynamicarray_t* ConcurrentDynamicArray_InitAll(concurrentdynamicarray_t* _object, const size_t _elementSize, const size_t _minCount, const float _expansionRate) {
+	bool _mallocVar;
+	if (!_object) { // if we are requesting to initialize it
+		_object = malloc(sizeof(concurrentdynamicarray_t));
+		if (!_object) {
+			return NULL; // failed allocating concurrentdynamicarray variable
+		}
+		_mallocVar = true;
+	} else {
+		if (_object->array.array) { // already initialized, its contents and lock must not leak
+			ConcurrentDynamicArray_FreeStorage(_object);
+		}
+		_mallocVar = false;
+	}
+	memset(&_object->array, 0, sizeof(dynamicarray_t));
+	if (!RWLock_Init(&_object->lock)) {
+		if (_mallocVar) {
+			free(_object);
+		}
+		return NULL; // failed initializing the lock
+	}
+	if (!DynamicArray_InitAll(&_object->array, _elementSize, _minCount, _expansionRate)) {
+		RWLock_Destroy(&_object->lock);
+		if (_mallocVar) {
+			free(_object);
+		}
+		return NULL; // insufficient memory
+	}
+	return _object; // initialization sucessful
+}
+
+// ---------------------------------------------------------------- DynamicStringArray
+
+// Frees the string array's storage and the lock. No thread must be using the string array
+void ConcurrentDynamicStringArray_FreeStorage(concurrentdynamicstringarray_t* const _object) {
+	DynamicStringArray_FreeStorage(&_object->stringArray);
+	RWLock_Destroy(&_object->lock);
+}
+
+/* Frees a ConcurrentDynamicStringArray object
+ * CAUTION! Do not pass pointer to a permanent ConcurrentDynamicStringArray variable!
+ */
+void ConcurrentDynamicStringArray_Free(concurrentdynamicstringarray_t* _object) {
+	ConcurrentDynamicStringArray_FreeStorage(_object);
+	free((void*)_object);
+}
+
+bool ConcurrentDynamicStringArray_PushSubString(concurrentdynamicstringarray_t* restrict const _object, const char* restrict const _string, const size_t _length) {
+	RWLock_WriteLock(&_object->lock);
+	const bool _isPushed = DynamicStringArray_PushSubString(&_object->stringArray, _string, _length);
+	RWLock_WriteUnlock(&_object->lock);
+	return _isPushed;
+}
+
+/* Pushes every null terminated string while holding the lock once
+ * Returns the number of strings pushed, it is less than _stringCount if a string was not pushed
+ */
+size_t ConcurrentDynamicStringArray_PushBatch(concurrentdynamicstringarray_t* restrict const _object, const char* const* restrict const _strings, const size_t _stringCount) {
+	RWLock_WriteLock(&_object->lock);
+	size_t i = 0;
+	if (DynamicStringArray_ReserveElements(&_object->stringArray, _stringCount)) {
+		for (; i < _stringCount; i++) {
+			if (!DynamicStringArray_Push(&_object->stringArray, _strings[i])) {
+				break; // insufficient memory
+			}
+		}
+	}
+	RWLock_WriteUnlock(&_object->lock);
+	return i;
+}
+
+/* Copies the string at the index into out_string, truncated to _maxSize bytes including its null terminator
+ * Returns the length of the whole string, it may be larger than what was copied
+ * Returns SIZE_MAX if the index is out of bounds
+ */
+size_t ConcurrentDynamicStringArray_Get(concurrentdynamicstringarray_t* restrict const _object, const size_t _index, char* restrict const out_string, const size_t _maxSize) {
+	RWLock_ReadLock(&_object->lock);
+	size_t _length = SIZE_MAX;
+	if (_index < _object->stringArray.elementCount) {
+		const char* const _string = _object->stringArray.array[_index];
+		_length = strlen(_string);
+		if (_maxSize) {
+			const size_t _copiedLength = (_length < _maxSize) ? _length : (_maxSize - 1);
+			memcpy(out_string, _string, _copiedLength);
+			out_string[_copiedLength] = 0; // null terminator
+		}
+	}
+	RWLock_ReadUnlock(&_object->lock);
+	return _length;
+}
+
+/* Searches a string inside the string array
+ * Returns the index of the matching element, or -1 if the string was not found
+ */
+size_t ConcurrentDynamicStringArray_Search(concurrentdynamicstringarray_t* restrict const _object, const char* restrict const _searchedString, const bool _isCaseSensitive) {
+	RWLock_ReadLock(&_object->lock);
+	const size_t _index = DynamicStringArray_Search(&_object->stringArray, _searchedString, _isCaseSensitive);
+	RWLock_ReadUnlock(&_object->lock);
+	return _index;
+}
+
+bool ConcurrentDynamicStringArray_Delete(concurrentdynamicstringarray_t* const _object, const size_t _index) {
+	RWLock_WriteLock(&_object->lock);
+	const bool _isDeleted = DynamicStringArray_Delete(&_object->stringArray, _index);
+	RWLock_WriteUnlock(&_object->lock);
+	return _isDeleted;
+}
+
+size_t ConcurrentDynamicStringArray_GetCount(concurrentdynamicstringarray_t* const _object) {
+	RWLock_ReadLock(&_object->lock);
+	const size_t _count = _object->stringArray.elementCount;
+	RWLock_ReadUnlock(&_object->lock);
+	return _count;
+}
+
+// Shares the lock with the other readers and returns the string array, which must not be modified until ReadUnlock
+const dynamicstringarray_t* ConcurrentDynamicStringArray_ReadLock(concurrentdynamicstringarray_t* const _object) {
+	RWLock_ReadLock(&_object->lock);
+	return &_object->stringArray;
+}
+
+void ConcurrentDynamicStringArray_ReadUnlock(concurrentdynamicstringarray_t* const _object) {
+	RWLock_ReadUnlock(&_object->lock);
+}
+
+// Owns the lock and returns the string array, which can be freely used until WriteUnlock
+dynamicstringarray_t* ConcurrentDynamicStringArray_WriteLock(concurrentdynamicstringarray_t* const _object) {
+	RWLock_WriteLock(&_object->lock);
+	return &_object->stringArray;
+}
+
+void ConcurrentDynamicStringArray_WriteUnlock(concurrentdynamicstringarray_t* const _object) {
+	RWLock_WriteUnlock(&_object->lock);
+}
+
+/* Properly initializes the ConcurrentDynamicStringArray variable, discarding its previous contents
+ * Allocates memory to the ConcurrentDynamicStringArray variable if its current value is NULL
+ * A permanent variable must be zero filled or already initialized
+ */
+concurrentdynamicstringarray_t* ConcurrentDynamicStringArray_InitAll(concurrentdynamicstringarray_t* _object, const size_t _minElementCount, const size_t _minBufferSize, const float _expansionRate) {
+	bool _mallocVar;
+	if (!_object) { // if we are requesting to initialize it
+		_object = malloc(sizeof(concurrentdynamicstringarray_t));
+		if (!_object) {
+			return NULL; // failed allocating concurrentdynamicstringarray variable
+		}
+		_mallocVar = true;
+	} else {
+		if (_object->stringArray.array) { // already initialized, its contents and lock must not leak
+			ConcurrentDynamicStringArray_FreeStorage(_object);
+		}
+		_mallocVar = false;
+	}
+	memset(&_object->stringArray, 0, sizeof(dynamicstringarray_t));
+	if (!RWLock_Init(&_object->lock)) {
+		if (_mallocVar) {
+			free(_object);
+		}
+		return NULL; // failed initializing the lock
+	}
+	if (!DynamicStringArray_InitAll(&_object->stringArray, _minElementCount, _minBufferSize, _expansionRate)) {
+		RWLock_Destroy(&_object->lock);
+		if (_mallocVar) {
+			free(_object);
+		}
+		return NULL; // insufficient memory
+	}
+	return _object; // initialization sucessful
+}
+
+// ---------------------------------------------------------------- SinglyLinkedList
+
+// Frees every node of the list and the lock. No thread must be using the list
+void ConcurrentSinglyLinkedList_FreeStorage(concurrentsinglylinkedlist_t* const _object) {
+	SinglyLinkedList_DeleteAllNodes(&_object->list);
+	RWLock_Destroy(&_object->lock);
+	memset(&_object->list, 0, sizeof(td_SinglyLinkedList_info)); // indicate the list requires initialization
+}
+
+/* Frees a ConcurrentSinglyLinkedList object
+ * CAUTION! Do not pass pointer to a permanent ConcurrentSinglyLinkedList variable!
+ */
+void ConcurrentSinglyLinkedList_Free(concurrentsinglylinkedlist_t* _object) {
+	ConcurrentSinglyLinkedList_FreeStorage(_object);
+	free((void*)_object);
+}
+
+// Copies the data into a new node at the end of the list
+bool ConcurrentSinglyLinkedList_AddNode(concurrentsinglylinkedlist_t* restrict const _object, const void* restrict const _data) {
+	RWLock_WriteLock(&_object->lock);
+	const bool _isAdded = (SinglyLinkedList_AddNode(&_object->list, _data) != NULL);
+	RWLock_WriteUnlock(&_object->lock);
+	return _isAdded;
+}
+
+/* Adds _dataCount contiguous payloads at the end of the list while holding the lock once
+ * Returns false if a node was not added due to insufficient memory, the nodes added before it are kept
+ */
+bool ConcurrentSinglyLinkedList_AddBatch(concurrentsinglylinkedlist_t* restrict const _object, const void* restrict const _datas, const size_t _dataCount) {
+	RWLock_WriteLock(&_object->lock);
+	bool _isAdded = true;
+	for (size_t i = 0; (i < _dataCount) && _isAdded; i++) {
+		_isAdded = (SinglyLinkedList_AddNode(&_object->list, (const uint8_t*)_datas + (i * _object->list.dataSize)) != NULL);
+	}
+	RWLock_WriteUnlock(&_object->lock);
+	return _isAdded;
+}
+
+// Copies the data into a new node at the front of the list
+bool ConcurrentSinglyLinkedList_PushFront(concurrentsinglylinkedlist_t* restrict const _object, const void* restrict const _data) {
+	RWLock_WriteLock(&_object->lock);
+	const bool _isPushed = (SinglyLinkedList_PushFront(&_object->list, _data) != NULL);
+	RWLock_WriteUnlock(&_object->lock);
+	return _isPushed;
+}
+
+/* Removes the first node, copying its data into out_data unless it is NULL
+ * Returns false if the list is empty
+ */
+bool ConcurrentSinglyLinkedList_PopFront(concurrentsinglylinkedlist_t* restrict const _object, void* restrict const out_data) {
+	RWLock_WriteLock(&_object->lock);
+	const bool _isPopped = SinglyLinkedList_PopFront(&_object->list, out_data);
+	RWLock_WriteUnlock(&_object->lock);
+	return _isPopped;
+}
+
+/* Copies the data of the first node which the InspectorFunction evaluated as true
+ * Returns false if no node matched
+ */
+bool ConcurrentSinglyLinkedList_FindFirst(
+	concurrentsinglylinkedlist_t* restrict const _object,
+	bool (*InspectorFunction)(const void*, void*), void* const _context,
+	void* restrict const out_data
+) {
+	RWLock_ReadLock(&_object->lock);
+	const td_SinglyLinkedList_node* const _node = SinglyLinkedList_FindFirst(&_object->list, InspectorFunction, _context);
+	if (_node) {
+		memcpy(out_data, _node->data, _object->list.dataSize);
+	}
+	RWLock_ReadUnlock(&_object->lock);
+	return _node != NULL;
+}
+
+/* Executes the passed function to every nodes on the list while sharing the lock with the other readers
+ * The function must not modify the data, and returns false to end the traversal early
+ */
+void ConcurrentSinglyLinkedList_ExecuteFunctionForEachNode(concurrentsinglylinkedlist_t* const _object, bool (*ExecutedFunction)(const void*, void*), void* const _context) {
+	RWLock_ReadLock(&_object->lock);
+	for (const td_SinglyLinkedList_node* _node = _object->list.first; _node; _node = _node->next) {
+		if (!(*ExecutedFunction)(_node->data, _context)) {
+			break;
+		}
+	}
+	RWLock_ReadUnlock(&_object->lock);
+}
+
+// Deletes the nodes which the InspectorFunction evaluated as SINGLYLINKEDLIST_DELETE, see SinglyLinkedList_DeleteNodesWithContext
+uint32_t ConcurrentSinglyLinkedList_DeleteNodesWithContext(concurrentsinglylinkedlist_t* const _object, uint8_t (*InspectorFunction)(const void*, void*), void* const _context) {
+	RWLock_WriteLock(&_object->lock);
+	const uint32_t _deletedCount = SinglyLinkedList_DeleteNodesWithContext(&_object->list, InspectorFunction, _context);
+	RWLock_WriteUnlock(&_object->lock);
+	return _deletedCount;
+}
+
+size_t ConcurrentSinglyLinkedList_GetNodeCount(concurrentsinglylinkedlist_t* const _object) {
+	RWLock_ReadLock(&_object->lock);
+	const size_t _count = SinglyLinkedList_GetNodeCount(&_object->list);
+	RWLock_ReadUnlock(&_object->lock);
+	return _count;
+}
+
+// Shares the lock with the other readers and returns the list, which must not be modified until ReadUnlock
+const td_SinglyLinkedList_info* ConcurrentSinglyLinkedList_ReadLock(concurrentsinglylinkedlist_t* const _object) {
+	RWLock_ReadLock(&_object->lock);
+	return &_object->list;
+}
+
+void ConcurrentSinglyLinkedList_ReadUnlock(concurrentsinglylinkedlist_t* const _object) {
+	RWLock_ReadUnlock(&_object->lock);
+}
+
+// Owns the lock and returns the list, which can be freely used until WriteUnlock
+td_SinglyLinkedList_info* ConcurrentSinglyLinkedList_WriteLock(concurrentsinglylinkedlist_t* const _object) {
+	RWLock_WriteLock(&_object->lock);
+	return &_object->list;
+}
+
+void ConcurrentSinglyLinkedList_WriteUnlock(concurrentsinglylinkedlist_t* const _object) {
+	RWLock_WriteUnlock(&_object->lock);
+}
+
+/* Properly initializes the ConcurrentSinglyLinkedList variable, discarding its previous contents
+ * Allocates memory to the ConcurrentSinglyLinkedList variable if its current value is NULL
+ * A permanent variable must be zero filled or already initialized
+ */
+concurrentsinglylinkedlist_t* ConcurrentSinglyLinkedList_InitWithSlabSize(concurrentsinglylinkedlist_t* _object, const size_t _dataSize, const size_t _slabNodeCount) {
+	bool _mallocVar;
+	if (!_object) { // if we are requesting to initialize it
+		_object = malloc(sizeof(concurrentsinglylinkedlist_t));
+		if (!_object) {
+			return NULL; // failed allocating concurrentsinglylinkedlist variable
+		}
+		_mallocVar = true;
+	} else {
+		if (_object->list.slabNodeCount) { // already initialized, its contents and lock must not leak
+			ConcurrentSinglyLinkedList_FreeStorage(_object);
+		}
+		_mallocVar = false;
+	}
+	if (!RWLock_Init(&_object->lock)) {
+		if (_mallocVar) {
+			free(_object);
+		}
+		return NULL; // failed initializing the lock
+	}
+	memset(&_object->list, 0, sizeof(td_SinglyLinkedList_info));
+	SinglyLinkedList_ResetWithSlabSize(&_object->list, _dataSize, _slabNodeCount ? _slabNodeCount : SINGLYLINKEDLIST_DEFAULT_SLABNODECOUNT); // non-zero tells that the list is initialized
+	return _object; // initialization sucessful
+}
@@ -0,0 +1,145 @@
+/*
+ * @File: Concurrent.h
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Thread-safe wrappers of the Dictionary, DynamicArray, DynamicStringArray and SinglyLinkedList
+ * @LastUpdate: October 18, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ *
+ * Every wrapper guards its container with an RWLock: reads share the lock, writes own it.
+ * Since the stored elements move whenever the container is modified, reads copy the elements out
+ * instead of returning pointers to them.
+ * The Batch functions take the lock once for many elements. For anything else, take the lock explicitly with
+ * ReadLock/WriteLock, use the returned container with its own functions, then release it with ReadUnlock/WriteUnlock.
+ * The container returned by ReadLock must not be modified.
+ * Build with -pthread.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "RWLock.h"
+#include "Dictionary.h"
+#include "DynamicArray.h"
+#include "DynamicStringArray.h"
+#include "SinglyLinkedList.h"
+
+typedef struct {
+    dictionary_t dictionary;
+    rwlock_t lock;
+} concurrentdictionary_t;
+
+typedef struct {
+    dynamicarray_t array;
+    rwlock_t lock;
+} concurrentdynamicarray_t;
+
+typedef struct {
+    dynamicstringarray_t stringArray;
+    rwlock_t lock;
+} concurrentdynamicstringarray_t;
+
+typedef struct {
+    td_SinglyLinkedList_info list;
+    rwlock_t lock;
+} concurrentsinglylinkedlist_t;
+
+// a key and its data, used by the batched dictionary functions
+typedef struct {
+    const void* key;
+    size_t keySize;
+    const void* data;  // ignored by ConcurrentDictionary_GetBatch
+    size_t dataSize;   // ignored by ConcurrentDictionary_GetBatch
+} concurrentdictionary_pair_t;
+
+void ConcurrentDictionary_FreeStorage(concurrentdictionary_t* const _object);
+void ConcurrentDictionary_Free(concurrentdictionary_t* _object);
+bool ConcurrentDictionary_Set(
+	concurrentdictionary_t* restrict const _object,
+	const void* restrict const _key, const size_t _keySize,
+	const void* restrict const _data, const size_t _dataSize
+);
+size_t ConcurrentDictionary_SetBatch(concurrentdictionary_t* restrict const _object, const concurrentdictionary_pair_t* restrict const _pairs, const size_t _pairCount);
+size_t ConcurrentDictionary_Get(
+	concurrentdictionary_t* restrict const _object,
+	const void* restrict const _key, const size_t _keySize,
+	void* restrict const out_data, const size_t _maxDataSize
+);
+size_t ConcurrentDictionary_GetBatch(
+	concurrentdictionary_t* restrict const _object,
+	const concurrentdictionary_pair_t* restrict const _keys, const size_t _keyCount,
+	void (*VisitorFunction)(const dictionary_entry_t*, size_t, void*), void* const _context
+);
+bool ConcurrentDictionary_HasKey(concurrentdictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize);
+bool ConcurrentDictionary_DeleteKey(concurrentdictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize);
+size_t ConcurrentDictionary_GetCount(concurrentdictionary_t* const _object);
+const dictionary_t* ConcurrentDictionary_ReadLock(concurrentdictionary_t* const _object);
+void ConcurrentDictionary_ReadUnlock(concurrentdictionary_t* const _object);
+dictionary_t* ConcurrentDictionary_WriteLock(concurrentdictionary_t* const _object);
+void ConcurrentDictionary_WriteUnlock(concurrentdictionary_t* const _object);
+concurrentdictionary_t* ConcurrentDictionary_InitWithMinSize(concurrentdictionary_t* _object, const size_t _minCount, const float _expansionRate);
+
+void ConcurrentDynamicArray_FreeStorage(concurrentdynamicarray_t* const _object);
+void ConcurrentDynamicArray_Free(concurrentdynamicarray_t* _object);
+bool ConcurrentDynamicArray_Push(concurrentdynamicarray_t* restrict const _object, const void* restrict const _value);
+bool ConcurrentDynamicArray_PushBatch(concurrentdynamicarray_t* restrict const _object, const void* restrict const _values, const size_t _valueCount);
+bool ConcurrentDynamicArray_Insert(concurrentdynamicarray_t* restrict const _object, const size_t _index, const void* restrict const _value);
+bool ConcurrentDynamicArray_Set(concurrentdynamicarray_t* restrict const _object, const size_t _index, const void* restrict const _value);
+bool ConcurrentDynamicArray_Get(concurrentdynamicarray_t* restrict const _object, const size_t _index, void* restrict const out_value);
+size_t ConcurrentDynamicArray_GetBatch(concurrentdynamicarray_t* restrict const _object, const size_t _firstIndex, const size_t _count, void* restrict const out_values);
+bool ConcurrentDynamicArray_Pop(concurrentdynamicarray_t* restrict const _object, void* restrict const out_value);
+bool ConcurrentDynamicArray_Delete(concurrentdynamicarray_t* const _object, const size_t _index);
+size_t ConcurrentDynamicArray_GetCount(concurrentdynamicarray_t* const _object);
+const dynamicarray_t* ConcurrentDynamicArray_ReadLock(concurrentdynamicarray_t* const _object);
+void ConcurrentDynamicArray_ReadUnlock(concurrentdynamicarray_t* const _object);
+dynamicarray_t* ConcurrentDynamicArray_WriteLock(concurrentdynamicarray_t* const _object);
+void ConcurrentDynamicArray_WriteUnlock(concurrentdynamicarray_t* const _object);
+concurrentdynamicarray_t* ConcurrentDynamicArray_InitAll(concurrentdynamicarray_t* _object, const size_t _elementSize, const size_t _minCount, const float _expansionRate);
+
+void ConcurrentDynamicStringArray_FreeStorage(concurrentdynamicstringarray_t* const _object);
+void ConcurrentDynamicStringArray_Free(concurrentdynamicstringarray_t* _object);
+bool ConcurrentDynamicStringArray_PushSubString(concurrentdynamicstringarray_t* restrict const _object, const char* restrict const _string, const size_t _length);
+size_t ConcurrentDynamicStringArray_PushBatch(concurrentdynamicstringarray_t* restrict const _object, const char* const* restrict const _strings, const size_t _stringCount);
+size_t ConcurrentDynamicStringArray_Get(concurrentdynamicstringarray_t* restrict const _object, const size_t _index, char* restrict const out_string, const size_t _maxSize);
+size_t ConcurrentDynamicStringArray_Search(concurrentdynamicstringarray_t* restrict const _object, const char* restrict const _searchedString, const bool _isCaseSensitive);
+bool ConcurrentDynamicStringArray_Delete(concurrentdynamicstringarray_t* const _object, const size_t _index);
+size_t ConcurrentDynamicStringArray_GetCount(concurrentdynamicstringarray_t* const _object);
+const dynamicstringarray_t* ConcurrentDynamicStringArray_ReadLock(concurrentdynamicstringarray_t* const _object);
+void ConcurrentDynamicStringArray_ReadUnlock(concurrentdynamicstringarray_t* const _object);
+dynamicstringarray_t* ConcurrentDynamicStringArray_WriteLock(concurrentdynamicstringarray_t* const _object);
+void ConcurrentDynamicStringArray_WriteUnlock(concurrentdynamicstringarray_t* const _object);
+concurrentdynamicstringarray_t* ConcurrentDynamicStringArray_InitAll(concurrentdynamicstringarray_t* _object, const size_t _minElementCount, const size_t _minBufferSize, const float _expansionRate);
+
+void ConcurrentSinglyLinkedList_FreeStorage(concurrentsinglylinkedlist_t* const _object);
+void ConcurrentSinglyLinkedList_Free(concurrentsinglylinkedlist_t* _object);
+bool ConcurrentSinglyLinkedList_AddNode(concurrentsinglylinkedlist_t* restrict const _object, const void* restrict const _data);
+bool ConcurrentSinglyLinkedList_AddBatch(concurrentsinglylinkedlist_t* restrict const _object, const void* restrict const _datas, const size_t _dataCount);
+bool ConcurrentSinglyLinkedList_PushFront(concurrentsinglylinkedlist_t* restrict const _object, const void* restrict const _data);
+bool ConcurrentSinglyLinkedList_PopFront(concurrentsinglylinkedlist_t* restrict const _object, void* restrict const out_data);
+bool ConcurrentSinglyLinkedList_FindFirst(
+	concurrentsinglylinkedlist_t* restrict const _object,
+	bool (*InspectorFunction)(const void*, void*), void* const _context,
+	void* restrict const out_data
+);
+void ConcurrentSinglyLinkedList_ExecuteFunctionForEachNode(concurrentsinglylinkedlist_t* const _object, bool (*ExecutedFunction)(const void*, void*), void* const _context);
+uint32_t ConcurrentSinglyLinkedList_DeleteNodesWithContext(concurrentsinglylinkedlist_t* const _object, uint8_t (*InspectorFunction)(const void*, void*), void* const _context);
+size_t ConcurrentSinglyLinkedList_GetNodeCount(concurrentsinglylinkedlist_t* const _object);
+const td_SinglyLinkedList_info* ConcurrentSinglyLinkedList_ReadLock(concurrentsinglylinkedlist_t* const _object);
+void ConcurrentSinglyLinkedList_ReadUnlock(concurrentsinglylinkedlist_t* const _object);
+td_SinglyLinkedList_info* ConcurrentSinglyLinkedList_WriteLock(concurrentsinglylinkedlist_t* const _object);
+void ConcurrentSinglyLinkedList_WriteUnlock(concurrentsinglylinkedlist_t* const _object);
+concurrentsinglylinkedlist_t* ConcurrentSinglyLinkedList_InitWithSlabSize(concurrentsinglylinkedlist_t* _object, const size_t _dataSize, const size_t _slabNodeCount);
+
+#define ConcurrentDictionary_Init(_object) ConcurrentDictionary_InitWithMinSize(_object, DICTIONARY_DEFAULT_INITIALCOUNT, DICTIONARY_DEFAULT_EXPANSIONRATE)
+#define ConcurrentDynamicArray_Init(_object, _elementSize) ConcurrentDynamicArray_InitAll(_object, _elementSize, _object_DEFAULT_INITIALCOUNT, _object_DEFAULT_EXPANSIONRATE)
+#define ConcurrentDynamicStringArray_Init(_object) ConcurrentDynamicStringArray_InitAll(_object, _DYNAMICARRAY_DEFAULT_INITIALARRAYCOUNT, _DYNAMICARRAY_DEFAULT_INITIALBUFFERSIZE, _DYNAMICARRAY_DEFAULT_EXPANSIONRATE)
+#define ConcurrentSinglyLinkedList_Init(_object, _dataSize) ConcurrentSinglyLinkedList_InitWithSlabSize(_object, _dataSize, SINGLYLINKEDLIST_DEFAULT_SLABNODECOUNT)
@@ -0,0 +1,183 @@
+/*
+ * @File: ConcurrentBenchmark.c
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Scalability benchmark of the ConcurrentDictionary against a mutex-wrapped Dictionary
+ * @LastUpdate: October 19, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ *
+ * Build: cc -O2 -pthread ConcurrentBenchmark.c -o ConcurrentBenchmark
+ * Usage: ./ConcurrentBenchmark [opsPerThread] [keyCount]
+ *
+ * Every thread runs opsPerThread operations on a dictionary pre-filled with keyCount keys,
+ * a read looks up a random key and a write overwrites a random key.
+ * The "batched" rows look up BENCHMARK_BATCHSIZE keys per lock acquisition, and count each key as one operation.
+ */
+
+#define _DEFAULT_SOURCE // clock_gettime() and strcasecmp()
+
+#include "Instrumentation.c"
+#include "Dictionary.c"
+#include "DynamicArray.c"
+#include "DynamicStringArray.c"
+#include "SinglyLinkedList.c"
+#include "RWLock.c"
+#include "Concurrent.c"
+#include "Hash.h"
+
+#include <pthread.h>
+#include <time.h>
+
+#define BENCHMARK_DEFAULT_OPSPERTHREAD 200000
+#define BENCHMARK_DEFAULT_KEYCOUNT 10000
+#define BENCHMARK_MAXTHREADS 16
+#define BENCHMARK_BATCHSIZE 16
+
+typedef enum {
+    LOCK_MUTEX,
+    LOCK_RWLOCK,
+    LOCK_RWLOCKBATCHED
+} lockkind_t;
+
+typedef struct {
+    lockkind_t kind;
+    size_t opsPerThread;
+    size_t keyCount;
+    unsigned readPermille; // reads per 1000 operations
+    pthread_mutex_t mutex;
+    dictionary_t dictionary;             // used by LOCK_MUTEX
+    concurrentdictionary_t concurrent;   // used by the other kinds
+    atomic_uint_fast64_t checksum;
+} benchmark_t;
+
+typedef struct {
+    benchmark_t* benchmark;
+    uint64_t seed;
+} benchmarkthread_t;
+
+static double GetSeconds(void) {
+    struct timespec _now;
+    clock_gettime(CLOCK_MONOTONIC, &_now);
+    return (double)_now.tv_sec + ((double)_now.tv_nsec / 1e9);
+}
+
+static void SumVisitor(const dictionary_entry_t* _entry, size_t _index, void* _context) {
+    (void)_index;
+    if (_entry) {
+        uint64_t _value;
+        memcpy(&_value, _entry->data, sizeof(_value));
+        *(uint64_t*)_context += _value;
+    }
+}
+
+static void* WorkerThread(void* _argument) {
+    benchmarkthread_t* const _thread = _argument;
+    benchmark_t* const _benchmark = _thread->benchmark;
+    uint64_t _random = _thread->seed;
+    uint64_t _sum = 0;
+    for (size_t _op = 0; _op < _benchmark->opsPerThread;) {
+        const uint64_t _roll = Hash_SplitMix64(&_random);
+        const bool _isRead = (_roll % 1000) < _benchmark->readPermille;
+        uint64_t _key = (_roll >> 16) % _benchmark->keyCount;
+        uint64_t _value;
+        switch (_benchmark->kind) {
+        case LOCK_MUTEX:
+            pthread_mutex_lock(&_benchmark->mutex);
+            if (_isRead) {
+                const dictionary_entry_t* const _entry = Dictionary_Get_Entry(&_benchmark->dictionary, &_key, sizeof(_key));
+                memcpy(&_value, _entry->data, sizeof(_value));
+                _sum += _value;
+            } else {
+                Dictionary_Set(&_benchmark->dictionary, &_key, sizeof(_key), &_roll, sizeof(_roll));
+            }
+            pthread_mutex_unlock(&_benchmark->mutex);
+            _op++;
+        break; case LOCK_RWLOCK:
+            if (_isRead) {
+                ConcurrentDictionary_Get(&_benchmark->concurrent, &_key, sizeof(_key), &_value, sizeof(_value));
+                _sum += _value;
+            } else {
+                ConcurrentDictionary_Set(&_benchmark->concurrent, &_key, sizeof(_key), &_roll, sizeof(_roll));
+            }
+            _op++;
+        break; case LOCK_RWLOCKBATCHED:
+            if (_isRead) {
+                uint64_t _keys[BENCHMARK_BATCHSIZE];
+                concurrentdictionary_pair_t _pairs[BENCHMARK_BATCHSIZE];
+                for (size_t i = 0; i < BENCHMARK_BATCHSIZE; i++) {
+                    _keys[i] = (i == 0) ? _key : (Hash_SplitMix64(&_random) % _benchmark->keyCount);
+                    _pairs[i].key = &_keys[i];
+                    _pairs[i].keySize = sizeof(_keys[i]);
+                }
+                ConcurrentDictionary_GetBatch(&_benchmark->concurrent, _pairs, BENCHMARK_BATCHSIZE, SumVisitor, &_sum);
+                _op += BENCHMARK_BATCHSIZE;
+            } else {
+                ConcurrentDictionary_Set(&_benchmark->concurrent, &_key, sizeof(_key), &_roll, sizeof(_roll));
+                _op++;
+            }
+        break;
+        }
+    }
+    atomic_fetch_add_explicit(&_benchmark->checksum, _sum, memory_order_relaxed); // keeps the reads alive
+    return NULL;
+}
+
+static void RunBenchmark(const lockkind_t _kind, const size_t _threadCount, const unsigned _readPermille, const size_t _opsPerThread, const size_t _keyCount) {
+    static const char* const kindNames[] = {"mutex+Dictionary", "ConcurrentDictionary", "ConcurrentDictionary batched"};
+    benchmark_t _benchmark;
+    memset(&_benchmark, 0, sizeof(_benchmark));
+    _benchmark.kind = _kind;
+    _benchmark.opsPerThread = _opsPerThread;
+    _benchmark.keyCount = _keyCount;
+    _benchmark.readPermille = _readPermille;
+    pthread_mutex_init(&_benchmark.mutex, NULL);
+    Dictionary_InitWithMinSize(&_benchmark.dictionary, _keyCount, DICTIONARY_DEFAULT_EXPANSIONRATE);
+    ConcurrentDictionary_InitWithMinSize(&_benchmark.concurrent, _keyCount, DICTIONARY_DEFAULT_EXPANSIONRATE);
+    for (uint64_t _key = 0; _key < _keyCount; _key++) {
+        dictionary_t* const _dictionary = (_kind == LOCK_MUTEX) ? &_benchmark.dictionary : &_benchmark.concurrent.dictionary;
+        Dictionary_Set(_dictionary, &_key, sizeof(_key), &_key, sizeof(_key));
+    }
+
+    pthread_t _threads[BENCHMARK_MAXTHREADS];
+    benchmarkthread_t _threadArguments[BENCHMARK_MAXTHREADS];
+    const double _start = GetSeconds();
+    for (size_t i = 0; i < _threadCount; i++) {
+        _threadArguments[i].benchmark = &_benchmark;
+        _threadArguments[i].seed = i + 1;
+        pthread_create(&_threads[i], NULL, WorkerThread, &_threadArguments[i]);
+    }
+    for (size_t i = 0; i < _threadCount; i++) {
+        pthread_join(_threads[i], NULL);
+    }
+    const double _elapsed = GetSeconds() - _start;
+
+    printf("%-30s %7zu %6.1f%% %14.0f\n",
+        kindNames[_kind], _threadCount, _readPermille / 10.0, (_threadCount * _opsPerThread) / _elapsed
+    );
+
+    ConcurrentDictionary_FreeStorage(&_benchmark.concurrent);
+    Dictionary_Free_Storage(&_benchmark.dictionary);
+    pthread_mutex_destroy(&_benchmark.mutex);
+}
+
+int main(int argc, char** argv) {
+    const size_t _opsPerThread = (argc > 1) ? strtoull(argv[1], NULL, 10) : BENCHMARK_DEFAULT_OPSPERTHREAD;
+    const size_t _keyCount = (argc > 2) ? strtoull(argv[2], NULL, 10) : BENCHMARK_DEFAULT_KEYCOUNT;
+    static const size_t threadCounts[] = {1, 2, 4, 8, 16};
+    static const unsigned readPermilles[] = {500, 900, 990};
+    printf("%-30s %7s %7s %14s\n", "lock", "threads", "reads", "ops/s");
+    for (size_t r = 0; r < (sizeof(readPermilles) / sizeof(readPermilles[0])); r++) {
+        for (size_t t = 0; t < (sizeof(threadCounts) / sizeof(threadCounts[0])); t++) {
+            RunBenchmark(LOCK_MUTEX, threadCounts[t], readPermilles[r], _opsPerThread, _keyCount);
+            RunBenchmark(LOCK_RWLOCK, threadCounts[t], readPermilles[r], _opsPerThread, _keyCount);
+            RunBenchmark(LOCK_RWLOCKBATCHED, threadCounts[t], readPermilles[r], _opsPerThread, _keyCount);
+        }
+    }
+    return 0;
+}
@@ -3,7 +3,7 @@
  * @Author: Aldrin John O. Manalansan (ajom)
  * @Email: aldrinjohnolaermanalansan@gmail.com
  * @Brief: Dynamically construct a dictionary of key-value pairs
- * @LastUpdate: June 17, 2025
+ * @LastUpdate: October 19, 2026
  * 
  * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
  * 
@@ -19,6 +19,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__AVX2__)
+	#include <immintrin.h>
+#endif
+
 // checks if the entire memory block is non-zero
 // this takes advantage of all the register sizes which guaratee that the operation finishes quickly
 static bool IsMemoryBlockNonZero(const void* const _block, const size_t _blockSize) {
@@ -32,7 +36,7 @@ static bool IsMemoryBlockNonZero(const void* const _block, const size_t _blockSi
 	}
 	const uint8_t* _searchBlock = (uint8_t*)_seeker;
 #if SIZE_MAX >= 0xFFFFFFFFFFFFFFFFULL // 64-bit compiler
-	if (_searchBlock < _outOfBoundsPtr) {
+	if ((size_t)(_outOfBoundsPtr - _searchBlock) >= sizeof(uint64_t)) {
 		uint64_t _value;
 		memcpy(&_value, _searchBlock, sizeof(uint64_t));
 		if (_value) {
@@ -42,7 +46,7 @@ static bool IsMemoryBlockNonZero(const void* const _block, const size_t _blockSi
 	}
 #endif
 #if SIZE_MAX >= 0xFFFFFFFFUL // 32-bit compiler and above
-	if (_searchBlock < _outOfBoundsPtr) {
+	if ((size_t)(_outOfBoundsPtr - _searchBlock) >= sizeof(uint32_t)) {
 		uint32_t _value;
 		memcpy(&_value, _searchBlock, sizeof(uint32_t));
 		if (_value) {
@@ -52,7 +56,7 @@ static bool IsMemoryBlockNonZero(const void* const _block, const size_t _blockSi
 	}
 #endif
 #if SIZE_MAX >= 0xFFFFU // 16-bit compiler and above
-	if (_searchBlock < _outOfBoundsPtr) {
+	if ((size_t)(_outOfBoundsPtr - _searchBlock) >= sizeof(uint16_t)) {
 		uint16_t _value;
 		memcpy(&_value, _searchBlock, sizeof(uint16_t));
 		if (_value) {
@@ -87,6 +91,9 @@ static int8_t CompareMemoryBlocks(
     const void* const _block_A, const size_t _blockSize_A,
     const void* const _block_B, const size_t _blockSize_B
 ) {
+	if ((_block_A == _block_B) && (_blockSize_A == _blockSize_B)) {
+		return 0; // same memory, e.g. a shared key
+	}
 	size_t _startOffset;
 		// check unaligned bytes
 	if (_blockSize_A > _blockSize_B) {
@@ -182,23 +189,21 @@ static int8_t CompareMemoryBlocks(
 // 	return 0;
 // }
 
-/* performs a binarysearch algorithm to traverse the dictionary
+/* performs a binarysearch algorithm to traverse the sorted entries [_left, _right) of the dictionary
  * returns 0 if the key is found, pickedIndex = this key's index
  * if the key was not found, pickedIndex is in between the two organized key values
  * returns -1 if _key < _object->entries[*pickedIndex].key
  * returns  1 if _key > _object->entries[*pickedIndex].key
  */
-static int8_t Dictionary_PickEntryIndex(
-	const dictionary_t* restrict const _object,
+static int8_t Dictionary_PickEntryIndexBetween(
+	const dictionary_t* restrict const _object, size_t _left, size_t _right,
 	const void* restrict const _key, const size_t _keySize,
 	size_t* restrict const _pickedIndex
 ) {
-    size_t _right = _object->elementCount;
-	if (!_right) { // no elements to traverse
-		*_pickedIndex = 0;
+	if (_left >= _right) { // no elements to traverse
+		*_pickedIndex = _left;
 		return -1;
 	}
-	size_t _left = 0;
 	int8_t compareResult = -1;
     while (_left < _right) {
         *_pickedIndex = _left + ((_right - _left) >> 1); // avoid overflow
@@ -216,9 +221,742 @@ static int8_t Dictionary_PickEntryIndex(
     return compareResult;
 }
 
+// binary searches the sorted entries, excluding the pending entries, see Dictionary_PickEntryIndexBetween
+static int8_t Dictionary_PickEntryIndex(
+	const dictionary_t* restrict const _object,
+	const void* restrict const _key, const size_t _keySize,
+	size_t* restrict const _pickedIndex
+) {
+	return Dictionary_PickEntryIndexBetween(_object, 0, _object->elementCount - _object->pendingCount, _key, _keySize, _pickedIndex);
+}
+
+// binary searches the pending entries, see Dictionary_PickEntryIndexBetween
+static int8_t Dictionary_PickPendingEntryIndex(
+	const dictionary_t* restrict const _object,
+	const void* restrict const _key, const size_t _keySize,
+	size_t* restrict const _pickedIndex
+) {
+	return Dictionary_PickEntryIndexBetween(_object, _object->elementCount - _object->pendingCount, _object->elementCount, _key, _keySize, _pickedIndex);
+}
+
+/* Compares two keys in the order the dictionary sorts its entries, see CompareMemoryBlocks
+ * returns -1 if key_A <  key_B
+ * returns  0 if key_A == key_B
+ * returns  1 if key_A >  key_B
+ */
+int8_t Dictionary_CompareKeys(const void* const _key_A, const size_t _keySize_A, const void* const _key_B, const size_t _keySize_B) {
+	return CompareMemoryBlocks(_key_A, _keySize_A, _key_B, _keySize_B);
+}
+
+// ---------------------------------------------------------------- B+tree backend
+
+#define DICTIONARY_BTREE_LEAFCOUNT 30           // entries per leaf, a leaf takes 504 bytes
+#define DICTIONARY_BTREE_INNERCOUNT 15          // separators per inner node, an inner node takes 496 bytes
+#define DICTIONARY_BTREE_MAXDEPTH 32            // growing a level needs at least 8 times the splits of the level below
+#define DICTIONARY_BTREE_NOSUMMARY UINT64_MAX   // summary of the unused slots, never counted as lesser
+
+// entries of every BPLUSTREE dictionary, only tells that the dictionary is initialized since nothing is stored there
+static dictionary_entry_t dictionaryBTreeEntries;
+
+typedef struct {
+    uint16_t count;     // entries of a leaf, separators of an inner node
+    bool isLeaf;
+} dictionary_btreenode_t;
+
+typedef struct dictionary_btreeleaf_s {
+    dictionary_btreenode_t node;
+    struct dictionary_btreeleaf_s* previous;
+    struct dictionary_btreeleaf_s* next;
+    uint64_t summaries[DICTIONARY_BTREE_LEAFCOUNT];             // key summary of every entry
+    dictionary_entry_t* entries[DICTIONARY_BTREE_LEAFCOUNT];    // sorted, the key is allocated together with its entry
+} dictionary_btreeleaf_t;
+
+typedef struct {
+    dictionary_btreenode_t node;
+    uint64_t summaries[DICTIONARY_BTREE_INNERCOUNT];
+    uint8_t* keys[DICTIONARY_BTREE_INNERCOUNT];                 // owned copies of the separator keys
+    size_t keySizes[DICTIONARY_BTREE_INNERCOUNT];
+    dictionary_btreenode_t* children[DICTIONARY_BTREE_INNERCOUNT + 1]; // children[i] holds the keys in [keys[i - 1], keys[i])
+} dictionary_btreeinner_t;
+
+// the inner nodes visited from the root down to a leaf
+typedef struct {
+    dictionary_btreeinner_t* nodes[DICTIONARY_BTREE_MAXDEPTH];
+    size_t childIndexes[DICTIONARY_BTREE_MAXDEPTH];
+    size_t depth;
+} dictionary_btreepath_t;
+
+/* Summarizes the key into 64 bits that keep the order of CompareMemoryBlocks:
+ * its length without the zeroes at the most significant end, followed by its 6 most significant bytes
+ * Keys with different summaries never need to be compared, equal summaries only happen on long common prefixes
+ */
+static uint64_t Dictionary_GetKeySummary(const void* const _key, size_t _keySize) {
+	const uint8_t* const _bytes = _key;
+	while (_keySize && !_bytes[_keySize - 1]) { // the most significant zeroes don't change its value
+		_keySize--;
+	}
+	if (_keySize >= 0xFFFF) {
+		return DICTIONARY_BTREE_NOSUMMARY; // length doesn't fit, always compared
+	}
+	uint64_t _summary = _keySize;
+	for (size_t i = 1; i <= 6; i++) {
+		_summary = (_summary << 8) | ((_keySize >= i) ? _bytes[_keySize - i] : 0);
+	}
+	return _summary;
+}
+
+/* Counts the summaries that are less than the summary, which is the lower bound since they are sorted
+ * Scans the whole node without branching, 4 summaries per instruction when compiled with AVX2 (-mavx2)
+ */
+static inline size_t Dictionary_CountLesserSummaries(const uint64_t* const _summaries, const size_t _capacity, const uint64_t _summary) {
+	size_t _count = 0;
+	size_t i = 0;
+#if defined(__AVX2__) && (defined(__GNUC__) || defined(__clang__))
+	const __m256i _signBit = _mm256_set1_epi64x(INT64_MIN); // AVX2 only compares signed integers
+	const __m256i _target = _mm256_xor_si256(_mm256_set1_epi64x((int64_t)_summary), _signBit);
+	for (; (i + 4) <= _capacity; i += 4) {
+		const __m256i _values = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(_summaries + i)), _signBit);
+		_count += (size_t)__builtin_popcount(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(_target, _values))));
+	}
+#endif
+	for (; i < _capacity; i++) {
+		_count += (_summaries[i] < _summary);
+	}
+	return _count;
+}
+
+/* searches the key inside the leaf
+ * returns true if found, _pickedIndex = the key's index
+ * returns false if not found, _pickedIndex = where the key would be inserted
+ */
+static bool Dictionary_BTreeFindInLeaf(
+	const dictionary_btreeleaf_t* restrict const _leaf,
+	const void* restrict const _key, const size_t _keySize, const uint64_t _summary,
+	size_t* restrict const _pickedIndex
+) {
+	size_t i = Dictionary_CountLesserSummaries(_leaf->summaries, DICTIONARY_BTREE_LEAFCOUNT, _summary);
+	for (; (i < _leaf->node.count) && (_leaf->summaries[i] == _summary); i++) { // same summary, compare the whole keys
+		const dictionary_entry_t* const _entry = _leaf->entries[i];
+		const int8_t _compareResult = CompareMemoryBlocks(_key, _keySize, _entry->key, _entry->keySize);
+		if (!_compareResult) {
+			*_pickedIndex = i;
+			return true;
+		}
+		if (_compareResult < 0) {
+			break;
+		}
+	}
+	*_pickedIndex = i;
+	return false;
+}
+
+// returns the index of the child whose range holds the key
+static size_t Dictionary_BTreePickChild(const dictionary_btreeinner_t* restrict const _inner, const void* restrict const _key, const size_t _keySize, const uint64_t _summary) {
+	size_t i = Dictionary_CountLesserSummaries(_inner->summaries, DICTIONARY_BTREE_INNERCOUNT, _summary);
+	while ((i < _inner->node.count) && (_inner->summaries[i] == _summary)
+	&& (CompareMemoryBlocks(_key, _keySize, _inner->keys[i], _inner->keySizes[i]) >= 0)) {
+		i++;
+	}
+	return i;
+}
+
+// returns the leaf whose range holds the key, out_path = NULL is allowed
+static dictionary_btreeleaf_t* Dictionary_BTreeDescend(
+	const dictionary_t* restrict const _object,
+	const void* restrict const _key, const size_t _keySize, const uint64_t _summary,
+	dictionary_btreepath_t* restrict const out_path
+) {
+	dictionary_btreenode_t* _node = _object->root;
+	if (out_path) {
+		out_path->depth = 0;
+	}
+	while (!_node->isLeaf) {
+		dictionary_btreeinner_t* const _inner = (dictionary_btreeinner_t*)_node;
+		const size_t _childIndex = Dictionary_BTreePickChild(_inner, _key, _keySize, _summary);
+		if (out_path) {
+			out_path->nodes[out_path->depth] = _inner;
+			out_path->childIndexes[out_path->depth] = _childIndex;
+			out_path->depth++;
+		}
+		_node = _inner->children[_childIndex];
+	}
+	return (dictionary_btreeleaf_t*)_node;
+}
+
+// returns the rightmost leaf, whose last entry has the greatest key
+static dictionary_btreeleaf_t* Dictionary_BTreeDescendRightmost(const dictionary_t* restrict const _object, dictionary_btreepath_t* restrict const out_path) {
+	dictionary_btreenode_t* _node = _object->root;
+	out_path->depth = 0;
+	while (!_node->isLeaf) {
+		dictionary_btreeinner_t* const _inner = (dictionary_btreeinner_t*)_node;
+		out_path->nodes[out_path->depth] = _inner;
+		out_path->childIndexes[out_path->depth] = _inner->node.count;
+		out_path->depth++;
+		_node = _inner->children[_inner->node.count];
+	}
+	return (dictionary_btreeleaf_t*)_node;
+}
+
+static dictionary_btreeleaf_t* Dictionary_BTreeNewLeaf(dictionary_t* const _object) {
+	(void)_object; // only used by the instrumentation
+	dictionary_btreeleaf_t* const _leaf = malloc(sizeof(dictionary_btreeleaf_t));
+	if (!_leaf) {
+		return NULL; // insufficient memory
+	}
+	INSTRUMENTATION_ALLOCATION(&_object->instrumentation, sizeof(dictionary_btreeleaf_t));
+	_leaf->node.count = 0;
+	_leaf->node.isLeaf = true;
+	_leaf->previous = NULL;
+	_leaf->next = NULL;
+	for (size_t i = 0; i < DICTIONARY_BTREE_LEAFCOUNT; i++) {
+		_leaf->summaries[i] = DICTIONARY_BTREE_NOSUMMARY;
+	}
+	return _leaf;
+}
+
+static dictionary_btreeinner_t* Dictionary_BTreeNewInner(dictionary_t* const _object) {
+	(void)_object; // only used by the instrumentation
+	dictionary_btreeinner_t* const _inner = malloc(sizeof(dictionary_btreeinner_t));
+	if (!_inner) {
+		return NULL; // insufficient memory
+	}
+	INSTRUMENTATION_ALLOCATION(&_object->instrumentation, sizeof(dictionary_btreeinner_t));
+	_inner->node.count = 0;
+	_inner->node.isLeaf = false;
+	for (size_t i = 0; i < DICTIONARY_BTREE_INNERCOUNT; i++) {
+		_inner->summaries[i] = DICTIONARY_BTREE_NOSUMMARY;
+	}
+	return _inner;
+}
+
+// allocates an entry with a copy of the key and a zeroed data buffer
+static dictionary_entry_t* Dictionary_BTreeNewEntry(dictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize, const size_t _dataSize) {
+	(void)_object; // only used by the instrumentation
+	dictionary_entry_t* const _entry = malloc(sizeof(dictionary_entry_t) + _keySize + 1); // +1 for string null terminator compatibility
+	if (!_entry) {
+		return NULL; // insufficient memory
+	}
+	_entry->data = calloc(_dataSize + 1, 1); // +1 for string null terminator compatibility
+	if (!_entry->data) {
+		free(_entry);
+		return NULL; // insufficient memory
+	}
+	INSTRUMENTATION_ALLOCATION(&_object->instrumentation, sizeof(dictionary_entry_t) + _keySize + 1);
+	INSTRUMENTATION_ALLOCATION(&_object->instrumentation, _dataSize + 1);
+	_entry->key = (uint8_t*)(_entry + 1);
+	memcpy(_entry->key, _key, _keySize);
+	_entry->key[_keySize] = 0; // null terminator for string compatibility
+	_entry->keySize = _keySize;
+	_entry->keyMaxSize = _keySize;
+	_entry->dataSize = 0;
+	_entry->dataMaxSize = _dataSize;
+	return _entry;
+}
+
+static void Dictionary_BTreeFreeEntry(dictionary_t* restrict const _object, dictionary_entry_t* restrict const _entry) {
+	(void)_object; // only used by the instrumentation
+	free(_entry->data);
+	free(_entry);
+	INSTRUMENTATION_FREE(&_object->instrumentation);
+	INSTRUMENTATION_FREE(&_object->instrumentation);
+}
+
+// frees the node and everything below it, except the _keptLeaf
+static void Dictionary_BTreeFreeNode(dictionary_t* restrict const _object, dictionary_btreenode_t* restrict const _node, const dictionary_btreeleaf_t* restrict const _keptLeaf) {
+	if (_node->isLeaf) {
+		if ((const dictionary_btreeleaf_t*)_node == _keptLeaf) {
+			return;
+		}
+		dictionary_btreeleaf_t* const _leaf = (dictionary_btreeleaf_t*)_node;
+		for (size_t i = 0; i < _leaf->node.count; i++) {
+			Dictionary_BTreeFreeEntry(_object, _leaf->entries[i]);
+		}
+	} else {
+		dictionary_btreeinner_t* const _inner = (dictionary_btreeinner_t*)_node;
+		for (size_t i = 0; i <= _inner->node.count; i++) {
+			Dictionary_BTreeFreeNode(_object, _inner->children[i], _keptLeaf);
+		}
+		for (size_t i = 0; i < _inner->node.count; i++) {
+			free(_inner->keys[i]);
+			INSTRUMENTATION_FREE(&_object->instrumentation);
+		}
+	}
+	free(_node);
+	INSTRUMENTATION_FREE(&_object->instrumentation);
+}
+
+// frees every entry and node, leaving an empty leaf as the root
+static void Dictionary_BTreeClear(dictionary_t* const _object) {
+	dictionary_btreenode_t* _node = _object->root;
+	while (!_node->isLeaf) { // keep the leftmost leaf
+		_node = ((dictionary_btreeinner_t*)_node)->children[0];
+	}
+	dictionary_btreeleaf_t* const _leaf = (dictionary_btreeleaf_t*)_node;
+	Dictionary_BTreeFreeNode(_object, _object->root, _leaf);
+	for (size_t i = 0; i < _leaf->node.count; i++) {
+		Dictionary_BTreeFreeEntry(_object, _leaf->entries[i]);
+		_leaf->summaries[i] = DICTIONARY_BTREE_NOSUMMARY;
+	}
+	_leaf->node.count = 0;
+	_leaf->previous = NULL;
+	_leaf->next = NULL;
+	_object->root = _leaf;
+	_object->elementCount = 0;
+}
+
+static void Dictionary_BTreeLeafInsert(dictionary_t* restrict const _object, dictionary_btreeleaf_t* restrict const _leaf, const size_t _index, dictionary_entry_t* restrict const _entry, const uint64_t _summary) {
+	(void)_object; // only used by the instrumentation
+	const size_t _shiftedCount = _leaf->node.count - _index;
+	if (_shiftedCount) {
+		memmove(&_leaf->summaries[_index + 1], &_leaf->summaries[_index], _shiftedCount * sizeof(uint64_t));
+		memmove(&_leaf->entries[_index + 1], &_leaf->entries[_index], _shiftedCount * sizeof(dictionary_entry_t*));
+		INSTRUMENTATION_MOVE(&_object->instrumentation, _shiftedCount * (sizeof(uint64_t) + sizeof(dictionary_entry_t*)));
+	}
+	_leaf->summaries[_index] = _summary;
+	_leaf->entries[_index] = _entry;
+	_leaf->node.count++;
+}
+
+// inserts the separator at _index, and its right child at _index + 1
+static void Dictionary_BTreeInnerInsert(
+	dictionary_btreeinner_t* restrict const _inner, const size_t _index,
+	uint8_t* restrict const _key, const size_t _keySize, const uint64_t _summary,
+	dictionary_btreenode_t* restrict const _child
+) {
+	const size_t _shiftedCount = _inner->node.count - _index;
+	memmove(&_inner->summaries[_index + 1], &_inner->summaries[_index], _shiftedCount * sizeof(uint64_t));
+	memmove(&_inner->keys[_index + 1], &_inner->keys[_index], _shiftedCount * sizeof(uint8_t*));
+	memmove(&_inner->keySizes[_index + 1], &_inner->keySizes[_index], _shiftedCount * sizeof(size_t));
+	memmove(&_inner->children[_index + 2], &_inner->children[_index + 1], _shiftedCount * sizeof(dictionary_btreenode_t*));
+	_inner->summaries[_index] = _summary;
+	_inner->keys[_index] = _key;
+	_inner->keySizes[_index] = _keySize;
+	_inner->children[_index + 1] = _child;
+	_inner->node.count++;
+}
+
+/* splits the full inner node while inserting a separator and its right child at _index
+ * the upper half moves to the empty _sibling, the separator between both halves is returned through _key, _keySize, _summary and _child
+ * inserting after the last separator keeps the node full, so appended keys fill their nodes
+ */
+static void Dictionary_BTreeSplitInner(
+	dictionary_btreeinner_t* restrict const _inner, dictionary_btreeinner_t* restrict const _sibling, const size_t _index,
+	uint8_t** restrict const _key, size_t* restrict const _keySize, uint64_t* restrict const _summary,
+	dictionary_btreenode_t** restrict const _child
+) {
+	uint64_t _summaries[DICTIONARY_BTREE_INNERCOUNT + 1];
+	uint8_t* _keys[DICTIONARY_BTREE_INNERCOUNT + 1];
+	size_t _keySizes[DICTIONARY_BTREE_INNERCOUNT + 1];
+	dictionary_btreenode_t* _children[DICTIONARY_BTREE_INNERCOUNT + 2];
+	_children[0] = _inner->children[0];
+	for (size_t i = 0, j = 0; i <= DICTIONARY_BTREE_INNERCOUNT; i++) {
+		if (i == _index) {
+			_summaries[i] = *_summary;
+			_keys[i] = *_key;
+			_keySizes[i] = *_keySize;
+			_children[i + 1] = *_child;
+		} else {
+			_summaries[i] = _inner->summaries[j];
+			_keys[i] = _inner->keys[j];
+			_keySizes[i] = _inner->keySizes[j];
+			_children[i + 1] = _inner->children[j + 1];
+			j++;
+		}
+	}
+	const size_t _leftCount = (_index == DICTIONARY_BTREE_INNERCOUNT) ? DICTIONARY_BTREE_INNERCOUNT : ((DICTIONARY_BTREE_INNERCOUNT + 1) / 2);
+	const size_t _rightCount = DICTIONARY_BTREE_INNERCOUNT - _leftCount;
+	memcpy(_inner->summaries, _summaries, _leftCount * sizeof(uint64_t));
+	memcpy(_inner->keys, _keys, _leftCount * sizeof(uint8_t*));
+	memcpy(_inner->keySizes, _keySizes, _leftCount * sizeof(size_t));
+	memcpy(_inner->children, _children, (_leftCount + 1) * sizeof(dictionary_btreenode_t*));
+	for (size_t i = _leftCount; i < DICTIONARY_BTREE_INNERCOUNT; i++) {
+		_inner->summaries[i] = DICTIONARY_BTREE_NOSUMMARY;
+	}
+	_inner->node.count = (uint16_t)_leftCount;
+	memcpy(_sibling->summaries, &_summaries[_leftCount + 1], _rightCount * sizeof(uint64_t));
+	memcpy(_sibling->keys, &_keys[_leftCount + 1], _rightCount * sizeof(uint8_t*));
+	memcpy(_sibling->keySizes, &_keySizes[_leftCount + 1], _rightCount * sizeof(size_t));
+	memcpy(_sibling->children, &_children[_leftCount + 1], (_rightCount + 1) * sizeof(dictionary_btreenode_t*));
+	_sibling->node.count = (uint16_t)_rightCount;
+	*_summary = _summaries[_leftCount];
+	*_key = _keys[_leftCount];
+	*_keySize = _keySizes[_leftCount];
+	*_child = (dictionary_btreenode_t*)_sibling;
+}
+
+/* inserts the entry at _index of the full leaf by splitting it, splitting every full inner node of the path as well
+ * every node is allocated before the tree is modified, so returns false due to insufficient memory with the tree untouched
+ */
+static bool Dictionary_BTreeSplitInsert(
+	dictionary_t* restrict const _object, const dictionary_btreepath_t* restrict const _path,
+	dictionary_btreeleaf_t* restrict const _leaf, const size_t _index,
+	dictionary_entry_t* restrict const _entry, const uint64_t _summary
+) {
+	size_t _splitCount = 0; // full inner nodes above the leaf
+	while ((_splitCount < _path->depth) && (_path->nodes[_path->depth - 1 - _splitCount]->node.count == DICTIONARY_BTREE_INNERCOUNT)) {
+		_splitCount++;
+	}
+	const bool _growsRoot = (_splitCount == _path->depth);
+	if (_growsRoot && (_path->depth == DICTIONARY_BTREE_MAXDEPTH)) {
+		return false; // too deep
+	}
+	// inserting after the last entry keeps the leaf full, so appended keys fill their leaves
+	const size_t _leftCount = (_index == DICTIONARY_BTREE_LEAFCOUNT) ? DICTIONARY_BTREE_LEAFCOUNT : (DICTIONARY_BTREE_LEAFCOUNT / 2);
+	const dictionary_entry_t* const _separatorEntry = (_index == DICTIONARY_BTREE_LEAFCOUNT) ? _entry : _leaf->entries[_leftCount];
+	dictionary_btreeinner_t* _inners[DICTIONARY_BTREE_MAXDEPTH + 1];
+	const size_t _innerCount = _splitCount + _growsRoot;
+	size_t _allocatedCount = 0;
+	dictionary_btreeleaf_t* const _sibling = Dictionary_BTreeNewLeaf(_object);
+	uint8_t* _separatorKey = malloc(_separatorEntry->keySize + 1);
+	bool _isAllocated = _sibling && _separatorKey;
+	while (_isAllocated && (_allocatedCount < _innerCount)) {
+		_inners[_allocatedCount] = Dictionary_BTreeNewInner(_object);
+		if (_inners[_allocatedCount]) {
+			_allocatedCount++;
+		} else {
+			_isAllocated = false;
+		}
+	}
+	if (!_isAllocated) {
+		while (_allocatedCount) {
+			free(_inners[--_allocatedCount]);
+			INSTRUMENTATION_FREE(&_object->instrumentation);
+		}
+		if (_sibling) {
+			free(_sibling);
+			INSTRUMENTATION_FREE(&_object->instrumentation);
+		}
+		free(_separatorKey);
+		return false; // insufficient memory
+	}
+	INSTRUMENTATION_ALLOCATION(&_object->instrumentation, _separatorEntry->keySize + 1);
+	INSTRUMENTATION_GROWTH(&_object->instrumentation, sizeof(dictionary_btreeleaf_t));
+	memcpy(_separatorKey, _separatorEntry->key, _separatorEntry->keySize);
+	size_t _separatorKeySize = _separatorEntry->keySize;
+	uint64_t _separatorSummary = (_index == DICTIONARY_BTREE_LEAFCOUNT) ? _summary : _leaf->summaries[_leftCount];
+
+	// split the leaf
+	const size_t _movedCount = DICTIONARY_BTREE_LEAFCOUNT - _leftCount;
+	memcpy(_sibling->summaries, &_leaf->summaries[_leftCount], _movedCount * sizeof(uint64_t));
+	memcpy(_sibling->entries, &_leaf->entries[_leftCount], _movedCount * sizeof(dictionary_entry_t*));
+	INSTRUMENTATION_MOVE(&_object->instrumentation, _movedCount * (sizeof(uint64_t) + sizeof(dictionary_entry_t*)));
+	for (size_t i = _leftCount; i < DICTIONARY_BTREE_LEAFCOUNT; i++) {
+		_leaf->summaries[i] = DICTIONARY_BTREE_NOSUMMARY;
+	}
+	_leaf->node.count = (uint16_t)_leftCount;
+	_sibling->node.count = (uint16_t)_movedCount;
+	_sibling->next = _leaf->next;
+	if (_leaf->next) {
+		_leaf->next->previous = _sibling;
+	}
+	_sibling->previous = _leaf;
+	_leaf->next = _sibling;
+	if (_index <= _leftCount && (_index != DICTIONARY_BTREE_LEAFCOUNT)) {
+		Dictionary_BTreeLeafInsert(_object, _leaf, _index, _entry, _summary);
+	} else {
+		Dictionary_BTreeLeafInsert(_object, _sibling, _index - _leftCount, _entry, _summary);
+	}
+
+	// insert the separator of both leaves into the parents
+	dictionary_btreenode_t* _child = (dictionary_btreenode_t*)_sibling;
+	size_t _usedCount = 0;
+	for (size_t _level = _path->depth; _level--;) {
+		dictionary_btreeinner_t* const _parent = _path->nodes[_level];
+		if (_parent->node.count < DICTIONARY_BTREE_INNERCOUNT) {
+			Dictionary_BTreeInnerInsert(_parent, _path->childIndexes[_level], _separatorKey, _separatorKeySize, _separatorSummary, _child);
+			return true;
+		}
+		Dictionary_BTreeSplitInner(_parent, _inners[_usedCount++], _path->childIndexes[_level], &_separatorKey, &_separatorKeySize, &_separatorSummary, &_child);
+	}
+	// every node of the path was full, the tree grows by one level
+	dictionary_btreeinner_t* const _root = _inners[_usedCount];
+	_root->summaries[0] = _separatorSummary;
+	_root->keys[0] = _separatorKey;
+	_root->keySizes[0] = _separatorKeySize;
+	_root->children[0] = _object->root;
+	_root->children[1] = _child;
+	_root->node.count = 1;
+	_object->root = _root;
+	return true;
+}
+
+/* inserts a new entry at _index of the leaf found through the path
+ * returns NULL due to insufficient memory
+ */
+static dictionary_entry_t* Dictionary_BTreeInsertAt(
+	dictionary_t* restrict const _object, const dictionary_btreepath_t* restrict const _path,
+	dictionary_btreeleaf_t* restrict const _leaf, const size_t _index,
+	const void* restrict const _key, const size_t _keySize, const uint64_t _summary, const size_t _dataSize
+) {
+	dictionary_entry_t* const _entry = Dictionary_BTreeNewEntry(_object, _key, _keySize, _dataSize);
+	if (!_entry) {
+		return NULL; // insufficient memory
+	}
+	if (_leaf->node.count < DICTIONARY_BTREE_LEAFCOUNT) {
+		Dictionary_BTreeLeafInsert(_object, _leaf, _index, _entry, _summary);
+	} else if (!Dictionary_BTreeSplitInsert(_object, _path, _leaf, _index, _entry, _summary)) {
+		Dictionary_BTreeFreeEntry(_object, _entry);
+		return NULL; // insufficient memory
+	}
+	_object->elementCount++;
+	return _entry;
+}
+
+// returns the entry of the key, creating it if it doesn't exist. returns NULL due to insufficient memory
+static dictionary_entry_t* Dictionary_BTreeSet(dictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize, const size_t _dataSize) {
+	const uint64_t _summary = Dictionary_GetKeySummary(_key, _keySize);
+	dictionary_btreepath_t _path;
+	dictionary_btreeleaf_t* const _leaf = Dictionary_BTreeDescend(_object, _key, _keySize, _summary, &_path);
+	size_t _index;
+	if (Dictionary_BTreeFindInLeaf(_leaf, _key, _keySize, _summary, &_index)) {
+		return _leaf->entries[_index];
+	}
+	return Dictionary_BTreeInsertAt(_object, &_path, _leaf, _index, _key, _keySize, _summary, _dataSize);
+}
+
+// creates the entry of a key that is greater than every key, returns NULL due to insufficient memory
+static dictionary_entry_t* Dictionary_BTreeAppend(dictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize, const size_t _dataSize) {
+	dictionary_btreepath_t _path;
+	dictionary_btreeleaf_t* const _leaf = Dictionary_BTreeDescendRightmost(_object, &_path);
+	return Dictionary_BTreeInsertAt(_object, &_path, _leaf, _leaf->node.count, _key, _keySize, Dictionary_GetKeySummary(_key, _keySize), _dataSize);
+}
+
+static dictionary_entry_t* Dictionary_BTreeGet(const dictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize) {
+	const uint64_t _summary = Dictionary_GetKeySummary(_key, _keySize);
+	const dictionary_btreeleaf_t* const _leaf = Dictionary_BTreeDescend(_object, _key, _keySize, _summary, NULL);
+	size_t _index;
+	return Dictionary_BTreeFindInLeaf(_leaf, _key, _keySize, _summary, &_index) ? _leaf->entries[_index] : NULL;
+}
+
+/* removes the key and frees its entry
+ * a leaf is only removed once it is empty, underfull nodes are not merged
+ */
+static bool Dictionary_BTreeDelete(dictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize) {
+	const uint64_t _summary = Dictionary_GetKeySummary(_key, _keySize);
+	dictionary_btreepath_t _path;
+	dictionary_btreeleaf_t* const _leaf = Dictionary_BTreeDescend(_object, _key, _keySize, _summary, &_path);
+	size_t _index;
+	if (!Dictionary_BTreeFindInLeaf(_leaf, _key, _keySize, _summary, &_index)
+	|| (_leaf->entries[_index]->keySize != _keySize)) { // like the sorted array, only the exact key is deleted
+		return false; // key not found
+	}
+	Dictionary_BTreeFreeEntry(_object, _leaf->entries[_index]);
+	_leaf->node.count--;
+	const size_t _shiftedCount = _leaf->node.count - _index;
+	if (_shiftedCount) {
+		memmove(&_leaf->summaries[_index], &_leaf->summaries[_index + 1], _shiftedCount * sizeof(uint64_t));
+		memmove(&_leaf->entries[_index], &_leaf->entries[_index + 1], _shiftedCount * sizeof(dictionary_entry_t*));
+		INSTRUMENTATION_MOVE(&_object->instrumentation, _shiftedCount * (sizeof(uint64_t) + sizeof(dictionary_entry_t*)));
+	}
+	_leaf->summaries[_leaf->node.count] = DICTIONARY_BTREE_NOSUMMARY;
+	_object->elementCount--;
+	if (_leaf->node.count || !_path.depth) {
+		return true; // key has been deleted successfully
+	}
+
+	// unlink the empty leaf, and every inner node that loses its only child
+	if (_leaf->previous) {
+		_leaf->previous->next = _leaf->next;
+	}
+	if (_leaf->next) {
+		_leaf->next->previous = _leaf->previous;
+	}
+	free(_leaf);
+	INSTRUMENTATION_FREE(&_object->instrumentation);
+	for (size_t _level = _path.depth; _level--;) {
+		dictionary_btreeinner_t* const _parent = _path.nodes[_level];
+		if (!_parent->node.count) { // was its only child, the root always has two
+			free(_parent);
+			INSTRUMENTATION_FREE(&_object->instrumentation);
+			continue;
+		}
+		const size_t _childIndex = _path.childIndexes[_level];
+		const size_t _separatorIndex = _childIndex ? (_childIndex - 1) : 0; // the removed range joins a neighbour
+		free(_parent->keys[_separatorIndex]);
+		INSTRUMENTATION_FREE(&_object->instrumentation);
+		_parent->node.count--;
+		const size_t _shiftedSeparatorCount = _parent->node.count - _separatorIndex;
+		memmove(&_parent->summaries[_separatorIndex], &_parent->summaries[_separatorIndex + 1], _shiftedSeparatorCount * sizeof(uint64_t));
+		memmove(&_parent->keys[_separatorIndex], &_parent->keys[_separatorIndex + 1], _shiftedSeparatorCount * sizeof(uint8_t*));
+		memmove(&_parent->keySizes[_separatorIndex], &_parent->keySizes[_separatorIndex + 1], _shiftedSeparatorCount * sizeof(size_t));
+		memmove(&_parent->children[_childIndex], &_parent->children[_childIndex + 1], (_parent->node.count + 1 - _childIndex) * sizeof(dictionary_btreenode_t*));
+		_parent->summaries[_parent->node.count] = DICTIONARY_BTREE_NOSUMMARY;
+		break;
+	}
+	// a root with a single child is replaced by its child
+	while (!((dictionary_btreenode_t*)_object->root)->isLeaf && !((dictionary_btreenode_t*)_object->root)->count) {
+		dictionary_btreeinner_t* const _root = _object->root;
+		_object->root = _root->children[0];
+		free(_root);
+		INSTRUMENTATION_FREE(&_object->instrumentation);
+	}
+	return true; // key has been deleted successfully
+}
+
+// ---------------------------------------------------------------- pending entries
+
+// the entry at _elementIndex has been removed, which is one pending entry less if it was pending
+static void Dictionary_RemovePendingEntry(dictionary_t* const _object, const size_t _elementIndex) {
+	if (_elementIndex >= (_object->elementCount - _object->pendingCount)) {
+		_object->pendingCount--;
+	}
+}
+
+static int8_t Dictionary_CompareEntries(const dictionary_entry_t* const _entry_A, const dictionary_entry_t* const _entry_B) {
+	return CompareMemoryBlocks(_entry_A->key, _entry_A->keySize, _entry_B->key, _entry_B->keySize);
+}
+
+/* Merges the pending entries into the sorted entries in one backward pass
+ * Only the sorted entries greater than the least pending key are moved
+ */
+void Dictionary_MergePending(dictionary_t* const _object) {
+	const size_t _pendingCount = _object->pendingCount;
+	if (!_pendingCount) {
+		return; // nothing to merge
+	}
+	dictionary_entry_t* const _entries = _object->entries;
+	dictionary_entry_t* const _pendingEntries = _object->pendingBuffer;
+	size_t _sortedIndex = _object->elementCount - _pendingCount;
+	memcpy(_pendingEntries, &_entries[_sortedIndex], _pendingCount * sizeof(dictionary_entry_t));
+	size_t _pendingIndex = _pendingCount;
+	size_t _mergedIndex = _object->elementCount;
+	while (_pendingIndex) { // the greatest remaining entry is placed at the back
+		if (_sortedIndex
+		&& (Dictionary_CompareEntries(&_entries[_sortedIndex - 1], &_pendingEntries[_pendingIndex - 1]) > 0)) {
+			_entries[--_mergedIndex] = _entries[--_sortedIndex];
+		} else {
+			_entries[--_mergedIndex] = _pendingEntries[--_pendingIndex];
+		}
+	}
+	INSTRUMENTATION_MOVE(&_object->instrumentation, (_object->elementCount - _sortedIndex) * sizeof(dictionary_entry_t));
+	_object->pendingCount = 0;
+}
+
+/* Lets the SORTEDARRAY backend insert new keys among the pending keys instead of shifting every greater key
+ * The pending keys are sorted apart, after the sorted keys, so a new key only shifts the pending keys greater than itself
+ * Once _pendingThreshold keys are pending, they are merged into the sorted keys at once
+ * Lookups and iteration search both the sorted and the pending keys without modifying the Dictionary, bulk loading merges them first
+ * Entries accessed directly through entries[] aren't entirely sorted until Dictionary_MergePending
+ * _pendingThreshold = 0 disables the pending keys, which is the default
+ * Returns false due to insufficient memory, or with the BPLUSTREE backend that never shifts its entries
+ */
+bool Dictionary_SetPendingThreshold(dictionary_t* const _object, const size_t _pendingThreshold) {
+	if (_object->backend != DICTIONARY_BACKEND_SORTEDARRAY) {
+		return false; // B+tree inserts don't shift
+	}
+	Dictionary_MergePending(_object);
+	if (!_pendingThreshold) {
+		if (_object->pendingBuffer) { // has allocated buffer
+			free(_object->pendingBuffer);
+			_object->pendingBuffer = NULL;
+			INSTRUMENTATION_FREE(&_object->instrumentation);
+		}
+		_object->pendingThreshold = 0;
+		return true;
+	}
+	if (_pendingThreshold > (SIZE_MAX / sizeof(dictionary_entry_t))) {
+		return false; // too large
+	}
+	const size_t _bufferSize = _pendingThreshold * sizeof(dictionary_entry_t);
+	dictionary_entry_t* const _buffer = realloc(_object->pendingBuffer, _bufferSize);
+	if (!_buffer) {
+		return false; // insufficient memory
+	}
+	INSTRUMENTATION_REALLOCATION(&_object->instrumentation, _bufferSize);
+	_object->pendingBuffer = _buffer;
+	_object->pendingThreshold = _pendingThreshold;
+	return true;
+}
+
+// ---------------------------------------------------------------- shared keys
+
+static void* Dictionary_SetEntryData(
+	dictionary_t* restrict const _object, dictionary_entry_t* restrict const _entry,
+	const void* restrict const _data, const size_t _dataSize
+);
+
+#define DICTIONARY_SHAREDKEY_SUFFIXSIZE 2 // bytes 0 and 1 after every key of a key table
+#define DICTIONARY_SHAREDKEY_STACKSIZE 128
+
+/* references the key of the key table, adding it if it doesn't exist. Returns the key table's entry, NULL due to insufficient memory
+ * The key table holds every key followed by the bytes 0 and 1, which ends every key with a non zero byte at a position depending on its size.
+ * So keys only differing by trailing zero bytes, which the Dictionary compares equal, keep their own copies,
+ * and each copy is still null terminated right after the key
+ */
+static dictionary_entry_t* Dictionary_AcquireSharedKey(dictionary_t* restrict const _keyTable, const void* restrict const _key, const size_t _keySize) {
+	if (_keySize > (SIZE_MAX - DICTIONARY_SHAREDKEY_SUFFIXSIZE)) {
+		return NULL; // too large
+	}
+	const size_t _sharedKeySize = _keySize + DICTIONARY_SHAREDKEY_SUFFIXSIZE;
+	uint8_t _stackKey[DICTIONARY_SHAREDKEY_STACKSIZE];
+	uint8_t* const _sharedKey = (_sharedKeySize <= sizeof(_stackKey)) ? _stackKey : malloc(_sharedKeySize);
+	if (!_sharedKey) {
+		return NULL; // insufficient memory
+	}
+	memcpy(_sharedKey, _key, _keySize);
+	_sharedKey[_keySize] = 0;
+	_sharedKey[_keySize + 1] = 1;
+	dictionary_entry_t* _sharedEntry = Dictionary_BTreeGet(_keyTable, _sharedKey, _sharedKeySize);
+	if (!_sharedEntry) {
+		_sharedEntry = Dictionary_BTreeSet(_keyTable, _sharedKey, _sharedKeySize, sizeof(size_t));
+		if (_sharedEntry && !Dictionary_SetEntryData(_keyTable, _sharedEntry, NULL, sizeof(size_t))) {
+			_sharedEntry = NULL; // insufficient memory
+		}
+	}
+	if (_sharedKey != _stackKey) {
+		free(_sharedKey);
+	}
+	if (_sharedEntry) {
+		(*(size_t*)_sharedEntry->data)++; // reference count
+	}
+	return _sharedEntry;
+}
+
+// drops the reference of the entry to its shared key, deleting the key from the key table once unreferenced
+static void Dictionary_ReleaseSharedKey(dictionary_t* restrict const _object, dictionary_entry_t* restrict const _entry) {
+	dictionary_entry_t* const _sharedEntry = (dictionary_entry_t*)_entry->key - 1; // the B+tree stores the key right after its entry
+	if (!--(*(size_t*)_sharedEntry->data)) {
+		Dictionary_BTreeDelete(_object->sharedKeys, _sharedEntry->key, _sharedEntry->keySize);
+	}
+	_entry->key = NULL;
+	_entry->keySize = 0;
+	_entry->keyMaxSize = 0;
+}
+
+/* Makes an empty SORTEDARRAY Dictionary reference the keys of a key table instead of copying them
+ * Any number of Dictionaries can share one key table, which keeps one copy of every distinct key with its reference count
+ * Initialize the key table with Dictionary_InitKeyTable, and free it only after every Dictionary sharing it
+ * Every key of the key table is followed by the bytes 0 and 1, which its sharing entries' keySize excludes
+ * The sharing Dictionaries and their key table must be accessed by one thread at a time
+ * _keyTable = NULL makes the Dictionary copy its keys again
+ * Returns false if the Dictionary isn't empty, uses the BPLUSTREE backend, or the key table doesn't
+ */
+bool Dictionary_SetSharedKeys(dictionary_t* restrict const _object, dictionary_t* restrict const _keyTable) {
+	if ((_object->backend != DICTIONARY_BACKEND_SORTEDARRAY) || _object->elementCount
+	|| (_keyTable && (_keyTable->backend != DICTIONARY_BACKEND_BPLUSTREE))) {
+		return false; // incompatible
+	}
+	if (!_object->sharedKeys) { // key buffers kept for reuse can't hold shared keys
+		for (size_t i = 0; i < _object->maxElementCount; i++) {
+			dictionary_entry_t* const _entry = &_object->entries[i];
+			if (_entry->key) { // has allocated key buffer
+				free(_entry->key);
+				_entry->key = NULL;
+				_entry->keyMaxSize = 0;
+				INSTRUMENTATION_FREE(&_object->instrumentation);
+			}
+		}
+	}
+	_object->sharedKeys = _keyTable;
+	return true;
+}
+
+// ---------------------------------------------------------------- Dictionary
+
 // assures the minimum size of the dictionary's buffer. Expanding its memory size if necessary
 bool Dictionary_SetMinElements(dictionary_t* const _object, size_t _minCount) {
-	if (_object->maxElementCount >= _minCount) { // buffer's current size already satisfied our size requirement
+	if ((_object->backend == DICTIONARY_BACKEND_BPLUSTREE) // allocates its nodes on demand
+	|| (_object->maxElementCount >= _minCount)) { // buffer's current size already satisfied our size requirement
 		return true;
 	}
 	_minCount *= _object->expansionRate;
@@ -226,6 +964,8 @@ bool Dictionary_SetMinElements(dictionary_t* const _object, size_t _minCount) {
 	if (!_expandedStorage) {
 		return false; // failed expanding our buffer's size, therefore initialization requirement wasn't met
 	}
+	INSTRUMENTATION_REALLOCATION(&_object->instrumentation, _minCount * sizeof(dictionary_entry_t));
+	INSTRUMENTATION_GROWTH(&_object->instrumentation, _minCount * sizeof(dictionary_entry_t));
 	memset(&_expandedStorage[_object->maxElementCount], 0, (_minCount - _object->maxElementCount) * sizeof(dictionary_entry_t)); // fill added memory with zeros
 	_object->entries = _expandedStorage;
 	_object->maxElementCount = _minCount;
@@ -234,7 +974,8 @@ bool Dictionary_SetMinElements(dictionary_t* const _object, size_t _minCount) {
 
 // assures that the dictionary's buffer has enough unused elements. Expanding its memory size if necessary
 bool Dictionary_ReserveElements(dictionary_t* const _object, const size_t _reservedElementCount) {
-	if ((_object->maxElementCount < _object->elementCount + _reservedElementCount) // requires expansion
+	if ((_object->backend == DICTIONARY_BACKEND_SORTEDARRAY) // the B+tree allocates its nodes on demand
+	&& (_object->maxElementCount < _object->elementCount + _reservedElementCount) // requires expansion
 	&& !Dictionary_SetMinElements(_object, _object->maxElementCount + _reservedElementCount)) {
 		return false; // failed expanding buffer
 	}
@@ -243,107 +984,183 @@ bool Dictionary_ReserveElements(dictionary_t* const _object, const size_t _reser
 
 // Frees the element from the dictionary together with its allocated key and data 
 void Dictionary_Free_Entry(dictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize) {
+	if (_object->backend == DICTIONARY_BACKEND_BPLUSTREE) {
+		Dictionary_BTreeDelete(_object, _key, _keySize);
+		return;
+	}
 	for (size_t _elementIndex = 0; _elementIndex < _object->elementCount; _elementIndex++) {
 		dictionary_entry_t* const _entry = &_object->entries[_elementIndex];
 		if ((_entry->keySize != _keySize) || memcmp(_entry->key, _key, _keySize)) {
 			continue;
 		}
-		if (_entry->key) { // has allocated key buffer
+		if (_object->sharedKeys) {
+			Dictionary_ReleaseSharedKey(_object, _entry);
+		} else if (_entry->key) { // has allocated key buffer
 			free(_entry->key);
+			INSTRUMENTATION_FREE(&_object->instrumentation);
 		}
 		if (_entry->data) { // has allocated data buffer
 			free(_entry->data);
+			INSTRUMENTATION_FREE(&_object->instrumentation);
 		}
+		Dictionary_RemovePendingEntry(_object, _elementIndex);
 		_object->elementCount--; // decrease element count by 1
 		size_t shiftedElementCount = _object->elementCount - _elementIndex;
 		if (shiftedElementCount) { // there are elements that needs to be shifted leftwards
 			memmove(_entry, _entry + 1, shiftedElementCount * sizeof(dictionary_entry_t));
-		} else {
-			_entry->key = NULL;
-			_entry->data = NULL;
+			INSTRUMENTATION_MOVE(&_object->instrumentation, shiftedElementCount * sizeof(dictionary_entry_t));
 		}
+		// the vacated slot still points to buffers now owned by another entry (or already freed)
+		memset(&_entry[shiftedElementCount], 0, sizeof(dictionary_entry_t));
+		return;
 	}
 }
 
 // Frees all the elements of the dictionary together with their allocated key and data 
 void Dictionary_Free_AllEntries(dictionary_t* const _object) {
+	if (_object->backend == DICTIONARY_BACKEND_BPLUSTREE) {
+		Dictionary_BTreeClear(_object);
+		return;
+	}
+	if (_object->sharedKeys) { // only the valid entries reference shared keys
+		for (size_t i = 0; i < _object->elementCount; i++) {
+			Dictionary_ReleaseSharedKey(_object, &_object->entries[i]);
+		}
+	}
 	// we use maxelementcount so that we free unused allocated entries as well
 	const dictionary_entry_t* const _outOfBoundsPtr = _object->entries + _object->maxElementCount;
 	for (dictionary_entry_t* _entry = _object->entries; _entry < _outOfBoundsPtr; _entry++) {
 		if (_entry->key) { // has allocated key buffer
 			free(_entry->key);
 			_entry->key = NULL;
+			INSTRUMENTATION_FREE(&_object->instrumentation);
 		}
 		if (_entry->data) { // has allocated data buffer
 			free(_entry->data);
 			_entry->data = NULL;
+			INSTRUMENTATION_FREE(&_object->instrumentation);
 		}
 	}
 	_object->elementCount = 0;
+	_object->pendingCount = 0;
 }
 
 // Frees the Dictionary's Storage
 // Since this dictionary's storage has been freed, it must be re-initialized again before reusing it. 
 void Dictionary_Free_Storage(dictionary_t* const _object) {
-	if (_object->entries) { // has allocated buffer
+	INSTRUMENTATION_TRACE_FORGET(INSTRUMENTATION_OPERATION_DICTIONARY_SET, _object);
+	if (_object->pendingBuffer) { // has allocated buffer
+		free(_object->pendingBuffer);
+		_object->pendingBuffer = NULL;
+		_object->pendingThreshold = 0;
+		INSTRUMENTATION_FREE(&_object->instrumentation);
+	}
+	if (_object->root) { // has allocated B+tree
+		Dictionary_BTreeFreeNode(_object, _object->root, NULL);
+		_object->root = NULL;
+		_object->elementCount = 0;
+	}
+	if ((_object->backend == DICTIONARY_BACKEND_SORTEDARRAY) && _object->entries) { // has allocated buffer
 		Dictionary_Free_AllEntries(_object);
 		free(_object->entries);
-		_object->entries = NULL;
+		INSTRUMENTATION_FREE(&_object->instrumentation);
 	}
+	_object->entries = NULL;
+	_object->sharedKeys = NULL;
 }
 
 /* Frees a Dictionary object
  * CAUTION! Do not pass pointer to a permanent Dictionary variable!
  */
 void Dictionary_Free(dictionary_t* _object) {
-	if (_object->entries) { // has allocated buffer
+	INSTRUMENTATION_TRACE_FORGET(INSTRUMENTATION_OPERATION_DICTIONARY_SET, _object);
+	if (_object->pendingBuffer) { // has allocated buffer
+		free(_object->pendingBuffer);
+		INSTRUMENTATION_FREE(NULL);
+	}
+	if (_object->root) { // has allocated B+tree
+		Dictionary_BTreeFreeNode(_object, _object->root, NULL);
+	}
+	if ((_object->backend == DICTIONARY_BACKEND_SORTEDARRAY) && _object->entries) { // has allocated buffer
 		Dictionary_Free_AllEntries(_object);
 		free((void*)_object->entries);
+		INSTRUMENTATION_FREE(NULL);
 	}
 	free((void*)_object);
+	INSTRUMENTATION_FREE(NULL);
 }
 
 // Removes all the elements of the dictionary together with their allocated key and data
 // The allocated key and data aren't freed from memory but will be reused by a newer key and its data
+// The B+tree backend frees them instead, its entries don't move so they can't be reused
 void Dictionary_DeleteAllKeys(dictionary_t* const _object) {
+	if (_object->backend == DICTIONARY_BACKEND_BPLUSTREE) {
+		Dictionary_BTreeClear(_object);
+		return;
+	}
+	if (_object->sharedKeys) { // only the data buffers are reused
+		for (size_t i = 0; i < _object->elementCount; i++) {
+			Dictionary_ReleaseSharedKey(_object, &_object->entries[i]);
+		}
+	}
 	_object->elementCount = 0;
+	_object->pendingCount = 0;
 }
 
-// Removes the element from the dictionary
-// The allocated key and data aren't freed from memory but will be reused by a newer key and its data
-bool Dictionary_DeleteKey(dictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize) {
+// Dictionary_DeleteKey without recording its latency nor its trace
+static inline bool Dictionary_DeleteKeyUntimed(dictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize) {
+	if (_object->backend == DICTIONARY_BACKEND_BPLUSTREE) {
+		return Dictionary_BTreeDelete(_object, _key, _keySize);
+	}
 	for (size_t _elementIndex = 0; _elementIndex < _object->elementCount; _elementIndex++) {
 		dictionary_entry_t* const _entry = &_object->entries[_elementIndex];
 		if ((_entry->keySize != _keySize) || memcmp(_entry->key, _key, _keySize)) {
 			continue;
 		}
+		if (_object->sharedKeys) { // only the data buffer is reused
+			Dictionary_ReleaseSharedKey(_object, _entry);
+		}
 		size_t shiftedElementCount = _object->elementCount - 1 - _elementIndex;
 		if (shiftedElementCount) { // there are elements that needs to be shifted leftwards
 			dictionary_entry_t reservedEntry = *_entry;
 			memmove(_entry, _entry + 1, shiftedElementCount * sizeof(dictionary_entry_t));
+			INSTRUMENTATION_MOVE(&_object->instrumentation, shiftedElementCount * sizeof(dictionary_entry_t));
 			_entry[shiftedElementCount] = reservedEntry; // put at the back of the new last element (reserved for new key data's in the future)
 		}
+		Dictionary_RemovePendingEntry(_object, _elementIndex);
 		_object->elementCount--; // decrease element count by 1
 		return true; // key has been deleted successfully
 	}
 	return false; // key not found
 }
 
-/* Sets the data of a key
- * The key is created if it doesn't exist
- * _data = 0x0 = NULL will fill the data block with zeroes
- * _data = 0x1 will not touch the data block with zeroes, helpful when the storage element's data was previously a pointer to an allocated memory 
- * Returns a pointer to the data associated with the key in the dictionary
- * returns NULL if a the entry was not created due to a problem
- */
-void* Dictionary_Set(
+// Removes the element from the dictionary
+// The allocated key and data aren't freed from memory but will be reused by a newer key and its data
+// The B+tree backend frees them instead
+bool Dictionary_DeleteKey(dictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize) {
+	INSTRUMENTATION_TRACE(INSTRUMENTATION_OPERATION_DICTIONARY_DELETEKEY, _object, _keySize, 0, _key, _keySize);
+	INSTRUMENTATION_LATENCY_BEGIN(_start);
+	const bool _isDeleted = Dictionary_DeleteKeyUntimed(_object, _key, _keySize);
+	INSTRUMENTATION_LATENCY_END(INSTRUMENTATION_OPERATION_DICTIONARY_DELETEKEY, _start);
+	return _isDeleted;
+}
+
+// Dictionary_Set without recording its latency nor its trace
+static inline void* Dictionary_SetUntimed(
 	dictionary_t* restrict const _object,
 	const void* restrict const _key, const size_t _keySize,
 	const void* restrict const _data, const size_t _dataSize
 ) {
 	size_t _elementIndex;
 	dictionary_entry_t* _entry;
+	if (_object->backend == DICTIONARY_BACKEND_BPLUSTREE) {
+		_entry = Dictionary_BTreeSet(_object, _key, _keySize, _dataSize);
+		return _entry ? Dictionary_SetEntryData(_object, _entry, _data, _dataSize) : NULL;
+	}
 	int8_t _comparedResult = Dictionary_PickEntryIndex(_object,  _key, _keySize, &_elementIndex);
+	if (_comparedResult && _object->pendingThreshold) { // a new key is inserted among the pending keys, merged later
+		_comparedResult = Dictionary_PickPendingEntryIndex(_object, _key, _keySize, &_elementIndex);
+	}
 	if (_comparedResult == 0) { // key already exists in the list
 		_entry = &_object->entries[_elementIndex];
 	} else {
@@ -361,48 +1178,80 @@ void* Dictionary_Set(
 			 // rotate right from target index to last index (shifts to the right, while last index's contents(popped) becomes target index's contents)
 			dictionary_entry_t unusedEntry = _object->entries[_object->elementCount];
 			memmove(_entry + 1, _entry, sizeof(dictionary_entry_t) * _shiftedCount);
+			INSTRUMENTATION_MOVE(&_object->instrumentation, sizeof(dictionary_entry_t) * _shiftedCount);
 			*_entry = unusedEntry;
 		}
 		
 		// initialize key
-		if (!_entry->key) { // buffer is uninitialized
+		if (_object->sharedKeys) {
+			const dictionary_entry_t* const _sharedEntry = Dictionary_AcquireSharedKey(_object->sharedKeys, _key, _keySize);
+			if (!_sharedEntry) {
+				return NULL; // insufficient memory
+			}
+			_entry->key = _sharedEntry->key;
+			_entry->keySize = _keySize;
+		} else if (!_entry->key) { // buffer is uninitialized
 			_entry->key = malloc(_keySize + 1); // +1 for string null terminator compatibility
 			if (!_entry->key) {
 				return NULL; // failed allocating memory to our buffer
 			}
+			INSTRUMENTATION_ALLOCATION(&_object->instrumentation, _keySize + 1);
 			_entry->keyMaxSize = _keySize;
 		} else if (_entry->keyMaxSize < _keySize) { // size of the unused allocated memory is not enough
 			void* _expandedBuffer = realloc(_entry->key, _keySize + 1); // +1 for string null terminator compatibility
 			if (!_expandedBuffer) {
 				return NULL; // failed expanding our buffer's size, therefore, size requirement wasn't met
 			}
+			INSTRUMENTATION_REALLOCATION(&_object->instrumentation, _keySize + 1);
 			_entry->key = _expandedBuffer;
 			_entry->keyMaxSize = _keySize;
 		}
-		memcpy(_entry->key, _key, _keySize);
-		_entry->key[_keySize] = 0; // null terminator for string compatibility
-		_entry->keySize = _keySize;
+		if (!_object->sharedKeys) {
+			memcpy(_entry->key, _key, _keySize);
+			_entry->key[_keySize] = 0; // null terminator for string compatibility
+			_entry->keySize = _keySize;
+		}
 		//
 
 		// initialize data
 		if (!_entry->data) { // buffer is uninitialized
 			_entry->data = calloc(_dataSize + 1, 1); // initially fill the allocated memory with zeroes // +1 for string null terminator compatibility
 			if (!_entry->data) {
+				if (_object->sharedKeys) {
+					Dictionary_ReleaseSharedKey(_object, _entry);
+				}
 				return NULL; // failed allocating memory to our buffer
 			}
+			INSTRUMENTATION_ALLOCATION(&_object->instrumentation, _dataSize + 1);
 			_entry->dataMaxSize = _dataSize;
 		}
 		//
 
+		if (_object->pendingThreshold) {
+			_object->pendingCount++;
+		}
 		_object->elementCount++;
 	}
-	
+	void* const _storedData = Dictionary_SetEntryData(_object, _entry, _data, _dataSize);
+	if (_object->pendingThreshold && (_object->pendingCount >= _object->pendingThreshold)) {
+		Dictionary_MergePending(_object); // moves the entry, but not its data
+	}
+	return _storedData;
+}
+
+// Sets the data of the entry, see Dictionary_Set
+static void* Dictionary_SetEntryData(
+	dictionary_t* restrict const _object, dictionary_entry_t* restrict const _entry,
+	const void* restrict const _data, const size_t _dataSize
+) {
+	(void)_object; // only used by the instrumentation
 	// assures the minimum size of the entry's data buffer. Expanding its memory size if necessary
 	if (_entry->dataMaxSize < _dataSize) { // data requires expansion
 		uint8_t* _expandedBuffer = realloc(_entry->data, _dataSize + 1); // +1 for string null terminator compatibility
 		if (!_expandedBuffer) {
 			return NULL; // failed expanding our buffer's size, therefore, size requirement wasn't met
 		}
+		INSTRUMENTATION_REALLOCATION(&_object->instrumentation, _dataSize + 1);
 		memset(_expandedBuffer + _entry->dataMaxSize, 0, _dataSize + 1 - _entry->dataMaxSize); // fill the added memory with zeroes including the null terminator
 		_entry->data = _expandedBuffer;
 		_entry->dataMaxSize = _dataSize;
@@ -418,19 +1267,55 @@ void* Dictionary_Set(
 	break;
 	}
 	_entry->dataSize = _dataSize;
+	_entry->parsedType = DICTIONARY_PARSED_NONE; // the cached typed value is outdated
 
 	return _entry->data;
 }
 
+/* Sets the data of a key
+ * The key is created if it doesn't exist
+ * _data = 0x0 = NULL will fill the data block with zeroes
+ * _data = 0x1 will not touch the data block with zeroes, helpful when the storage element's data was previously a pointer to an allocated memory 
+ * Returns a pointer to the data associated with the key in the dictionary
+ * returns NULL if a the entry was not created due to a problem
+ */
+void* Dictionary_Set(
+	dictionary_t* restrict const _object,
+	const void* restrict const _key, const size_t _keySize,
+	const void* restrict const _data, const size_t _dataSize
+) {
+	INSTRUMENTATION_TRACE(INSTRUMENTATION_OPERATION_DICTIONARY_SET, _object, _keySize, _dataSize, _key, _keySize);
+	INSTRUMENTATION_LATENCY_BEGIN(_start);
+	void* const _storedData = Dictionary_SetUntimed(_object, _key, _keySize, _data, _dataSize);
+	INSTRUMENTATION_LATENCY_END(INSTRUMENTATION_OPERATION_DICTIONARY_SET, _start);
+	return _storedData;
+}
+
+// Dictionary_Get_Entry without recording its latency nor its trace
+static inline dictionary_entry_t* Dictionary_Get_EntryUntimed(const dictionary_t* const _object, const void* const _key, const size_t _keySize) {
+	if (_object->backend == DICTIONARY_BACKEND_BPLUSTREE) {
+		return Dictionary_BTreeGet(_object, _key, _keySize);
+	}
+	size_t _elementIndex;
+	if (!Dictionary_PickEntryIndex(_object,  _key, _keySize, &_elementIndex)) {
+		return &_object->entries[_elementIndex];
+	}
+	return (_object->pendingCount && !Dictionary_PickPendingEntryIndex(_object, _key, _keySize, &_elementIndex)) ? &_object->entries[_elementIndex] : NULL;
+}
+
 /* Searches the key inside the dictionary
  * if key is found, returns a pointer to the entry structure containing the key-value pair in the dictionary.
  * Returns NULL pointer if the Dictionary has no element with key
  * WARNING: This function is directly accessing a memory region that dynamically changes upon Adding/Deleting Entries
  * Not recommended to be used unless you know what you're doing
+ * The entries of the B+tree backend never move, they stay valid until their key is deleted
  */
 dictionary_entry_t* Dictionary_Get_Entry(const dictionary_t* const _object, const void* const _key, const size_t _keySize) {
-	size_t _elementIndex;
-	return Dictionary_PickEntryIndex(_object,  _key, _keySize, &_elementIndex) ? NULL : &_object->entries[_elementIndex];
+	INSTRUMENTATION_TRACE(INSTRUMENTATION_OPERATION_DICTIONARY_GETENTRY, _object, _keySize, 0, _key, _keySize);
+	INSTRUMENTATION_LATENCY_BEGIN(_start);
+	dictionary_entry_t* const _entry = Dictionary_Get_EntryUntimed(_object, _key, _keySize);
+	INSTRUMENTATION_LATENCY_END(INSTRUMENTATION_OPERATION_DICTIONARY_GETENTRY, _start);
+	return _entry;
 }
 
 /* Searches the key inside the dictionary
@@ -453,6 +1338,240 @@ void* Dictionary_Get(
 	return _entry->data;
 }
 
+// ---------------------------------------------------------------- typed values
+
+#define DICTIONARY_MAXEXACTPOWEROF10 22                 // 10^22 is the greatest power of 10 exactly representable as a double
+#define DICTIONARY_MAXEXACTMANTISSA (1ULL << 53)        // integers up to 2^53 are exactly representable as a double
+
+static inline bool Dictionary_IsSpace(const uint8_t _character) {
+	return (_character == ' ') || ((_character >= '\t') && (_character <= '\r'));
+}
+
+// narrows [*_begin, *_end) to the data without its leading and trailing whitespaces
+static void Dictionary_TrimData(const uint8_t** restrict const _begin, const uint8_t** restrict const _end) {
+	while ((*_begin < *_end) && Dictionary_IsSpace(**_begin)) {
+		(*_begin)++;
+	}
+	while ((*_end > *_begin) && Dictionary_IsSpace((*_end)[-1])) {
+		(*_end)--;
+	}
+}
+
+/* Accumulates the decimal digits starting at _text into *_value, 8 digits at a time while possible
+ * *_digitCount receives the count of digits, *_significantCount is increased by the count of significant digits
+ * Only the first 19 significant digits are accumulated, so *_value can't overflow
+ * Returns the first non digit character
+ */
+static const uint8_t* Dictionary_ParseDigits(
+	const uint8_t* _text, const uint8_t* const _end,
+	uint64_t* restrict const _value, size_t* restrict const _digitCount, size_t* restrict const _significantCount
+) {
+	const uint8_t* const _begin = _text;
+	uint64_t _accumulated = *_value;
+	size_t _significant = *_significantCount;
+	if (!_significant) {
+		while ((_text < _end) && (*_text == '0')) { // leading zeroes aren't significant
+			_text++;
+		}
+	}
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	while (((size_t)(_end - _text) >= 8) && (_significant <= (19 - 8))) {
+		uint64_t _chunk;
+		memcpy(&_chunk, _text, sizeof(uint64_t));
+		_chunk -= 0x3030303030303030ULL; // '0' becomes 0 in every byte
+		if (((_chunk + 0x7676767676767676ULL) | _chunk) & 0x8080808080808080ULL) {
+			break; // a character isn't a digit
+		}
+		// combines adjacent digits: 8 x 1 digit -> 4 x 2 digits -> 2 x 4 digits -> 1 x 8 digits
+		_chunk = (_chunk * 10) + (_chunk >> 8);
+		_chunk = (((_chunk & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32)))
+			+ (((_chunk >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+		_accumulated = (_accumulated * 100000000ULL) + _chunk;
+		_text += 8;
+		_significant += 8;
+	}
+#endif
+	for (; (_text < _end) && ((uint8_t)(*_text - '0') <= 9); _text++) {
+		if (_significant < 19) {
+			_accumulated = (_accumulated * 10) + (*_text - '0');
+		}
+		_significant++;
+	}
+	*_value = _accumulated;
+	*_digitCount = _text - _begin;
+	*_significantCount = _significant;
+	return _text;
+}
+
+// parses a trimmed optionally signed decimal integer, returns false if it has other characters or overflows
+static bool Dictionary_ParseInt64(const uint8_t* _text, const uint8_t* const _end, int64_t* const out_value) {
+	const bool _isNegative = (_text < _end) && (*_text == '-');
+	if ((_text < _end) && ((*_text == '-') || (*_text == '+'))) {
+		_text++;
+	}
+	uint64_t _magnitude = 0;
+	size_t _digitCount, _significantCount = 0;
+	if ((Dictionary_ParseDigits(_text, _end, &_magnitude, &_digitCount, &_significantCount) != _end) || !_digitCount) {
+		return false; // not an integer
+	}
+	if ((_significantCount > 19) || (_magnitude > ((uint64_t)INT64_MAX + _isNegative))) {
+		return false; // overflow
+	}
+	*out_value = _isNegative ? (int64_t)(0 - _magnitude) : (int64_t)_magnitude;
+	return true;
+}
+
+/* parses a trimmed decimal floating point number
+ * Numbers whose mantissa has at most 53 bits and whose exponent is at most 22 are converted exactly by one multiplication or division (Clinger's fast path)
+ * Every other number, including inf and nan, is converted by strtod
+ */
+static bool Dictionary_ParseDouble(const uint8_t* const _begin, const uint8_t* const _end, double* const out_value) {
+	static const double _powersOf10[DICTIONARY_MAXEXACTPOWEROF10 + 1] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+	const uint8_t* _text = _begin;
+	const bool _isNegative = (_text < _end) && (*_text == '-');
+	if ((_text < _end) && ((*_text == '-') || (*_text == '+'))) {
+		_text++;
+	}
+	uint64_t _mantissa = 0;
+	size_t _integerDigitCount, _fractionDigitCount = 0, _significantCount = 0;
+	_text = Dictionary_ParseDigits(_text, _end, &_mantissa, &_integerDigitCount, &_significantCount);
+	if ((_text < _end) && (*_text == '.')) {
+		_text = Dictionary_ParseDigits(_text + 1, _end, &_mantissa, &_fractionDigitCount, &_significantCount);
+	}
+	int64_t _exponent = 0;
+	bool _isValid = (_integerDigitCount || _fractionDigitCount);
+	if (_isValid && (_text < _end) && ((*_text | 0x20) == 'e')) {
+		const uint8_t* _exponentText = _text + 1;
+		const bool _isExponentNegative = (_exponentText < _end) && (*_exponentText == '-');
+		if ((_exponentText < _end) && ((*_exponentText == '-') || (*_exponentText == '+'))) {
+			_exponentText++;
+		}
+		uint64_t _exponentMagnitude = 0;
+		size_t _exponentDigitCount, _exponentSignificantCount = 0;
+		_text = Dictionary_ParseDigits(_exponentText, _end, &_exponentMagnitude, &_exponentDigitCount, &_exponentSignificantCount);
+		_isValid = (_exponentDigitCount != 0);
+		_exponent = (_exponentSignificantCount > 6) ? 1000000 : (int64_t)_exponentMagnitude; // far beyond the range of a double
+		if (_isExponentNegative) {
+			_exponent = -_exponent;
+		}
+	}
+	if (_isValid && (_text == _end) && (_significantCount <= 19) && (_mantissa <= DICTIONARY_MAXEXACTMANTISSA)) {
+		_exponent -= (int64_t)_fractionDigitCount;
+		if ((_exponent >= -DICTIONARY_MAXEXACTPOWEROF10) && (_exponent <= DICTIONARY_MAXEXACTPOWEROF10)) {
+			double _value = (double)_mantissa;
+			_value = (_exponent < 0) ? (_value / _powersOf10[-_exponent]) : (_value * _powersOf10[_exponent]);
+			*out_value = _isNegative ? -_value : _value;
+			return true;
+		}
+	}
+	// slow path, the data is null terminated
+	char* _parsedEnd;
+	const double _value = strtod((const char*)_begin, &_parsedEnd);
+	if (((const uint8_t*)_parsedEnd == _begin) || ((const uint8_t*)_parsedEnd != _end)) {
+		return false; // not a number
+	}
+	*out_value = _value;
+	return true;
+}
+
+// parses a trimmed case insensitive true/false, yes/no, on/off or 1/0
+static bool Dictionary_ParseBool(const uint8_t* const _text, const uint8_t* const _end, bool* const out_value) {
+	static const struct {
+		const char* word;
+		bool value;
+	} _words[] = {
+		{"true", true}, {"false", false}, {"yes", true}, {"no", false},
+		{"on", true}, {"off", false}, {"1", true}, {"0", false}
+	};
+	const size_t _length = _end - _text;
+	char _lowered[5];
+	if (!_length || (_length > sizeof(_lowered))) {
+		return false; // no such word
+	}
+	for (size_t i = 0; i < _length; i++) {
+		_lowered[i] = ((_text[i] >= 'A') && (_text[i] <= 'Z')) ? (char)(_text[i] | 0x20) : (char)_text[i];
+	}
+	for (size_t i = 0; i < (sizeof(_words) / sizeof(_words[0])); i++) {
+		if ((strlen(_words[i].word) == _length) && !memcmp(_words[i].word, _lowered, _length)) {
+			*out_value = _words[i].value;
+			return true;
+		}
+	}
+	return false;
+}
+
+/* Finds the entry of the key and parses its data as _type, unless its parsed value is already cached
+ * Returns NULL if the key doesn't exist or its data isn't a valid value of the type
+ */
+static const dictionary_entry_t* Dictionary_GetParsedEntry(dictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize, const dictionary_parsedtype_t _type) {
+	dictionary_entry_t* const _entry = Dictionary_Get_Entry(_object, _key, _keySize);
+	if (!_entry) {
+		return NULL; // entry not found
+	}
+	if ((_entry->parsedType & ~DICTIONARY_PARSED_INVALID) != _type) { // not cached
+		const uint8_t* _begin = _entry->data;
+		const uint8_t* _end = _begin + _entry->dataSize;
+		Dictionary_TrimData(&_begin, &_end);
+		bool _isValid = false;
+		switch (_type) {
+		case DICTIONARY_PARSED_INT64:
+			_isValid = Dictionary_ParseInt64(_begin, _end, &_entry->parsedValue.asInt64);
+		break; case DICTIONARY_PARSED_DOUBLE:
+			_isValid = Dictionary_ParseDouble(_begin, _end, &_entry->parsedValue.asDouble);
+		break; case DICTIONARY_PARSED_BOOL:
+			_isValid = Dictionary_ParseBool(_begin, _end, &_entry->parsedValue.asBool);
+		break; default:
+		break;
+		}
+		_entry->parsedType = _isValid ? _type : (_type | DICTIONARY_PARSED_INVALID);
+	}
+	return (_entry->parsedType & DICTIONARY_PARSED_INVALID) ? NULL : _entry;
+}
+
+/* Reads the data of a key as a decimal integer, ignoring leading and trailing whitespaces
+ * The parsed value is cached inside the entry until its data is set again, so repeated reads don't parse
+ * Data modified through its pointer must be set again (e.g. Dictionary_Set with _data = 0x1) to refresh the cached value
+ * WARNING: writes the cache, so concurrent readers must hold exclusive access to the Dictionary
+ * Returns false if the key doesn't exist, or its data isn't an integer or doesn't fit in int64_t
+ */
+bool Dictionary_GetInt64(dictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize, int64_t* restrict const out_value) {
+	const dictionary_entry_t* const _entry = Dictionary_GetParsedEntry(_object, _key, _keySize, DICTIONARY_PARSED_INT64);
+	if (!_entry) {
+		return false; // not found or invalid
+	}
+	*out_value = _entry->parsedValue.asInt64;
+	return true;
+}
+
+/* Reads the data of a key as a decimal floating point number, ignoring leading and trailing whitespaces
+ * Caches the parsed value like Dictionary_GetInt64
+ * Returns false if the key doesn't exist, or its data isn't a number
+ */
+bool Dictionary_GetDouble(dictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize, double* restrict const out_value) {
+	const dictionary_entry_t* const _entry = Dictionary_GetParsedEntry(_object, _key, _keySize, DICTIONARY_PARSED_DOUBLE);
+	if (!_entry) {
+		return false; // not found or invalid
+	}
+	*out_value = _entry->parsedValue.asDouble;
+	return true;
+}
+
+/* Reads the data of a key as a case insensitive true/false, yes/no, on/off or 1/0, ignoring leading and trailing whitespaces
+ * Caches the parsed value like Dictionary_GetInt64
+ * Returns false if the key doesn't exist, or its data isn't one of those words
+ */
+bool Dictionary_GetBool(dictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize, bool* restrict const out_value) {
+	const dictionary_entry_t* const _entry = Dictionary_GetParsedEntry(_object, _key, _keySize, DICTIONARY_PARSED_BOOL);
+	if (!_entry) {
+		return false; // not found or invalid
+	}
+	*out_value = _entry->parsedValue.asBool;
+	return true;
+}
+
 // Checks if the dictionary has a key
 bool Dictionary_Has_Key(const dictionary_t* const _object, const void* const _key, const size_t _keySize) {
 	return Dictionary_Get_Entry(_object, _key, _keySize);
@@ -460,8 +1579,9 @@ bool Dictionary_Has_Key(const dictionary_t* const _object, const void* const _ke
 
 // Checks if the dictionary has a key with data
 bool Dictionary_Has_Data(const dictionary_t* const _object, const void* const _data, const size_t _dataSize) {
-	const dictionary_entry_t* const outofBoundsPtr = _object->entries + _object->elementCount;
-	for (const dictionary_entry_t* _entry = _object->entries; _entry < outofBoundsPtr; _entry++) {
+	dictionary_iterator_t _iterator;
+	Dictionary_GetIterator(_object, NULL, 0, &_iterator);
+	for (const dictionary_entry_t* _entry; (_entry = Dictionary_NextEntry(&_iterator));) {
 		if ((_dataSize == _entry->dataSize) && !memcmp(_data, _entry->data, _dataSize)) {
 			return true;
 		}
@@ -469,12 +1589,116 @@ bool Dictionary_Has_Data(const dictionary_t* const _object, const void* const _d
 	return false;
 }
 
+/* Positions the iterator at the first entry whose key is not less than the key, _key = NULL starts at the first entry
+ * Dictionary_NextEntry then returns the entries in ascending key order
+ * WARNING: setting a new key or deleting a key invalidates the iterator
+ */
+void Dictionary_GetIterator(
+	const dictionary_t* restrict const _object,
+	const void* restrict const _key, const size_t _keySize,
+	dictionary_iterator_t* restrict const out_iterator
+) {
+	out_iterator->dictionary = _object;
+	out_iterator->leaf = NULL;
+	if (_object->backend == DICTIONARY_BACKEND_BPLUSTREE) {
+		if (!_key) { // leftmost leaf
+			const dictionary_btreenode_t* _node = _object->root;
+			while (!_node->isLeaf) {
+				_node = ((const dictionary_btreeinner_t*)_node)->children[0];
+			}
+			out_iterator->leaf = _node;
+			out_iterator->index = 0;
+			return;
+		}
+		const uint64_t _summary = Dictionary_GetKeySummary(_key, _keySize);
+		const dictionary_btreeleaf_t* const _leaf = Dictionary_BTreeDescend(_object, _key, _keySize, _summary, NULL);
+		Dictionary_BTreeFindInLeaf(_leaf, _key, _keySize, _summary, &out_iterator->index);
+		out_iterator->leaf = _leaf;
+		return;
+	}
+	if (!_key) {
+		out_iterator->index = 0;
+		out_iterator->pendingIndex = _object->elementCount - _object->pendingCount;
+		return;
+	}
+	size_t _elementIndex;
+	int8_t _comparedResult = Dictionary_PickEntryIndex(_object, _key, _keySize, &_elementIndex);
+	out_iterator->index = _elementIndex + (_comparedResult > 0);
+	_comparedResult = Dictionary_PickPendingEntryIndex(_object, _key, _keySize, &_elementIndex);
+	out_iterator->pendingIndex = _elementIndex + (_comparedResult > 0);
+}
+
+// Returns the next entry of the iterator, NULL after the last entry
+dictionary_entry_t* Dictionary_NextEntry(dictionary_iterator_t* const _iterator) {
+	const dictionary_t* const _object = _iterator->dictionary;
+	if (_object->backend == DICTIONARY_BACKEND_SORTEDARRAY) { // merges the sorted entries with the pending entries
+		const bool _hasSorted = (_iterator->index < (_object->elementCount - _object->pendingCount));
+		const bool _hasPending = (_iterator->pendingIndex < _object->elementCount);
+		if (_hasSorted
+		&& (!_hasPending || (Dictionary_CompareEntries(&_object->entries[_iterator->index], &_object->entries[_iterator->pendingIndex]) < 0))) {
+			return &_object->entries[_iterator->index++];
+		}
+		return _hasPending ? &_object->entries[_iterator->pendingIndex++] : NULL;
+	}
+	const dictionary_btreeleaf_t* _leaf = _iterator->leaf;
+	while (_leaf && (_iterator->index >= _leaf->node.count)) { // continue at the next leaf
+		_leaf = _leaf->next;
+		_iterator->index = 0;
+	}
+	_iterator->leaf = _leaf;
+	return _leaf ? _leaf->entries[_iterator->index++] : NULL;
+}
+
+/* Appends the entries whose keys are sorted in ascending order, and greater than every key of the dictionary
+ * Only the key, keySize, data and dataSize of the entries are read. Their data is copied like Dictionary_Set
+ * The B+tree backend appends them into full leaves, without searching nor splitting its nodes in half
+ * Returns false if the keys aren't sorted, nothing is appended
+ * Returns false due to insufficient memory, the entries appended before the failure remain
+ */
+bool Dictionary_BulkLoad(dictionary_t* restrict const _object, const dictionary_entry_t* restrict const _entries, const size_t _count) {
+	const dictionary_entry_t* _previousEntry = NULL;
+	if (_object->backend == DICTIONARY_BACKEND_SORTEDARRAY) {
+		Dictionary_MergePending(_object);
+	}
+	if (_object->elementCount) { // greatest key of the dictionary
+		if (_object->backend == DICTIONARY_BACKEND_BPLUSTREE) {
+			dictionary_btreepath_t _path;
+			const dictionary_btreeleaf_t* const _leaf = Dictionary_BTreeDescendRightmost(_object, &_path);
+			_previousEntry = _leaf->entries[_leaf->node.count - 1];
+		} else {
+			_previousEntry = &_object->entries[_object->elementCount - 1];
+		}
+	}
+	for (size_t i = 0; i < _count; _previousEntry = &_entries[i++]) {
+		if (_previousEntry
+		&& (CompareMemoryBlocks(_entries[i].key, _entries[i].keySize, _previousEntry->key, _previousEntry->keySize) <= 0)) {
+			return false; // keys aren't sorted
+		}
+	}
+	if (!Dictionary_ReserveElements(_object, _count)) {
+		return false; // insufficient memory
+	}
+	for (size_t i = 0; i < _count; i++) {
+		const dictionary_entry_t* const _source = &_entries[i];
+		if (_object->backend == DICTIONARY_BACKEND_BPLUSTREE) {
+			dictionary_entry_t* const _entry = Dictionary_BTreeAppend(_object, _source->key, _source->keySize, _source->dataSize);
+			if (!_entry || !Dictionary_SetEntryData(_object, _entry, _source->data, _source->dataSize)) {
+				return false; // insufficient memory
+			}
+		} else if (!Dictionary_SetUntimed(_object, _source->key, _source->keySize, _source->data, _source->dataSize)) {
+			return false; // insufficient memory
+		}
+	}
+	return true;
+}
+
 // Merges the source's contents with the destination's contents
 // when overWriteValues = true, the source's value is used on existing destination keys
 // when overWriteValues = false, the existing destination keys are not overwritten
 bool Dictionary_Merge(dictionary_t* restrict _destination, const dictionary_t* restrict const _source, const bool overWriteValues) {
-	const dictionary_entry_t* const outofBoundsPtr = _source->entries + _source->elementCount;
-	for (const dictionary_entry_t* sourceEntry = _source->entries; sourceEntry < outofBoundsPtr; sourceEntry++) {
+	dictionary_iterator_t _iterator;
+	Dictionary_GetIterator(_source, NULL, 0, &_iterator);
+	for (const dictionary_entry_t* sourceEntry; (sourceEntry = Dictionary_NextEntry(&_iterator));) {
 		if ((overWriteValues || !Dictionary_Get_Entry(_destination, sourceEntry->key, sourceEntry->keySize)) // entry can be added/modified
 		&& !Dictionary_Set(_destination, sourceEntry->key, sourceEntry->keySize, sourceEntry->data, sourceEntry->dataSize)) {
 			return false; // failed to add/modify entry
@@ -486,13 +1710,14 @@ bool Dictionary_Merge(dictionary_t* restrict _destination, const dictionary_t* r
 // Copies of the source's contents to the destination
 // set _destination = NULL to create a new dictionary object
 dictionary_t* Dictionary_Clone(dictionary_t* restrict _destination, const dictionary_t* restrict const _source) {
-	_destination = Dictionary_InitWithMinSize(_destination, _source->maxElementCount, _source->expansionRate - 1.0);
+	_destination = Dictionary_InitWithBackend(_destination, _source->maxElementCount, _source->expansionRate - 1.0, _source->backend);
 	if (!_destination) {
 		return NULL;
 	}
 	
-	for (size_t i = 0; i < _source->elementCount; i++) {
-		const dictionary_entry_t* const _entry = &_source->entries[i];
+	dictionary_iterator_t _iterator;
+	Dictionary_GetIterator(_source, NULL, 0, &_iterator);
+	for (const dictionary_entry_t* _entry; (_entry = Dictionary_NextEntry(&_iterator));) {
 		Dictionary_Set(_destination, _entry->key, _entry->keySize, _entry->data, _entry->dataSize);
 	}
 
@@ -501,9 +1726,12 @@ dictionary_t* Dictionary_Clone(dictionary_t* restrict _destination, const dictio
 
 /* Properly initializes the Dictionary variable.
  * Allocates memory to the Dictionary variable if its current value is NULL
+ * A permanent variable must have its entries set to NULL, or be already initialized
  * Reallocates memory to the Dictionary's buffer that satisfy the required minimum size
+ * _minCount and _expansionRate only apply to the SORTEDARRAY backend
+ * Switching the backend of an initialized Dictionary frees the storage of its previous backend
  */
-dictionary_t* Dictionary_InitWithMinSize(dictionary_t* _object, const size_t _minCount, const float _expansionRate) {
+dictionary_t* Dictionary_InitWithBackend(dictionary_t* _object, const size_t _minCount, const float _expansionRate, const dictionary_backend_t _backend) {
 	bool _mallocVar;
 	if (!_object) { // if we are requesting to initialize it
 		_object = malloc(sizeof(dictionary_t));
@@ -515,7 +1743,41 @@ dictionary_t* Dictionary_InitWithMinSize(dictionary_t* _object, const size_t _mi
 	} else {
 		_mallocVar = false;
 	}
+	if (!_object->entries) { // isn't initialized yet, only the entries are known
+		_object->backend = _backend;
+		_object->root = NULL;
+		_object->pendingBuffer = NULL;
+		_object->pendingThreshold = 0;
+		_object->sharedKeys = NULL;
+	} else if (_object->backend != _backend) {
+		Dictionary_Free_Storage(_object);
+		_object->backend = _backend;
+	} else if (_object->sharedKeys) { // reused buffers can't hold shared keys
+		Dictionary_DeleteAllKeys(_object);
+	}
+	INSTRUMENTATION_RESET(&_object->instrumentation);
+	if (_mallocVar) {
+		INSTRUMENTATION_ALLOCATION(&_object->instrumentation, sizeof(dictionary_t));
+	}
 	_object->expansionRate = _expansionRate + 1.0;
+	_object->pendingCount = 0;
+	if (_backend == DICTIONARY_BACKEND_BPLUSTREE) {
+		if (_object->root) { // tree is already initialized
+			Dictionary_BTreeClear(_object);
+		} else {
+			_object->root = Dictionary_BTreeNewLeaf(_object);
+			if (!_object->root) {
+				if (_mallocVar) {
+					free(_object);
+				}
+				return NULL; // failed allocating the root of our dictionary variable
+			}
+			_object->entries = &dictionaryBTreeEntries;
+		}
+		_object->maxElementCount = 0;
+		_object->elementCount = 0;
+		return _object; // initialization sucessful
+	}
 	if (!_object->entries) { // buffer isn't initialized yet
 		_object->entries = calloc(_minCount, sizeof(dictionary_entry_t)); // make sure to pad the entire memory with zeros
 		if (!_object->entries) {
@@ -524,6 +1786,7 @@ dictionary_t* Dictionary_InitWithMinSize(dictionary_t* _object, const size_t _mi
 			}
 			return NULL; // failed allocating buffer to our dictionary variable
 		}
+		INSTRUMENTATION_ALLOCATION(&_object->instrumentation, _minCount * sizeof(dictionary_entry_t));
 		_object->maxElementCount = _minCount;
 	} else if (!Dictionary_SetMinElements(_object, _minCount)) {
 		if (_mallocVar) {
@@ -3,7 +3,7 @@
  * @Author: Aldrin John O. Manalansan (ajom)
  * @Email: aldrinjohnolaermanalansan@gmail.com
  * @Brief: Dynamically construct a dictionary of key-value pairs
- * @LastUpdate: June 17, 2025
+ * @LastUpdate: October 19, 2026
  * 
  * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
  * 
@@ -22,9 +22,20 @@
 #include <stddef.h>
 #include <limits.h>
 
+#include "Instrumentation.h"
+
 #define DICTIONARY_DEFAULT_INITIALCOUNT 30
 #define DICTIONARY_DEFAULT_EXPANSIONRATE 0.5
 
+// which typed value of the data is cached inside its entry, see Dictionary_GetInt64
+typedef enum {
+	DICTIONARY_PARSED_NONE,
+	DICTIONARY_PARSED_INT64,
+	DICTIONARY_PARSED_DOUBLE,
+	DICTIONARY_PARSED_BOOL,
+	DICTIONARY_PARSED_INVALID = 0x80   // flag, the data isn't a valid value of the type
+} dictionary_parsedtype_t;
+
 typedef struct {
     uint8_t* key;
     uint8_t* data;
@@ -32,15 +43,48 @@ typedef struct {
     size_t dataMaxSize;
     size_t keySize;
     size_t dataSize;
+    union {
+        int64_t asInt64;
+        double asDouble;
+        bool asBool;
+    } parsedValue;          // the data parsed by the last typed getter
+    uint8_t parsedType;     // dictionary_parsedtype_t of parsedValue, reset whenever the data is set
 } dictionary_entry_t;
 
-typedef struct {
-    dictionary_entry_t* entries;
-    size_t elementCount;    // how much elements is currently valid in the dictionary
-    size_t maxElementCount; // max number of elements
-	float expansionRate;    // how much elements is additionally added everytime we expand
+/* How the dictionary stores its sorted entries
+ * SORTEDARRAY: one array, lookups are a binary search but inserting a new key shifts every greater key
+ * BPLUSTREE: 512 byte nodes searched through 64-bit key summaries, O(log n) inserts and deletions.
+ *            Its entries never move in memory, and its leaves are linked for range scans
+ */
+typedef enum {
+	DICTIONARY_BACKEND_SORTEDARRAY,
+	DICTIONARY_BACKEND_BPLUSTREE
+} dictionary_backend_t;
+
+typedef struct dictionary_s {
+    dictionary_entry_t* entries;    // entries of the SORTEDARRAY backend, a placeholder with the BPLUSTREE backend, NULL while uninitialized
+    size_t elementCount;            // how much elements is currently valid in the dictionary
+    size_t maxElementCount;         // max number of elements of the SORTEDARRAY backend
+	float expansionRate;            // how much elements is additionally added everytime we expand
+    dictionary_backend_t backend;
+    void* root;                     // root node of the BPLUSTREE backend
+    size_t pendingCount;            // entries at the end of the SORTEDARRAY entries sorted apart, see Dictionary_SetPendingThreshold
+    size_t pendingThreshold;        // pending entries that trigger their merge, 0 if new keys are inserted among the sorted entries
+    dictionary_entry_t* pendingBuffer; // merge buffer of pendingThreshold entries
+    struct dictionary_s* sharedKeys; // key table referenced by the keys instead of copies, see Dictionary_SetSharedKeys
+#ifdef DDS_INSTRUMENTATION
+    instrumentation_counters_t instrumentation;
+#endif
 } dictionary_t;
 
+// Walks the entries in ascending key order, see Dictionary_GetIterator
+typedef struct {
+    const dictionary_t* dictionary;
+    const void* leaf;       // current leaf of the BPLUSTREE backend
+    size_t index;           // index of the next entry inside the entries or the leaf
+    size_t pendingIndex;    // index of the next pending entry of the SORTEDARRAY backend
+} dictionary_iterator_t;
+
 bool Dictionary_SetMinElements(dictionary_t* const _object, const size_t _minCount);
 bool Dictionary_ReserveElements(dictionary_t* const _object, const size_t _reservedElementCount);
 void Dictionary_Free_Entry(dictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize);
@@ -61,9 +105,27 @@ void* Dictionary_Get(
 	size_t* restrict const out_DataSize
 );
 bool Dictionary_Has_Key(const dictionary_t* const _object, const void* const _key, const size_t _keySize);
+bool Dictionary_GetInt64(dictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize, int64_t* restrict const out_value);
+bool Dictionary_GetDouble(dictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize, double* restrict const out_value);
+bool Dictionary_GetBool(dictionary_t* restrict const _object, const void* restrict const _key, const size_t _keySize, bool* restrict const out_value);
 bool Dictionary_Has_Data(const dictionary_t* const _object, const void* const _data, const size_t _dataSize);
+int8_t Dictionary_CompareKeys(const void* const _key_A, const size_t _keySize_A, const void* const _key_B, const size_t _keySize_B);
+void Dictionary_GetIterator(
+	const dictionary_t* restrict const _object,
+	const void* restrict const _key, const size_t _keySize,
+	dictionary_iterator_t* restrict const out_iterator
+);
+dictionary_entry_t* Dictionary_NextEntry(dictionary_iterator_t* const _iterator);
+bool Dictionary_SetPendingThreshold(dictionary_t* const _object, const size_t _pendingThreshold);
+void Dictionary_MergePending(dictionary_t* const _object);
+bool Dictionary_SetSharedKeys(dictionary_t* restrict const _object, dictionary_t* restrict const _keyTable);
+bool Dictionary_BulkLoad(dictionary_t* restrict const _object, const dictionary_entry_t* restrict const _entries, const size_t _count);
 bool Dictionary_Merge(dictionary_t* restrict _destination, const dictionary_t* restrict const _source, const bool overWriteValues);
 dictionary_t* Dictionary_Clone(dictionary_t* restrict _destination, const dictionary_t* restrict const _source);
-dictionary_t* Dictionary_InitWithMinSize(dictionary_t* _object, const size_t _minCount, const float _expansionRate);
+dictionary_t* Dictionary_InitWithBackend(dictionary_t* _object, const size_t _minCount, const float _expansionRate, const dictionary_backend_t _backend);
+
+#define Dictionary_InitWithMinSize(_object, _minCount, _expansionRate) Dictionary_InitWithBackend(_object, _minCount, _expansionRate, DICTIONARY_BACKEND_SORTEDARRAY)
+#define Dictionary_InitBPlusTree(_object) Dictionary_InitWithBackend(_object, 0, DICTIONARY_DEFAULT_EXPANSIONRATE, DICTIONARY_BACKEND_BPLUSTREE)
+#define Dictionary_InitKeyTable(_object) Dictionary_InitBPlusTree(_object) // see Dictionary_SetSharedKeys
 
 #define Dictionary_Init(_object) Dictionary_InitWithMinSize(_object, DICTIONARY_DEFAULT_INITIALCOUNT, DICTIONARY_DEFAULT_EXPANSIONRATE)
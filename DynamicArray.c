@@ -3,7 +3,7 @@
  * @Author: Aldrin John O. Manalansan (ajom)
  * @Email: aldrinjohnolaermanalansan@gmail.com
  * @Brief: Dynamically construct Arrays with arbitrary size
- * @LastUpdate: June 17, 2025
+ * @LastUpdate: October 19, 2026
  * 
  * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
  * 
@@ -29,6 +29,8 @@ bool DynamicArray_SetMinElementsWithSize(dynamicarray_t* const _object, const si
 	if (!expandedBuffer) {
 		return false; // failed expanding our buffer's size, therefore initialization requirement wasn't met
 	}
+	INSTRUMENTATION_REALLOCATION(&_object->instrumentation, requiredSize);
+	INSTRUMENTATION_GROWTH(&_object->instrumentation, requiredSize);
 	_object->array = expandedBuffer;
 	_object->maxElementCount = _minCount;
 	_object->elementSize = _elementSize;
@@ -46,9 +48,11 @@ bool DynamicArray_ReserveElements(dynamicarray_t* const _object, const size_t _r
 
 // Frees the DynamicArray's Buffer
 void DynamicArray_FreeBuffer(dynamicarray_t* const _object) {
+	INSTRUMENTATION_TRACE_FORGET(INSTRUMENTATION_OPERATION_DYNAMICARRAY_PUSH, _object);
 	if (_object->array) { // has allocated buffer
 		free(_object->array);
 		_object->array = NULL;
+		INSTRUMENTATION_FREE(&_object->instrumentation);
 	}
 }
 
@@ -56,14 +60,17 @@ void DynamicArray_FreeBuffer(dynamicarray_t* const _object) {
  * CAUTION! Do not pass pointer to a permanent DynamicArray variable!
  */
 void DynamicArray_Free(dynamicarray_t* _object) {
+	INSTRUMENTATION_TRACE_FORGET(INSTRUMENTATION_OPERATION_DYNAMICARRAY_PUSH, _object);
 	if (_object->array) { // has allocated buffer
 		free((void*)_object->array);
+		INSTRUMENTATION_FREE(NULL);
 	}
 	free((void*)_object);
+	INSTRUMENTATION_FREE(NULL);
 }
 
-// Removes a specific element from the dynamicArray
-bool DynamicArray_Delete(dynamicarray_t* const _object, const size_t _deletedElementIndex) {
+// DynamicArray_Delete without recording its latency nor its trace
+static inline bool DynamicArray_DeleteUntimed(dynamicarray_t* const _object, const size_t _deletedElementIndex) {
 	if (_deletedElementIndex >= _object->elementCount) {
 		return false; // index out of bounds
 	}
@@ -76,15 +83,22 @@ bool DynamicArray_Delete(dynamicarray_t* const _object, const size_t _deletedEle
 			(const void*)(basePtr + _object->elementSize),
 			shiftedElementCount * _object->elementSize
 		);
+		INSTRUMENTATION_MOVE(&_object->instrumentation, shiftedElementCount * _object->elementSize);
 	}
 	return true; // element has been deleted successfully
 }
 
-/* Inserts the data at the specified element index, shifting all the higher ordered elements by 1
- * The last element index is used if the specified element index is out of bounds.
- * Supports overlapping data
- */
-bool DynamicArray_Insert(dynamicarray_t* restrict const _object, const size_t _index, const void* restrict const _value) {
+// Removes a specific element from the dynamicArray
+bool DynamicArray_Delete(dynamicarray_t* const _object, const size_t _deletedElementIndex) {
+	INSTRUMENTATION_TRACE(INSTRUMENTATION_OPERATION_DYNAMICARRAY_DELETE, _object, _deletedElementIndex, _object->elementSize, NULL, 0);
+	INSTRUMENTATION_LATENCY_BEGIN(_start);
+	const bool _isDeleted = DynamicArray_DeleteUntimed(_object, _deletedElementIndex);
+	INSTRUMENTATION_LATENCY_END(INSTRUMENTATION_OPERATION_DYNAMICARRAY_DELETE, _start);
+	return _isDeleted;
+}
+
+// DynamicArray_Insert without recording its latency nor its trace
+static inline bool DynamicArray_InsertUntimed(dynamicarray_t* restrict const _object, const size_t _index, const void* restrict const _value) {
 	if (_index >= _object->elementCount) { // index out of bounds
 		return DynamicArray_Push(_object, _value);
 	}
@@ -95,22 +109,26 @@ bool DynamicArray_Insert(dynamicarray_t* restrict const _object, const size_t _i
 	void* const _destination = _object->array + (_index * _object->elementSize);
 	memcpy(_valuePtr, _value, _object->elementSize); // temporarily store value
 	memmove(_destination + _object->elementSize, _destination, (_object->elementCount - _index) * _object->elementSize);
+	INSTRUMENTATION_MOVE(&_object->instrumentation, (_object->elementCount - _index) * _object->elementSize);
 	memcpy(_destination, _valuePtr, _object->elementSize); // store temporary value at the index's value
 	_object->elementCount++;
 	return true;
 }
 
-// removes one element at the end of the stack
-bool DynamicArray_Pop(dynamicarray_t* const _object) {
-	if (!_object->elementCount) {
-		return false; // array already has no elements
-	}
-	_object->elementCount--; // decrease element count by 1
-	return true; // element has been deleted successfully
+/* Inserts the data at the specified element index, shifting all the higher ordered elements by 1
+ * The last element index is used if the specified element index is out of bounds.
+ * Supports overlapping data
+ */
+bool DynamicArray_Insert(dynamicarray_t* restrict const _object, const size_t _index, const void* restrict const _value) {
+	INSTRUMENTATION_TRACE(INSTRUMENTATION_OPERATION_DYNAMICARRAY_INSERT, _object, _index, _object->elementSize, NULL, 0);
+	INSTRUMENTATION_LATENCY_BEGIN(_start);
+	const bool _isInserted = DynamicArray_InsertUntimed(_object, _index, _value);
+	INSTRUMENTATION_LATENCY_END(INSTRUMENTATION_OPERATION_DYNAMICARRAY_INSERT, _start);
+	return _isInserted;
 }
 
-// Pushes a data at the end of the stack
-bool DynamicArray_Push(dynamicarray_t* restrict const _object, const void* restrict const _value) {
+// DynamicArray_Push without recording its latency nor its trace
+static inline bool DynamicArray_PushUntimed(dynamicarray_t* restrict const _object, const void* restrict const _value) {
 	if (!DynamicArray_ReserveElements(_object, 1)) {
 		return false; // insufficient memory
 	}
@@ -119,6 +137,15 @@ bool DynamicArray_Push(dynamicarray_t* restrict const _object, const void* restr
 	return true;
 }
 
+// Pushes a data at the end of the stack, expanding the array if necessary. See DynamicArray_Push
+bool DynamicArray_PushSlow(dynamicarray_t* restrict const _object, const void* restrict const _value) {
+	INSTRUMENTATION_TRACE(INSTRUMENTATION_OPERATION_DYNAMICARRAY_PUSH, _object, 0, _object->elementSize, NULL, 0);
+	INSTRUMENTATION_LATENCY_BEGIN(_start);
+	const bool _isPushed = DynamicArray_PushUntimed(_object, _value);
+	INSTRUMENTATION_LATENCY_END(INSTRUMENTATION_OPERATION_DYNAMICARRAY_PUSH, _start);
+	return _isPushed;
+}
+
 // checks if the DynamicArray has an element with value
 bool DynamicArray_HasValue(const dynamicarray_t* const _object, const void* const _value) {
 	const void* endPtr = _object->array + (_object->elementCount * _object->elementSize);
@@ -167,6 +194,10 @@ dynamicarray_t* DynamicArray_InitAll(dynamicarray_t* _object, const size_t _elem
 	} else {
 		_mallocVar = false;
 	}
+	INSTRUMENTATION_RESET(&_object->instrumentation);
+	if (_mallocVar) {
+		INSTRUMENTATION_ALLOCATION(&_object->instrumentation, sizeof(dynamicarray_t));
+	}
 	if (!_object->array) { // buffer isn't initialized yet
 		_object->array = malloc(_minCount * _elementSize);
 		if (!_object->array) {
@@ -175,6 +206,7 @@ dynamicarray_t* DynamicArray_InitAll(dynamicarray_t* _object, const size_t _elem
 			}
 			return NULL; // failed allocating buffer to our dynamicArray variable
 		}
+		INSTRUMENTATION_ALLOCATION(&_object->instrumentation, _minCount * _elementSize);
 		_object->maxElementCount = _minCount;
 	} else if (!DynamicArray_SetMinElementsWithSize(_object, _minCount, _elementSize)) {
 		if (_mallocVar) {
@@ -3,7 +3,7 @@
  * @Author: Aldrin John O. Manalansan (ajom)
  * @Email: aldrinjohnolaermanalansan@gmail.com
  * @Brief: Dynamically construct Arrays with arbitrary size
- * @LastUpdate: June 17, 2025
+ * @LastUpdate: October 18, 2026
  * 
  * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
  * 
@@ -19,6 +19,9 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <string.h>
+
+#include "Instrumentation.h"
 
 #define _object_DEFAULT_INITIALCOUNT 30
 #define _object_DEFAULT_EXPANSIONRATE 1.5
@@ -29,6 +32,9 @@ typedef struct {
     size_t maxElementCount; // max number of elements
     size_t elementSize;     // size per element
 	float expansionRate;    // how much elements is additionally added everytime we expand
+#ifdef DDS_INSTRUMENTATION
+    instrumentation_counters_t instrumentation;
+#endif
 } dynamicarray_t;
 
 bool DynamicArray_SetMinElementsWithSize(dynamicarray_t* const _object, const size_t _minCount, const size_t _elementSize);
@@ -37,12 +43,40 @@ void DynamicArray_FreeBuffer(dynamicarray_t* const _object);
 void DynamicArray_Free(dynamicarray_t* _object);
 bool DynamicArray_Delete(dynamicarray_t* const _object, const size_t _deletedElementIndex);
 bool DynamicArray_Insert(dynamicarray_t* restrict const _object, const size_t _index, const void* restrict const _value);
-bool DynamicArray_Pop(dynamicarray_t* const _object);
-bool DynamicArray_Push(dynamicarray_t* restrict const _object, const void* restrict const _value);
+bool DynamicArray_PushSlow(dynamicarray_t* restrict const _object, const void* restrict const _value);
 bool DynamicArray_HasValue(const dynamicarray_t* const _object, const void* const _value);
 size_t DynamicArray_GetElementNumberContainingValue(const dynamicarray_t* const _object, size_t _startingElementNumber, const void* const _value);
 dynamicarray_t* DynamicArray_InitAll(dynamicarray_t* _object, const size_t _elementSize, const size_t _minCount, const float _expansionRate);
 
+// Pushes a data at the end of the stack
+// copies the data inline while the array has room, only an expansion calls DynamicArray_PushSlow
+static inline bool DynamicArray_Push(dynamicarray_t* restrict const _object, const void* restrict const _value) {
+#ifdef INSTRUMENTATION_INLINE_FASTPATHS
+	if (_object->elementCount < _object->maxElementCount) {
+		memcpy((uint8_t*)_object->array + (_object->elementCount * _object->elementSize), _value, _object->elementSize);
+		_object->elementCount++;
+		return true;
+	}
+#endif
+	return DynamicArray_PushSlow(_object, _value);
+}
+
+// removes one element at the end of the stack
+static inline bool DynamicArray_Pop(dynamicarray_t* const _object) {
+	if (!_object->elementCount) {
+		return false; // array already has no elements
+	}
+	_object->elementCount--; // decrease element count by 1
+	return true; // element has been deleted successfully
+}
+
+/* Returns a pointer to the element at the index, NULL if the index is out of bounds
+ * WARNING: the pointer becomes invalid once the array expands
+ */
+static inline void* DynamicArray_Get(const dynamicarray_t* const _object, const size_t _index) {
+	return (_index < _object->elementCount) ? (uint8_t*)_object->array + (_index * _object->elementSize) : NULL;
+}
+
 #define DynamicArray_SetMinElements(_object, _minCount) DynamicArray_SetMinElementsWithSize(_object, _minCount, (_object)->elementSize)
 #define DynamicArray_Clear(_object) ((_object)->elementCount = 0)
 #define DynamicArray_Init(_object, _elementSize) DynamicArray_InitAll(_object, _elementSize, _object_DEFAULT_INITIALCOUNT, _object_DEFAULT_EXPANSIONRATE)
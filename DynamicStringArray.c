@@ -3,7 +3,7 @@
  * @Author: Aldrin John O. Manalansan (ajom)
  * @Email: aldrinjohnolaermanalansan@gmail.com
  * @Brief: Dynamically construct String Arrays with arbitrary size
- * @LastUpdate: June 17, 2025
+ * @LastUpdate: October 19, 2026
  * 
  * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
  * 
@@ -33,6 +33,8 @@ bool DynamicStringArray_SetMinElements(dynamicstringarray_t* const _object, size
 	if (!expanded) {
 		return false; // failed expanding our array's size, therefore initialization requirement wasn't met
 	}
+	INSTRUMENTATION_REALLOCATION(&_object->instrumentation, _minElementCount * sizeof(_object->array));
+	INSTRUMENTATION_GROWTH(&_object->instrumentation, _minElementCount * sizeof(_object->array));
 	_object->array = expanded;
 	_object->maxElementCount = _minElementCount;
 	return true;
@@ -48,6 +50,9 @@ bool DynamicStringArray_SetMinBufferSize(dynamicstringarray_t* const _object, si
 	if (!expanded) {
 		return false; // failed expanding our buffer's size, therefore initialization requirement wasn't met
 	}
+	INSTRUMENTATION_REALLOCATION(&_object->instrumentation, _minBufferSize);
+	INSTRUMENTATION_GROWTH(&_object->instrumentation, _minBufferSize);
+	INSTRUMENTATION_MOVE(&_object->instrumentation, _object->elementCount * sizeof(_object->array)); // pointer relocation
     const ptrdiff_t relocateOffset = (ptrdiff_t)expanded - (ptrdiff_t)_object->buffer;
 	_object->buffer = expanded;
 	_object->bufferSize = _minBufferSize;
@@ -78,13 +83,16 @@ bool DynamicStringArray_ReserveBufferSize(dynamicstringarray_t* const _object, c
 
 // Frees the DynamicStringArray's Array and Buffer memories
 void DynamicStringArray_FreeStorage(dynamicstringarray_t* const _object) {
+	INSTRUMENTATION_TRACE_FORGET(INSTRUMENTATION_OPERATION_DYNAMICSTRINGARRAY_INSERTSUBSTRING, _object);
 	if (_object->array) { // has allocated array
 		free(_object->array);
 		_object->array = NULL;
+		INSTRUMENTATION_FREE(&_object->instrumentation);
 	}
 	if (_object->buffer) { // has allocated buffer
 		free(_object->buffer);
 		_object->buffer = NULL;
+		INSTRUMENTATION_FREE(&_object->instrumentation);
 	}
 }
 
@@ -92,13 +100,17 @@ void DynamicStringArray_FreeStorage(dynamicstringarray_t* const _object) {
  * CAUTION! Do not pass pointer to a permanent DynamicStringArray variable!
  */
 void DynamicStringArray_Free(dynamicstringarray_t* _object) {
+	INSTRUMENTATION_TRACE_FORGET(INSTRUMENTATION_OPERATION_DYNAMICSTRINGARRAY_INSERTSUBSTRING, _object);
 	if (_object->array) { // has allocated array
 		free((void*)_object->array);
+		INSTRUMENTATION_FREE(NULL);
 	}
 	if (_object->array) { // has allocated buffer
 		free((void*)_object->buffer);
+		INSTRUMENTATION_FREE(NULL);
 	}
 	free((void*)_object);
+	INSTRUMENTATION_FREE(NULL);
 }
 
 /*
@@ -148,11 +160,8 @@ bool DynamicStringArray_Pop(dynamicstringarray_t* const _object) {
 	return true; // element has been deleted successfully
 }
 
-// Inserts the data at the specified element index, shifting all the higher ordered elements by 1
-// The passed index is required be in between the existing first element and the last element.
-// Use DynamicStringArray_PushSubString if you wish to insert at the end of the array
-// Does not support overlapping data
-bool DynamicStringArray_InsertSubString(
+// DynamicStringArray_InsertSubString without recording its latency nor its trace
+static inline bool DynamicStringArray_InsertSubStringUntimed(
 	dynamicstringarray_t* restrict const _object, const size_t _index,
 	const char* restrict const _string, size_t _length
 ) {
@@ -178,6 +187,7 @@ bool DynamicStringArray_InsertSubString(
     size_t shiftedSize = _object->usedSize + (size_t)_object->buffer - (size_t)insertedString;
     if (shiftedSize) { // there are parts that needs to be shifted rightwards
         memmove(insertedString + _size, insertedString, shiftedSize);
+        INSTRUMENTATION_MOVE(&_object->instrumentation, shiftedSize);
     }
 	memcpy(insertedString, _string, _length);
 	insertedString[_length] = 0; // null terminator
@@ -187,6 +197,7 @@ bool DynamicStringArray_InsertSubString(
     _object->elementCount++;
     if (shiftedSize) { // there are parts that needs to be shifted rightwards
         memmove(&_object->array[_index + 1], &_object->array[_index], shiftedSize * sizeof(_object->array));
+        INSTRUMENTATION_MOVE(&_object->instrumentation, shiftedSize * sizeof(_object->array));
 
         // relocate contents of array of pointers as well
         for (size_t i = _index + 1; i < _object->elementCount; i++) {
@@ -198,8 +209,23 @@ bool DynamicStringArray_InsertSubString(
 	return true;
 }
 
-// Removes a specific element from the dynamicStringArray
-bool DynamicStringArray_Delete(dynamicstringarray_t* const _object, const size_t _deletedElementIndex) {
+// Inserts the data at the specified element index, shifting all the higher ordered elements by 1
+// The passed index is required be in between the existing first element and the last element.
+// Use DynamicStringArray_PushSubString if you wish to insert at the end of the array
+// Does not support overlapping data
+bool DynamicStringArray_InsertSubString(
+	dynamicstringarray_t* restrict const _object, const size_t _index,
+	const char* restrict const _string, size_t _length
+) {
+	INSTRUMENTATION_TRACE(INSTRUMENTATION_OPERATION_DYNAMICSTRINGARRAY_INSERTSUBSTRING, _object, _index, _length, NULL, 0);
+	INSTRUMENTATION_LATENCY_BEGIN(_start);
+	const bool _isInserted = DynamicStringArray_InsertSubStringUntimed(_object, _index, _string, _length);
+	INSTRUMENTATION_LATENCY_END(INSTRUMENTATION_OPERATION_DYNAMICSTRINGARRAY_INSERTSUBSTRING, _start);
+	return _isInserted;
+}
+
+// DynamicStringArray_Delete without recording its latency nor its trace
+static inline bool DynamicStringArray_DeleteUntimed(dynamicstringarray_t* const _object, const size_t _deletedElementIndex) {
 	if (_deletedElementIndex >= _object->elementCount) {
 		return false; // index out of bounds
 	}
@@ -217,6 +243,11 @@ bool DynamicStringArray_Delete(dynamicstringarray_t* const _object, const size_t
             &_object->array[_deletedElementIndex + 1],
             shiftedElementCount * sizeof(_object->array)
         ); // shift the array
+        INSTRUMENTATION_MOVE(
+            &_object->instrumentation,
+            (size_t)(_object->buffer + _object->usedSize - _object->array[_deletedElementIndex]) // shifted but not yet relocated
+            + (shiftedElementCount * sizeof(_object->array))
+        );
         // relocate contents of array of pointers as well
         for (size_t i = _deletedElementIndex; i < _object->elementCount; i++) {
             _object->array[i] -= bytesDeleted;
@@ -226,6 +257,15 @@ bool DynamicStringArray_Delete(dynamicstringarray_t* const _object, const size_t
 	return true; // element has been deleted successfully
 }
 
+// Removes a specific element from the dynamicStringArray
+bool DynamicStringArray_Delete(dynamicstringarray_t* const _object, const size_t _deletedElementIndex) {
+	INSTRUMENTATION_TRACE(INSTRUMENTATION_OPERATION_DYNAMICSTRINGARRAY_DELETE, _object, _deletedElementIndex, 0, NULL, 0);
+	INSTRUMENTATION_LATENCY_BEGIN(_start);
+	const bool _isDeleted = DynamicStringArray_DeleteUntimed(_object, _deletedElementIndex);
+	INSTRUMENTATION_LATENCY_END(INSTRUMENTATION_OPERATION_DYNAMICSTRINGARRAY_DELETE, _start);
+	return _isDeleted;
+}
+
 /* Searches a string inside the DynamicStringArray variable
  * Returns the index of the matching element if the string was found
  * Returns -1 if the string was not found
@@ -259,6 +299,10 @@ dynamicstringarray_t* DynamicStringArray_InitAll(dynamicstringarray_t* _object,
 	} else {
 		_mallocVar = false;
 	}
+	INSTRUMENTATION_RESET(&_object->instrumentation);
+	if (_mallocVar) {
+		INSTRUMENTATION_ALLOCATION(&_object->instrumentation, sizeof(dynamicstringarray_t));
+	}
 	_object->expansionRate = _expansionRate + 1.0;
 
 	if (!_object->array) { // array isn't initialized yet
@@ -269,6 +313,7 @@ dynamicstringarray_t* DynamicStringArray_InitAll(dynamicstringarray_t* _object,
 			}
 			return NULL; // failed allocating array to our object
 		}
+		INSTRUMENTATION_ALLOCATION(&_object->instrumentation, _minElementCount * sizeof(_object->array));
 		_object->maxElementCount = _minElementCount;
 	} else if (!DynamicStringArray_SetMinElements(_object, _minElementCount)) {
 		if (_mallocVar) {
@@ -285,6 +330,7 @@ dynamicstringarray_t* DynamicStringArray_InitAll(dynamicstringarray_t* _object,
 			}
 			return NULL; // failed allocating buffer to our object
 		}
+		INSTRUMENTATION_ALLOCATION(&_object->instrumentation, _minBufferSize);
 		_object->bufferSize = _minBufferSize;
 	} else if (!DynamicStringArray_SetMinBufferSize(_object, _minBufferSize)) {
 		if (_mallocVar) {
@@ -3,7 +3,7 @@
  * @Author: Aldrin John O. Manalansan (ajom)
  * @Email: aldrinjohnolaermanalansan@gmail.com
  * @Brief: Dynamically construct String Arrays with arbitrary size
- * @LastUpdate: June 17, 2025
+ * @LastUpdate: October 18, 2026
  * 
  * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
  * 
@@ -19,6 +19,8 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+#include "Instrumentation.h"
+
 #define _DYNAMICARRAY_DEFAULT_INITIALARRAYCOUNT 10
 #define _DYNAMICARRAY_DEFAULT_INITIALBUFFERSIZE 100
 #define _DYNAMICARRAY_DEFAULT_EXPANSIONRATE 0.5f
@@ -31,6 +33,9 @@ typedef struct {
     size_t maxElementCount; // current memory size of the pointer array
     size_t bufferSize;      // current memory size of the buffer
 	float expansionRate;    // how fast will the memory will expand
+#ifdef DDS_INSTRUMENTATION
+    instrumentation_counters_t instrumentation;
+#endif
 } dynamicstringarray_t;
 
 bool DynamicStringArray_SetMinElements(dynamicstringarray_t* const _object, const size_t _minElementCount);
@@ -0,0 +1,44 @@
+/*
+ * @File: Hash.h
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Small non-cryptographic hash functions shared by the containers and their tools
+ * @LastUpdate: October 18, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define HASH_FNV1A_OFFSETBASIS 0xCBF29CE484222325ULL
+#define HASH_FNV1A_PRIME 0x100000001B3ULL
+
+// Continues a 64-bit FNV-1a hash with the bytes of the memory block
+static inline uint64_t Hash_FNV1aContinue(uint64_t _hash, const void* const _data, const size_t _size) {
+	const uint8_t* const _bytes = (const uint8_t*)_data;
+	for (size_t i = 0; i < _size; i++) {
+		_hash = (_hash ^ _bytes[i]) * HASH_FNV1A_PRIME;
+	}
+	return _hash;
+}
+
+// 64-bit FNV-1a hash of the memory block
+static inline uint64_t Hash_FNV1a(const void* const _data, const size_t _size) {
+	return Hash_FNV1aContinue(HASH_FNV1A_OFFSETBASIS, _data, _size);
+}
+
+// splitmix64 step, advances the state and returns a well mixed 64-bit value that only depends on the state's sequence
+static inline uint64_t Hash_SplitMix64(uint64_t* const _state) {
+	uint64_t _z = (*_state += 0x9E3779B97F4A7C15ULL);
+	_z = (_z ^ (_z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	_z = (_z ^ (_z >> 27)) * 0x94D049BB133111EBULL;
+	return _z ^ (_z >> 31);
+}
@@ -0,0 +1,323 @@
+/*
+ * @File: HashSet.c
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Set of fixed size elements with O(1) membership tests, hashed into a DynamicArray
+ * @LastUpdate: October 19, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ */
+
+#include "HashSet.h"
+#include "Hash.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define HASHSET_BULKBATCHCOUNT 16 // elements of HashSet_AddAll whose slots are prefetched together
+
+#if defined(__GNUC__) || defined(__clang__)
+	#define HashSet_Prefetch(_address) __builtin_prefetch(_address)
+#else
+	#define HashSet_Prefetch(_address) ((void)0)
+#endif
+
+// fibonacci hashing, the upper bits of the product depend on every bit of the hash
+static inline size_t HashSet_GetHomeSlot(const hashset_t* const _object, const uint64_t _hash) {
+	return (size_t)((_hash * 0x9E3779B97F4A7C15ULL) >> _object->shift);
+}
+
+static inline uint8_t HashSet_GetControl(const uint64_t _hash) {
+	return (uint8_t)(0x80 | (_hash & 0x7F)); // never 0
+}
+
+static inline void* HashSet_GetSlotPointer(const hashset_t* const _object, const size_t _slot) {
+	return (uint8_t*)_object->slots.array + (_slot * _object->slots.elementSize);
+}
+
+// the slot count holding the number of elements below the max load factor (3/4), 0 if it overflows
+static size_t HashSet_GetSlotCountFor(const size_t _elementCount) {
+	size_t _slotCount = HASHSET_MINSLOTCOUNT;
+	while ((_slotCount / 4) * 3 < _elementCount) {
+		if (_slotCount > (SIZE_MAX / 2)) {
+			return 0; // too large
+		}
+		_slotCount <<= 1;
+	}
+	return _slotCount;
+}
+
+// 64 - log2(_slotCount)
+static uint8_t HashSet_GetShift(size_t _slotCount) {
+	uint8_t _shift = 64;
+	for (; _slotCount > 1; _slotCount >>= 1) {
+		_shift--;
+	}
+	return _shift;
+}
+
+/* linear probes for the value starting from its home slot
+ * returns true if found, _pickedSlot = the value's slot
+ * returns false if not found, _pickedSlot = the empty slot where it would be placed
+ */
+static inline bool HashSet_Probe(const hashset_t* restrict const _object, const void* restrict const _value, const uint64_t _hash, size_t* restrict const _pickedSlot) {
+	const size_t _mask = _object->slots.maxElementCount - 1;
+	const uint8_t _control = HashSet_GetControl(_hash);
+	size_t _slot = HashSet_GetHomeSlot(_object, _hash);
+	for (; _object->controls[_slot]; _slot = (_slot + 1) & _mask) { // the load factor guarantees an empty slot
+		if ((_object->controls[_slot] == _control) && !memcmp(HashSet_GetSlotPointer(_object, _slot), _value, _object->slots.elementSize)) {
+			*_pickedSlot = _slot;
+			return true;
+		}
+	}
+	*_pickedSlot = _slot;
+	return false;
+}
+
+// stores the value at the slot found by HashSet_Probe
+static inline void HashSet_Place(hashset_t* restrict const _object, const void* restrict const _value, const uint64_t _hash, const size_t _slot) {
+	memcpy(HashSet_GetSlotPointer(_object, _slot), _value, _object->slots.elementSize);
+	_object->controls[_slot] = HashSet_GetControl(_hash);
+	_object->slots.elementCount++;
+}
+
+// moves every element into a new table of _slotCount slots
+static bool HashSet_Rehash(hashset_t* const _object, const size_t _slotCount) {
+	const size_t _elementSize = _object->slots.elementSize;
+	void* const _array = malloc(_slotCount * _elementSize);
+	uint8_t* const _controls = calloc(_slotCount, sizeof(uint8_t));
+	if (!_array || !_controls) {
+		free(_array);
+		free(_controls);
+		return false; // insufficient memory
+	}
+	INSTRUMENTATION_ALLOCATION(&_object->slots.instrumentation, _slotCount * _elementSize);
+	INSTRUMENTATION_ALLOCATION(&_object->slots.instrumentation, _slotCount);
+	INSTRUMENTATION_GROWTH(&_object->slots.instrumentation, _slotCount * _elementSize);
+
+	uint8_t* const _oldArray = _object->slots.array;
+	uint8_t* const _oldControls = _object->controls;
+	const size_t _oldSlotCount = _object->slots.maxElementCount;
+	_object->slots.array = _array;
+	_object->slots.maxElementCount = _slotCount;
+	_object->slots.elementCount = 0;
+	_object->controls = _controls;
+	_object->shift = HashSet_GetShift(_slotCount);
+	for (size_t i = 0; i < _oldSlotCount; i++) {
+		if (_oldControls[i]) {
+			const void* const _value = _oldArray + (i * _elementSize);
+			const uint64_t _hash = _object->hashFunction(_value, _elementSize);
+			size_t _slot;
+			HashSet_Probe(_object, _value, _hash, &_slot); // every value is unique
+			HashSet_Place(_object, _value, _hash, _slot);
+		}
+	}
+	INSTRUMENTATION_MOVE(&_object->slots.instrumentation, _object->slots.elementCount * _elementSize);
+	free(_oldArray);
+	free(_oldControls);
+	INSTRUMENTATION_FREE(&_object->slots.instrumentation);
+	INSTRUMENTATION_FREE(&_object->slots.instrumentation);
+	return true;
+}
+
+/* The default hash function: a splitmix64 finalizer for 4 and 8 byte elements, FNV-1a for the rest
+ * Bytewise so equal elements always hash equally
+ */
+uint64_t HashSet_DefaultHash(const void* const _element, const size_t _elementSize) {
+	uint64_t _state;
+	if (_elementSize == sizeof(uint64_t)) {
+		memcpy(&_state, _element, sizeof(uint64_t));
+	} else if (_elementSize == sizeof(uint32_t)) {
+		uint32_t _value;
+		memcpy(&_value, _element, sizeof(uint32_t));
+		_state = _value;
+	} else {
+		return Hash_FNV1a(_element, _elementSize);
+	}
+	return Hash_SplitMix64(&_state);
+}
+
+// assures that the set can add the number of elements without rehashing
+bool HashSet_ReserveElements(hashset_t* const _object, const size_t _reservedElementCount) {
+	if (_reservedElementCount > (SIZE_MAX - _object->slots.elementCount)) {
+		return false; // too large
+	}
+	const size_t _slotCount = HashSet_GetSlotCountFor(_object->slots.elementCount + _reservedElementCount);
+	if (!_slotCount) {
+		return false; // too large
+	}
+	return (_slotCount <= _object->slots.maxElementCount) || HashSet_Rehash(_object, _slotCount);
+}
+
+/* Adds a copy of the value to the set
+ * Returns true if the set has the value afterwards, including when it already had it
+ * Returns false due to insufficient memory
+ */
+bool HashSet_Add(hashset_t* restrict const _object, const void* restrict const _value) {
+	if (!HashSet_ReserveElements(_object, 1)) {
+		return false; // insufficient memory
+	}
+	const uint64_t _hash = _object->hashFunction(_value, _object->slots.elementSize);
+	size_t _slot;
+	if (!HashSet_Probe(_object, _value, _hash, &_slot)) {
+		HashSet_Place(_object, _value, _hash, _slot);
+	}
+	return true;
+}
+
+/* Adds every element of an array of _count elements to the set, duplicates are added once
+ * Rehashes at most once, and prefetches the slots of the next elements while placing the current ones
+ * Returns false due to insufficient memory, no element is added
+ */
+bool HashSet_AddAll(hashset_t* restrict const _object, const void* restrict const _values, const size_t _count) {
+	if (!HashSet_ReserveElements(_object, _count)) {
+		return false; // insufficient memory
+	}
+	const size_t _elementSize = _object->slots.elementSize;
+	const uint8_t* _value = _values;
+	uint64_t _hashes[HASHSET_BULKBATCHCOUNT];
+	for (size_t _batchStart = 0; _batchStart < _count; _batchStart += HASHSET_BULKBATCHCOUNT) {
+		const size_t _batchCount = ((_count - _batchStart) < HASHSET_BULKBATCHCOUNT) ? (_count - _batchStart) : HASHSET_BULKBATCHCOUNT;
+		const uint8_t* const _batch = _value;
+		for (size_t i = 0; i < _batchCount; i++, _value += _elementSize) {
+			_hashes[i] = _object->hashFunction(_value, _elementSize);
+			const size_t _homeSlot = HashSet_GetHomeSlot(_object, _hashes[i]);
+			HashSet_Prefetch(&_object->controls[_homeSlot]);
+			HashSet_Prefetch(HashSet_GetSlotPointer(_object, _homeSlot));
+		}
+		for (size_t i = 0; i < _batchCount; i++) {
+			const void* const _batchValue = _batch + (i * _elementSize);
+			size_t _slot;
+			if (!HashSet_Probe(_object, _batchValue, _hashes[i], &_slot)) {
+				HashSet_Place(_object, _batchValue, _hashes[i], _slot);
+			}
+		}
+	}
+	return true;
+}
+
+/* Returns the slot holding the value, HashSet_GetElementAt accesses its element
+ * Returns HASHSET_NOSLOT if the set doesn't have the value
+ */
+size_t HashSet_GetSlot(const hashset_t* restrict const _object, const void* restrict const _value) {
+	size_t _slot;
+	if (!HashSet_Probe(_object, _value, _object->hashFunction(_value, _object->slots.elementSize), &_slot)) {
+		return HASHSET_NOSLOT; // not found
+	}
+	return _slot;
+}
+
+/* Removes the value from the set, shifting the rest of its probe run backwards
+ * Returns false if the set doesn't have the value
+ */
+bool HashSet_Remove(hashset_t* restrict const _object, const void* restrict const _value) {
+	const size_t _elementSize = _object->slots.elementSize;
+	size_t _hole;
+	if (!HashSet_Probe(_object, _value, _object->hashFunction(_value, _elementSize), &_hole)) {
+		return false; // not found
+	}
+	const size_t _mask = _object->slots.maxElementCount - 1;
+	for (size_t _slot = (_hole + 1) & _mask; _object->controls[_slot]; _slot = (_slot + 1) & _mask) {
+		const void* const _slotValue = HashSet_GetSlotPointer(_object, _slot);
+		const size_t _homeSlot = HashSet_GetHomeSlot(_object, _object->hashFunction(_slotValue, _elementSize));
+		if (((_slot - _homeSlot) & _mask) >= ((_slot - _hole) & _mask)) { // the hole is inside the element's probe run
+			memcpy(HashSet_GetSlotPointer(_object, _hole), _slotValue, _elementSize);
+			INSTRUMENTATION_MOVE(&_object->slots.instrumentation, _elementSize);
+			_object->controls[_hole] = _object->controls[_slot];
+			_hole = _slot;
+		}
+	}
+	_object->controls[_hole] = 0;
+	_object->slots.elementCount--;
+	return true;
+}
+
+/* Iterates the elements of the set in slot order, _iterator must start at 0
+ * Returns a pointer to the next element, NULL after the last element
+ * WARNING: adding or removing elements invalidates the iteration
+ */
+void* HashSet_GetNext(const hashset_t* restrict const _object, size_t* restrict const _iterator) {
+	for (size_t _slot = *_iterator; _slot < _object->slots.maxElementCount; _slot++) {
+		if (_object->controls[_slot]) {
+			*_iterator = _slot + 1;
+			return HashSet_GetSlotPointer(_object, _slot);
+		}
+	}
+	*_iterator = _object->slots.maxElementCount;
+	return NULL; // no element left
+}
+
+// Removes every element of the set, keeping its slots
+void HashSet_Clear(hashset_t* const _object) {
+	memset(_object->controls, 0, _object->slots.maxElementCount);
+	_object->slots.elementCount = 0;
+}
+
+void HashSet_FreeStorage(hashset_t* const _object) {
+	DynamicArray_FreeBuffer(&_object->slots);
+	if (_object->controls) {
+		free(_object->controls);
+		_object->controls = NULL;
+		INSTRUMENTATION_FREE(&_object->slots.instrumentation);
+	}
+}
+
+/* Frees a HashSet object
+ * CAUTION! Do not pass pointer to a permanent HashSet variable!
+ */
+void HashSet_Free(hashset_t* _object) {
+	HashSet_FreeStorage(_object);
+	free((void*)_object);
+}
+
+/* Properly initializes the HashSet variable as an empty set holding at least _minCount elements without rehashing
+ * Allocates memory to the HashSet variable if its current value is NULL
+ * A permanent variable must have its slots.array set to NULL, or be already initialized
+ * _hashFunction = NULL uses HashSet_DefaultHash
+ */
+hashset_t* HashSet_InitAll(hashset_t* _object, const size_t _elementSize, const size_t _minCount, const hashset_hashfunction_t _hashFunction) {
+	const size_t _slotCount = HashSet_GetSlotCountFor(_minCount);
+	if (!_slotCount || !_elementSize) {
+		return NULL; // invalid size
+	}
+	bool _mallocVar;
+	if (!_object) { // if we are requesting to initialize it
+		_object = malloc(sizeof(hashset_t));
+		if (!_object) {
+			return NULL; // failed allocating hashset variable
+		}
+		_object->slots.array = NULL; // indicate buffer requires initialization later
+		_object->controls = NULL;
+		_mallocVar = true;
+	} else {
+		if (!_object->slots.array) { // isn't initialized yet, only the slots are known
+			_object->controls = NULL;
+		}
+		_mallocVar = false;
+	}
+	if (!DynamicArray_InitAll(&_object->slots, _elementSize, _slotCount, _object_DEFAULT_EXPANSIONRATE)) {
+		if (_mallocVar) {
+			free(_object);
+		}
+		return NULL; // insufficient memory
+	}
+	uint8_t* const _controls = realloc(_object->controls, _slotCount);
+	if (!_controls) {
+		if (_mallocVar) {
+			HashSet_Free(_object);
+		}
+		return NULL; // insufficient memory
+	}
+	INSTRUMENTATION_ALLOCATION(&_object->slots.instrumentation, _slotCount);
+	_object->controls = _controls;
+	_object->slots.maxElementCount = _slotCount; // an existing buffer may be larger, only the slots are used
+	_object->hashFunction = _hashFunction ? _hashFunction : HashSet_DefaultHash;
+	_object->shift = HashSet_GetShift(_slotCount);
+	HashSet_Clear(_object);
+	return _object; // initialization sucessful
+}
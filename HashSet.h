@@ -0,0 +1,62 @@
+/*
+ * @File: HashSet.h
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Set of fixed size elements with O(1) membership tests, hashed into a DynamicArray
+ * @LastUpdate: October 19, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ *
+ * Link HashSet.c and DynamicArray.c.
+ *
+ * Open addressing with linear probing: an element is stored at the first empty slot after its hashed slot.
+ * Every slot has a control byte, 0 while empty, otherwise 7 bits of the element's hash so most mismatches skip the memcmp.
+ * Removing an element shifts the following elements of its probe run backwards instead of leaving a tombstone,
+ * so lookups never slow down after many removals.
+ * Elements are compared bytewise, like DynamicArray_HasValue, so padding bytes of structs must be zeroed.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "DynamicArray.h"
+
+#define HASHSET_DEFAULT_INITIALCOUNT 30
+#define HASHSET_MINSLOTCOUNT 8
+#define HASHSET_NOSLOT SIZE_MAX
+
+// hashes an element of _elementSize bytes, equal elements must return equal hashes
+typedef uint64_t (*hashset_hashfunction_t)(const void* const _element, const size_t _elementSize);
+
+typedef struct {
+    dynamicarray_t slots;                   // the slots, maxElementCount is the slot count (power of 2), elementCount is the element count
+    uint8_t* controls;                      // control byte per slot, 0 if the slot is empty
+    hashset_hashfunction_t hashFunction;
+    uint8_t shift;                          // 64 - log2(slot count), maps a hash to its slot
+} hashset_t;
+
+uint64_t HashSet_DefaultHash(const void* const _element, const size_t _elementSize);
+bool HashSet_ReserveElements(hashset_t* const _object, const size_t _reservedElementCount);
+bool HashSet_Add(hashset_t* restrict const _object, const void* restrict const _value);
+bool HashSet_AddAll(hashset_t* restrict const _object, const void* restrict const _values, const size_t _count);
+size_t HashSet_GetSlot(const hashset_t* restrict const _object, const void* restrict const _value);
+bool HashSet_Remove(hashset_t* restrict const _object, const void* restrict const _value);
+void* HashSet_GetNext(const hashset_t* restrict const _object, size_t* restrict const _iterator);
+void HashSet_Clear(hashset_t* const _object);
+void HashSet_FreeStorage(hashset_t* const _object);
+void HashSet_Free(hashset_t* _object);
+hashset_t* HashSet_InitAll(hashset_t* _object, const size_t _elementSize, const size_t _minCount, const hashset_hashfunction_t _hashFunction);
+
+#define HashSet_Init(_object, _elementSize) HashSet_InitAll(_object, _elementSize, HASHSET_DEFAULT_INITIALCOUNT, NULL)
+#define HashSet_GetCount(_object) ((_object)->slots.elementCount)
+#define HashSet_Contains(_object, _value) (HashSet_GetSlot(_object, _value) != HASHSET_NOSLOT)
+#define HashSet_GetElementAt(_object, _slot) ((void*)((uint8_t*)(_object)->slots.array + ((_slot) * (_object)->slots.elementSize)))
+#define HashSet_AddDynamicArray(_object, _dynamicArray) HashSet_AddAll(_object, (_dynamicArray)->array, (_dynamicArray)->elementCount)
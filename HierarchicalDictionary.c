@@ -0,0 +1,317 @@
+/*
+ * @File: HierarchicalDictionary.c
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Dictionary of (section, key) pairs sharing one sorted index, for INI style data
+ * @LastUpdate: October 19, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ */
+
+#include "HierarchicalDictionary.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// orders names of equal hashes by their sizes, then by their bytes
+static int HierarchicalDictionary_CompareNames(
+	const uint64_t _hash_A, const uint8_t* const _name_A, const size_t _size_A,
+	const uint64_t _hash_B, const uint8_t* const _name_B, const size_t _size_B
+) {
+	if (_hash_A != _hash_B) {
+		return (_hash_A < _hash_B) ? -1 : 1;
+	}
+	if (_size_A != _size_B) {
+		return (_size_A < _size_B) ? -1 : 1;
+	}
+	return memcmp(_name_A, _name_B, _size_A);
+}
+
+// a NULL name of size 0 is the empty name
+#define HIERARCHICALDICTIONARY_NAME(_name) ((_name) ? (const uint8_t*)(_name) : (const uint8_t*)"")
+
+/* Binary searches the index of the first entry that isn't less than (section, key)
+ * _isSectionEnd = true ignores the key, and searches the first entry past the section instead
+ * *out_isFound receives whether the entry at the index has the section and key
+ */
+static size_t HierarchicalDictionary_LowerBound(
+	const hierarchicaldictionary_t* restrict const _object,
+	const uint8_t* restrict const _section, const size_t _sectionSize,
+	const uint8_t* restrict const _key, const size_t _keySize,
+	const bool _isSectionEnd, bool* restrict const out_isFound
+) {
+	const hierarchicaldictionary_entry_t* const _entries = _object->entries.array;
+	const uint64_t _sectionHash = Hash_FNV1a(_section, _sectionSize);
+	const uint64_t _keyHash = _isSectionEnd ? 0 : Hash_FNV1a(_key, _keySize);
+	size_t _left = 0, _right = _object->entries.elementCount;
+	int _compared = 1;
+	while (_left < _right) {
+		const size_t _middle = _left + ((_right - _left) >> 1);
+		const hierarchicaldictionary_entry_t* const _entry = &_entries[_middle];
+		_compared = HierarchicalDictionary_CompareNames(_entry->sectionHash, _entry->section, _entry->sectionSize, _sectionHash, _section, _sectionSize);
+		if (!_compared) {
+			_compared = _isSectionEnd ? -1 : HierarchicalDictionary_CompareNames(_entry->keyHash, _entry->key, _entry->keySize, _keyHash, _key, _keySize);
+		}
+		if (_compared < 0) {
+			_left = _middle + 1;
+		} else {
+			_right = _middle;
+			if (!_compared) {
+				break; // names are unique
+			}
+		}
+	}
+	if (out_isFound) {
+		*out_isFound = !_compared;
+	}
+	return _compared ? _left : _right;
+}
+
+static void HierarchicalDictionary_FreeEntry(hierarchicaldictionary_t* restrict const _object, hierarchicaldictionary_entry_t* restrict const _entry) {
+	(void)_object; // only used by the instrumentation
+	free(_entry->section);
+	free(_entry->data);
+	INSTRUMENTATION_FREE(&_object->instrumentation);
+	INSTRUMENTATION_FREE(&_object->instrumentation);
+}
+
+// assures that the dictionary can hold the number of additional entries without expanding
+bool HierarchicalDictionary_ReserveElements(hierarchicaldictionary_t* const _object, const size_t _reservedElementCount) {
+	return DynamicArray_ReserveElements(&_object->entries, _reservedElementCount);
+}
+
+/* Sets the data of the key inside the section
+ * The key is created if it doesn't exist
+ * _data = 0x0 = NULL will fill the data block with zeroes
+ * _data = 0x1 will not touch the data block, like Dictionary_Set
+ * Returns a pointer to the data associated with the key
+ * Returns NULL if the entry was not created due to insufficient memory
+ */
+void* HierarchicalDictionary_Set(
+	hierarchicaldictionary_t* restrict const _object,
+	const void* restrict const _section, const size_t _sectionSize,
+	const void* restrict const _key, const size_t _keySize,
+	const void* restrict const _data, const size_t _dataSize
+) {
+	const uint8_t* const _sectionName = HIERARCHICALDICTIONARY_NAME(_section);
+	const uint8_t* const _keyName = HIERARCHICALDICTIONARY_NAME(_key);
+	bool _isFound;
+	const size_t _index = HierarchicalDictionary_LowerBound(_object, _sectionName, _sectionSize, _keyName, _keySize, false, &_isFound);
+	hierarchicaldictionary_entry_t* _entry;
+	if (_isFound) {
+		_entry = HierarchicalDictionary_GetEntryAt(_object, _index);
+	} else {
+		if ((_sectionSize > (SIZE_MAX - 2 - _keySize)) || (_dataSize == SIZE_MAX)) {
+			return NULL; // too large
+		}
+		hierarchicaldictionary_entry_t _newEntry = {
+			.sectionHash = Hash_FNV1a(_sectionName, _sectionSize),
+			.keyHash = Hash_FNV1a(_keyName, _keySize),
+			.section = malloc(_sectionSize + 1 + _keySize + 1), // +1 for string null terminator compatibility of each
+			.data = calloc(_dataSize + 1, 1), // +1 for string null terminator compatibility
+			.sectionSize = _sectionSize,
+			.keySize = _keySize,
+			.dataSize = 0,
+			.dataMaxSize = _dataSize
+		};
+		if (!_newEntry.section || !_newEntry.data) {
+			free(_newEntry.section);
+			free(_newEntry.data);
+			return NULL; // insufficient memory
+		}
+		memcpy(_newEntry.section, _sectionName, _sectionSize);
+		_newEntry.section[_sectionSize] = 0;
+		_newEntry.key = _newEntry.section + _sectionSize + 1;
+		memcpy(_newEntry.key, _keyName, _keySize);
+		_newEntry.key[_keySize] = 0;
+		if (!DynamicArray_Insert(&_object->entries, _index, &_newEntry)) {
+			free(_newEntry.section);
+			free(_newEntry.data);
+			return NULL; // insufficient memory
+		}
+		INSTRUMENTATION_ALLOCATION(&_object->instrumentation, _sectionSize + 1 + _keySize + 1);
+		INSTRUMENTATION_ALLOCATION(&_object->instrumentation, _dataSize + 1);
+		_entry = HierarchicalDictionary_GetEntryAt(_object, _index);
+	}
+
+	if (_entry->dataMaxSize < _dataSize) { // data requires expansion
+		uint8_t* const _expandedBuffer = realloc(_entry->data, _dataSize + 1); // +1 for string null terminator compatibility
+		if (!_expandedBuffer) {
+			return NULL; // failed expanding our buffer's size, therefore, size requirement wasn't met
+		}
+		INSTRUMENTATION_REALLOCATION(&_object->instrumentation, _dataSize + 1);
+		memset(_expandedBuffer + _entry->dataMaxSize, 0, _dataSize + 1 - _entry->dataMaxSize); // fill the added memory with zeroes including the null terminator
+		_entry->data = _expandedBuffer;
+		_entry->dataMaxSize = _dataSize;
+	}
+	switch ((uintptr_t)_data) {
+	case 0:
+		memset(_entry->data, 0, _dataSize + 1); // +1 includes the null terminator for string compatibility
+	break; case 1:
+	break; default:
+		memcpy(_entry->data, _data, _dataSize);
+		_entry->data[_dataSize] = 0; // null terminator for string compatibility
+	break;
+	}
+	_entry->dataSize = _dataSize;
+	return _entry->data;
+}
+
+/* Searches the key inside the section
+ * Returns a pointer to its entry, NULL if not found
+ * WARNING: the entry moves once keys are set or deleted
+ */
+hierarchicaldictionary_entry_t* HierarchicalDictionary_GetEntry(
+	const hierarchicaldictionary_t* restrict const _object,
+	const void* restrict const _section, const size_t _sectionSize,
+	const void* restrict const _key, const size_t _keySize
+) {
+	bool _isFound;
+	const size_t _index = HierarchicalDictionary_LowerBound(_object, HIERARCHICALDICTIONARY_NAME(_section), _sectionSize, HIERARCHICALDICTIONARY_NAME(_key), _keySize, false, &_isFound);
+	return _isFound ? HierarchicalDictionary_GetEntryAt(_object, _index) : NULL;
+}
+
+/* Searches the key inside the section
+ * Returns a pointer to its data, out_dataSize receives its size. out_dataSize = NULL is allowed
+ * Returns NULL if not found
+ */
+void* HierarchicalDictionary_Get(
+	const hierarchicaldictionary_t* restrict const _object,
+	const void* restrict const _section, const size_t _sectionSize,
+	const void* restrict const _key, const size_t _keySize,
+	size_t* restrict const out_dataSize
+) {
+	const hierarchicaldictionary_entry_t* const _entry = HierarchicalDictionary_GetEntry(_object, _section, _sectionSize, _key, _keySize);
+	if (!_entry) {
+		return NULL; // entry not found
+	}
+	if (out_dataSize) {
+		*out_dataSize = _entry->dataSize;
+	}
+	return _entry->data;
+}
+
+/* Searches the entries of a section, sorted by key
+ * Returns a pointer to its first entry, out_count receives its entry count. out_count = NULL is allowed
+ * The entry of the next section, if any, directly follows its last entry
+ * Returns NULL if the section has no keys
+ * WARNING: the entries move once keys are set or deleted
+ */
+hierarchicaldictionary_entry_t* HierarchicalDictionary_GetSection(
+	const hierarchicaldictionary_t* restrict const _object,
+	const void* restrict const _section, const size_t _sectionSize,
+	size_t* restrict const out_count
+) {
+	const hierarchicaldictionary_entry_t* const _entries = _object->entries.array;
+	const uint8_t* const _sectionName = HIERARCHICALDICTIONARY_NAME(_section);
+	const uint64_t _sectionHash = Hash_FNV1a(_sectionName, _sectionSize);
+	size_t _left = 0, _right = _object->entries.elementCount;
+	while (_left < _right) { // first entry that isn't less than the section
+		const size_t _middle = _left + ((_right - _left) >> 1);
+		const hierarchicaldictionary_entry_t* const _entry = &_entries[_middle];
+		if (HierarchicalDictionary_CompareNames(_entry->sectionHash, _entry->section, _entry->sectionSize, _sectionHash, _sectionName, _sectionSize) < 0) {
+			_left = _middle + 1;
+		} else {
+			_right = _middle;
+		}
+	}
+	if ((_left >= _object->entries.elementCount)
+	|| HierarchicalDictionary_CompareNames(_entries[_left].sectionHash, _entries[_left].section, _entries[_left].sectionSize, _sectionHash, _sectionName, _sectionSize)) {
+		return NULL; // section not found
+	}
+	if (out_count) {
+		*out_count = HierarchicalDictionary_LowerBound(_object, _sectionName, _sectionSize, NULL, 0, true, NULL) - _left;
+	}
+	return (hierarchicaldictionary_entry_t*)&_entries[_left];
+}
+
+/* Deletes the key of the section
+ * Returns false if not found
+ */
+bool HierarchicalDictionary_DeleteKey(
+	hierarchicaldictionary_t* restrict const _object,
+	const void* restrict const _section, const size_t _sectionSize,
+	const void* restrict const _key, const size_t _keySize
+) {
+	bool _isFound;
+	const size_t _index = HierarchicalDictionary_LowerBound(_object, HIERARCHICALDICTIONARY_NAME(_section), _sectionSize, HIERARCHICALDICTIONARY_NAME(_key), _keySize, false, &_isFound);
+	if (!_isFound) {
+		return false; // entry not found
+	}
+	HierarchicalDictionary_FreeEntry(_object, HierarchicalDictionary_GetEntryAt(_object, _index));
+	return DynamicArray_Delete(&_object->entries, _index);
+}
+
+/* Deletes every key of the section, moving the following sections once
+ * Returns the number of deleted keys
+ */
+size_t HierarchicalDictionary_DeleteSection(hierarchicaldictionary_t* restrict const _object, const void* restrict const _section, const size_t _sectionSize) {
+	size_t _count;
+	hierarchicaldictionary_entry_t* const _first = HierarchicalDictionary_GetSection(_object, _section, _sectionSize, &_count);
+	if (!_first) {
+		return 0; // section not found
+	}
+	for (size_t i = 0; i < _count; i++) {
+		HierarchicalDictionary_FreeEntry(_object, &_first[i]);
+	}
+	const size_t _movedCount = _object->entries.elementCount - (size_t)(_first - HierarchicalDictionary_GetEntryAt(_object, 0)) - _count;
+	memmove(_first, _first + _count, _movedCount * sizeof(hierarchicaldictionary_entry_t));
+	INSTRUMENTATION_MOVE(&_object->entries.instrumentation, _movedCount * sizeof(hierarchicaldictionary_entry_t));
+	_object->entries.elementCount -= _count;
+	return _count;
+}
+
+// Deletes every section
+void HierarchicalDictionary_Clear(hierarchicaldictionary_t* const _object) {
+	for (size_t i = 0; i < _object->entries.elementCount; i++) {
+		HierarchicalDictionary_FreeEntry(_object, HierarchicalDictionary_GetEntryAt(_object, i));
+	}
+	DynamicArray_Clear(&_object->entries);
+}
+
+void HierarchicalDictionary_FreeStorage(hierarchicaldictionary_t* const _object) {
+	HierarchicalDictionary_Clear(_object);
+	DynamicArray_FreeBuffer(&_object->entries);
+}
+
+/* Frees a HierarchicalDictionary object
+ * CAUTION! Do not pass pointer to a permanent HierarchicalDictionary variable!
+ */
+void HierarchicalDictionary_Free(hierarchicaldictionary_t* _object) {
+	HierarchicalDictionary_FreeStorage(_object);
+	free((void*)_object);
+}
+
+/* Properly initializes the HierarchicalDictionary variable without sections, discarding its previous entries
+ * Allocates memory to the HierarchicalDictionary variable if its current value is NULL
+ * A permanent variable must have its entries.array set to NULL, or be already initialized
+ */
+hierarchicaldictionary_t* HierarchicalDictionary_InitAll(hierarchicaldictionary_t* _object, const size_t _minCount) {
+	bool _mallocVar;
+	if (!_object) { // if we are requesting to initialize it
+		_object = malloc(sizeof(hierarchicaldictionary_t));
+		if (!_object) {
+			return NULL; // failed allocating hierarchicaldictionary variable
+		}
+		_object->entries.array = NULL; // indicate buffer requires initialization later
+		_mallocVar = true;
+	} else {
+		if (_object->entries.array) { // already initialized, its entries' names and data must not leak
+			HierarchicalDictionary_Clear(_object);
+		}
+		_mallocVar = false;
+	}
+	INSTRUMENTATION_RESET(&_object->instrumentation);
+	if (!DynamicArray_InitAll(&_object->entries, sizeof(hierarchicaldictionary_entry_t), _minCount, _object_DEFAULT_EXPANSIONRATE)) {
+		if (_mallocVar) {
+			free(_object);
+		}
+		return NULL; // insufficient memory
+	}
+	return _object; // initialization sucessful
+}
@@ -0,0 +1,95 @@
+/*
+ * @File: HierarchicalDictionary.h
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Dictionary of (section, key) pairs sharing one sorted index, for INI style data
+ * @LastUpdate: October 19, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ *
+ * Link HierarchicalDictionary.c and DynamicArray.c.
+ *
+ * Every entry of every section lives in one DynamicArray sorted by the hash of its section, then by the hash of its key,
+ * and only then by their sizes and bytes. The binary search compares integers, and only dereferences names of equal hashes.
+ * A lookup is one binary search instead of a search for the section's Dictionary followed by a search inside it,
+ * and the entries of a section are contiguous, so a section is walked as a plain array and deleted with one memmove.
+ * The sections, and the keys inside a section, are therefore in no meaningful order.
+ * A section exists while it has at least one key, an empty key (_keySize = 0) can hold a section without keys.
+ * A NULL section or key of size 0 is the same as an empty one.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "DynamicArray.h"
+#include "Hash.h"
+#include "Instrumentation.h"
+
+#define HIERARCHICALDICTIONARY_DEFAULT_INITIALCOUNT 30
+
+typedef struct {
+    uint64_t sectionHash;
+    uint64_t keyHash;
+    uint8_t* section;       // the section followed by a null terminator, then the key followed by a null terminator
+    uint8_t* key;           // points inside the section's buffer
+    uint8_t* data;          // null terminated for string compatibility
+    size_t sectionSize;
+    size_t keySize;
+    size_t dataSize;
+    size_t dataMaxSize;
+} hierarchicaldictionary_entry_t;
+
+typedef struct {
+    dynamicarray_t entries;     // hierarchicaldictionary_entry_t sorted by section, then by key, see above
+#ifdef DDS_INSTRUMENTATION
+    instrumentation_counters_t instrumentation; // allocations of the entries' names and data
+#endif
+} hierarchicaldictionary_t;
+
+bool HierarchicalDictionary_ReserveElements(hierarchicaldictionary_t* const _object, const size_t _reservedElementCount);
+void* HierarchicalDictionary_Set(
+	hierarchicaldictionary_t* restrict const _object,
+	const void* restrict const _section, const size_t _sectionSize,
+	const void* restrict const _key, const size_t _keySize,
+	const void* restrict const _data, const size_t _dataSize
+);
+hierarchicaldictionary_entry_t* HierarchicalDictionary_GetEntry(
+	const hierarchicaldictionary_t* restrict const _object,
+	const void* restrict const _section, const size_t _sectionSize,
+	const void* restrict const _key, const size_t _keySize
+);
+void* HierarchicalDictionary_Get(
+	const hierarchicaldictionary_t* restrict const _object,
+	const void* restrict const _section, const size_t _sectionSize,
+	const void* restrict const _key, const size_t _keySize,
+	size_t* restrict const out_dataSize
+);
+hierarchicaldictionary_entry_t* HierarchicalDictionary_GetSection(
+	const hierarchicaldictionary_t* restrict const _object,
+	const void* restrict const _section, const size_t _sectionSize,
+	size_t* restrict const out_count
+);
+bool HierarchicalDictionary_DeleteKey(
+	hierarchicaldictionary_t* restrict const _object,
+	const void* restrict const _section, const size_t _sectionSize,
+	const void* restrict const _key, const size_t _keySize
+);
+size_t HierarchicalDictionary_DeleteSection(hierarchicaldictionary_t* restrict const _object, const void* restrict const _section, const size_t _sectionSize);
+void HierarchicalDictionary_Clear(hierarchicaldictionary_t* const _object);
+void HierarchicalDictionary_FreeStorage(hierarchicaldictionary_t* const _object);
+void HierarchicalDictionary_Free(hierarchicaldictionary_t* _object);
+hierarchicaldictionary_t* HierarchicalDictionary_InitAll(hierarchicaldictionary_t* _object, const size_t _minCount);
+
+#define HierarchicalDictionary_Init(_object) HierarchicalDictionary_InitAll(_object, HIERARCHICALDICTIONARY_DEFAULT_INITIALCOUNT)
+#define HierarchicalDictionary_GetCount(_object) ((_object)->entries.elementCount)
+#define HierarchicalDictionary_GetEntryAt(_object, _index) ((hierarchicaldictionary_entry_t*)(_object)->entries.array + (_index))
+#define HierarchicalDictionary_Has_Key(_object, _section, _sectionSize, _key, _keySize) (HierarchicalDictionary_GetEntry(_object, _section, _sectionSize, _key, _keySize) != NULL)
+#define HierarchicalDictionary_Has_Section(_object, _section, _sectionSize) (HierarchicalDictionary_GetSection(_object, _section, _sectionSize, NULL) != NULL)
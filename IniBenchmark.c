@@ -0,0 +1,482 @@
+/*
+ * @File: IniBenchmark.c
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: End-to-end INI parsing benchmark reporting time, allocations and memory per phase
+ * @LastUpdate: October 18, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ *
+ * Build: cc -O2 IniBenchmark.c -o IniBenchmark
+ * Usage: ./IniBenchmark [--format csv|json] [--min-size BYTES] [--max-size BYTES] [--seed N]
+ *
+ * Replays the workload of C_ini_Parser on generated INI files whose sizes grow 16 times per step
+ * from --min-size (default 1 KB) to --max-size (default 64 MB, 1 GB requires around 4 GB of memory):
+ *   tokenize: every section name, key and value is pushed into a DynamicStringArray
+ *   populate: one Dictionary per section is filled from the tokens, reopened sections and repeated keys overwrite
+ *   format:   every section is written back as INI text with a StringBuilder
+ * Each phase reports its time, the number of malloc/realloc/free calls made by the library,
+ * the bytes requested, the peak of live heap bytes and the peak resident set size of the process.
+ */
+
+#define _DEFAULT_SOURCE // clock_gettime(), getrusage() and strcasecmp()
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+
+typedef struct {
+    uint64_t mallocCount;
+    uint64_t reallocCount;
+    uint64_t freeCount;
+    uint64_t requestedBytes; // bytes asked from malloc, calloc and realloc
+    uint64_t liveBytes;      // bytes currently allocated
+    uint64_t peakLiveBytes;  // highest liveBytes since the last reset
+} allocationcounters_t;
+
+static allocationcounters_t allocationCounters;
+
+// every counted block starts with a header holding its size, keeping the user pointer max aligned
+typedef union {
+    size_t size;
+    max_align_t alignment;
+} allocationheader_t;
+
+static inline void CountLiveBytes(const size_t _size) {
+    allocationCounters.requestedBytes += _size;
+    allocationCounters.liveBytes += _size;
+    if (allocationCounters.liveBytes > allocationCounters.peakLiveBytes) {
+        allocationCounters.peakLiveBytes = allocationCounters.liveBytes;
+    }
+}
+
+static void* CountedMalloc(const size_t _size) {
+    allocationheader_t* const _header = malloc(sizeof(allocationheader_t) + _size);
+    if (!_header) {
+        return NULL; // insufficient memory
+    }
+    _header->size = _size;
+    allocationCounters.mallocCount++;
+    CountLiveBytes(_size);
+    return _header + 1;
+}
+
+static void* CountedCalloc(const size_t _count, const size_t _size) {
+    if (_size && (_count > (SIZE_MAX / _size))) {
+        return NULL; // overflow
+    }
+    void* const _block = CountedMalloc(_count * _size);
+    if (_block) {
+        memset(_block, 0, _count * _size);
+    }
+    return _block;
+}
+
+static void* CountedRealloc(void* const _block, const size_t _size) {
+    if (!_block) {
+        return CountedMalloc(_size);
+    }
+    allocationheader_t* _header = (allocationheader_t*)_block - 1;
+    const size_t _oldSize = _header->size;
+    _header = realloc(_header, sizeof(allocationheader_t) + _size);
+    if (!_header) {
+        return NULL; // insufficient memory, the old block is untouched
+    }
+    _header->size = _size;
+    allocationCounters.reallocCount++;
+    allocationCounters.liveBytes -= _oldSize;
+    CountLiveBytes(_size);
+    return _header + 1;
+}
+
+static void CountedFree(void* const _block) {
+    if (!_block) {
+        return;
+    }
+    allocationheader_t* const _header = (allocationheader_t*)_block - 1;
+    allocationCounters.freeCount++;
+    allocationCounters.liveBytes -= _header->size;
+    free(_header);
+}
+
+// route the library's allocations through the counters, the system headers above are already included
+#define malloc(_size) CountedMalloc(_size)
+#define calloc(_count, _size) CountedCalloc(_count, _size)
+#define realloc(_block, _size) CountedRealloc(_block, _size)
+#define free(_block) CountedFree(_block)
+
+#include "Instrumentation.c"
+#include "BinaryBuilder.c"
+#include "StringBuilder.c"
+#include "DynamicStringArray.c"
+#include "Dictionary.c"
+#include "Hash.h"
+
+#define INIBENCHMARK_DEFAULT_MINSIZE 1024
+#define INIBENCHMARK_DEFAULT_MAXSIZE (64 * 1024 * 1024)
+#define INIBENCHMARK_DEFAULT_SEED 42
+#define INIBENCHMARK_SIZESTEP 16
+#define INIBENCHMARK_KEYSPERSECTION 24     // average number of key lines in a section
+#define INIBENCHMARK_REOPENPERCENT 10      // chance of a section header reopening an earlier section
+#define INIBENCHMARK_DUPLICATEPERCENT 8    // chance of a key line repeating an earlier key of its section
+
+typedef struct {
+    const char* format;
+    size_t minSize;
+    size_t maxSize;
+    uint64_t seed;
+} inibenchmarkoptions_t;
+
+typedef struct {
+    const char* name;
+    uint64_t nanoseconds;
+    allocationcounters_t allocations;
+    long peakResidentKilobytes;
+} inibenchmarkphase_t;
+
+static const char* const keyWords[] = {
+    "connection", "timeout", "maximum", "buffer", "retry", "interval", "logging", "verbosity",
+    "directory", "cache", "threshold", "compression", "encryption", "certificate", "endpoint", "replica"
+};
+
+static inline uint64_t GetNanoseconds(void) {
+    struct timespec _now;
+    clock_gettime(CLOCK_MONOTONIC, &_now);
+    return ((uint64_t)_now.tv_sec * 1000000000ULL) + (uint64_t)_now.tv_nsec;
+}
+
+static long GetPeakResidentKilobytes(void) {
+    struct rusage _usage;
+    return getrusage(RUSAGE_SELF, &_usage) ? -1 : _usage.ru_maxrss;
+}
+
+// writes a long key made of several words, _keyNumber makes it unique inside its section
+static size_t WriteKey(char* const _destination, const uint64_t _keyNumber) {
+    uint64_t _words = _keyNumber * 0x9E3779B97F4A7C15ULL;
+    size_t _length = 0;
+    for (int i = 0; i < 4; i++, _words >>= 4) {
+        const char* const _word = keyWords[_words & 15];
+        const size_t _wordLength = strlen(_word);
+        memcpy(_destination + _length, _word, _wordLength);
+        _length += _wordLength;
+        _destination[_length++] = '_';
+    }
+    return _length + (size_t)sprintf(_destination + _length, "%llu", (unsigned long long)_keyNumber);
+}
+
+/* Generates an INI text of at least _size bytes (the last line is completed)
+ * The text has comments, blank lines, reopened sections and repeated keys
+ * Returns the text which must be freed by the caller, NULL if insufficient memory
+ */
+static char* GenerateIni(const size_t _size, uint64_t _random, size_t* const out_length) {
+    char* const _text = (malloc)(_size + 256); // uncounted, the text is the input and not part of the workload
+    if (!_text) {
+        return NULL; // insufficient memory
+    }
+    size_t _length = 0;
+    uint64_t _sectionCount = 0;
+    uint64_t _keyCount = 0; // keys written in the current section
+    while (_length < _size) {
+        const uint64_t _roll = Hash_SplitMix64(&_random);
+        if (!_sectionCount || !(_roll % INIBENCHMARK_KEYSPERSECTION)) { // section header
+            const uint64_t _section = (_sectionCount && ((_roll >> 8) % 100) < INIBENCHMARK_REOPENPERCENT)
+                ? ((_roll >> 16) % _sectionCount)
+                : _sectionCount++;
+            _length += (size_t)sprintf(_text + _length, "\n[service.%s.instance%llu]\n", keyWords[_section & 15], (unsigned long long)_section);
+            _keyCount = 0;
+        } else if ((_roll & 63) == 1) { // comment
+            _length += (size_t)sprintf(_text + _length, "; generated comment %llx\n", (unsigned long long)_roll);
+        } else { // key = value
+            const bool _isDuplicate = _keyCount && (((_roll >> 8) % 100) < INIBENCHMARK_DUPLICATEPERCENT);
+            const uint64_t _key = _isDuplicate ? ((_roll >> 16) % _keyCount) : _keyCount++;
+            _length += WriteKey(_text + _length, _key);
+            if (_roll & 0x100000) {
+                _length += (size_t)sprintf(_text + _length, " = %llu\n", (unsigned long long)(_roll >> 40));
+            } else {
+                _length += (size_t)sprintf(_text + _length, " = /var/lib/%s/%016llx.dat\n", keyWords[(_roll >> 24) & 15], (unsigned long long)_roll);
+            }
+        }
+    }
+    _text[_length] = '\0';
+    *out_length = _length;
+    return _text;
+}
+
+static inline const char* SkipBlanks(const char* _seeker, const char* const _end) {
+    while ((_seeker < _end) && ((*_seeker == ' ') || (*_seeker == '\t'))) {
+        _seeker++;
+    }
+    return _seeker;
+}
+
+static inline const char* TrimBlanks(const char* const _start, const char* _end) {
+    while ((_end > _start) && ((_end[-1] == ' ') || (_end[-1] == '\t') || (_end[-1] == '\r'))) {
+        _end--;
+    }
+    return _end;
+}
+
+/* Splits the INI text into tokens
+ * a section header becomes one token starting with '['
+ * a key line becomes two tokens, the key and the value
+ * returns false if insufficient memory
+ */
+static bool Tokenize(dynamicstringarray_t* const _tokens, const char* const _text, const size_t _length) {
+    const char* const _end = _text + _length;
+    for (const char* _line = _text; _line < _end;) {
+        const char* _lineEnd = memchr(_line, '\n', (size_t)(_end - _line));
+        if (!_lineEnd) {
+            _lineEnd = _end;
+        }
+        const char* const _start = SkipBlanks(_line, _lineEnd);
+        const char* const _stop = TrimBlanks(_start, _lineEnd);
+        if ((_start < _stop) && (*_start != ';') && (*_start != '#')) {
+            if (*_start == '[') {
+                const char* const _close = memchr(_start, ']', (size_t)(_stop - _start));
+                if (!DynamicStringArray_PushSubString(_tokens, _start, (size_t)((_close ? _close : _stop) - _start))) {
+                    return false; // insufficient memory
+                }
+            } else {
+                const char* const _equal = memchr(_start, '=', (size_t)(_stop - _start));
+                if (_equal) {
+                    const char* const _value = SkipBlanks(_equal + 1, _stop);
+                    if (!DynamicStringArray_PushSubString(_tokens, _start, (size_t)(TrimBlanks(_start, _equal) - _start))
+                    || !DynamicStringArray_PushSubString(_tokens, _value, (size_t)(_stop - _value))) {
+                        return false; // insufficient memory
+                    }
+                }
+            }
+        }
+        _line = _lineEnd + 1;
+    }
+    return true;
+}
+
+/* Fills one dictionary per section, _sections maps a section name to its dictionary_t*
+ * keys before the first section header belong to the unnamed section ""
+ * returns false if insufficient memory
+ */
+static bool Populate(dictionary_t* const _sections, const dynamicstringarray_t* const _tokens) {
+    dictionary_t* _section = NULL;
+    for (size_t i = 0; i < _tokens->elementCount; i++) {
+        const char* const _token = _tokens->array[i];
+        const bool _isHeader = (*_token == '[');
+        if (_isHeader || !_section) {
+            const char* const _name = _isHeader ? (_token + 1) : "";
+            const size_t _nameLength = strlen(_name);
+            dictionary_t** const _existing = Dictionary_Get(_sections, _name, _nameLength, NULL);
+            if (_existing) { // reopened section
+                _section = *_existing;
+            } else {
+                _section = Dictionary_Init(NULL);
+                if (!_section) {
+                    return false; // insufficient memory
+                }
+                if (!Dictionary_Set(_sections, _name, _nameLength, &_section, sizeof(_section))) {
+                    Dictionary_Free(_section);
+                    return false; // insufficient memory
+                }
+            }
+            if (_isHeader) {
+                continue;
+            }
+        }
+        if (i + 1 >= _tokens->elementCount) {
+            break; // incomplete key value pair
+        }
+        const char* const _value = _tokens->array[++i];
+        if (!Dictionary_Set(_section, _token, strlen(_token), _value, strlen(_value) + 1)) {
+            return false; // insufficient memory
+        }
+    }
+    return true;
+}
+
+// writes every section back as INI text, returns false if insufficient memory
+static bool Format(stringbuilder_t* const _output, const dictionary_t* const _sections) {
+    for (size_t s = 0; s < _sections->elementCount; s++) {
+        const dictionary_entry_t* const _sectionEntry = &_sections->entries[s];
+        const dictionary_t* const _section = *(dictionary_t**)_sectionEntry->data;
+        if (_sectionEntry->keySize) {
+            if ((UINTPTR_MAX == StringBuilder_InsertCharacter(_output, '['))
+            || (UINTPTR_MAX == StringBuilder_InsertCharacters(_output, (const char*)_sectionEntry->key, _sectionEntry->keySize))
+            || (UINTPTR_MAX == StringBuilder_InsertCharacters(_output, "]\n", 2))) {
+                return false; // insufficient memory
+            }
+        }
+        for (size_t k = 0; k < _section->elementCount; k++) {
+            const dictionary_entry_t* const _entry = &_section->entries[k];
+            if ((UINTPTR_MAX == StringBuilder_InsertCharacters(_output, (const char*)_entry->key, _entry->keySize))
+            || (UINTPTR_MAX == StringBuilder_InsertCharacters(_output, " = ", 3))
+            || (UINTPTR_MAX == StringBuilder_InsertString(_output, (const char*)_entry->data))
+            || (UINTPTR_MAX == StringBuilder_InsertCharacter(_output, '\n'))) {
+                return false; // insufficient memory
+            }
+        }
+        if (UINTPTR_MAX == StringBuilder_InsertCharacter(_output, '\n')) {
+            return false; // insufficient memory
+        }
+    }
+    return true;
+}
+
+static void FreeSections(dictionary_t* const _sections) {
+    for (size_t s = 0; s < _sections->elementCount; s++) {
+        Dictionary_Free(*(dictionary_t**)_sections->entries[s].data);
+    }
+    Dictionary_Free_Storage(_sections);
+}
+
+static inline void BeginPhase(inibenchmarkphase_t* const _phase, const char* const _name) {
+    _phase->name = _name;
+    const uint64_t _liveBytes = allocationCounters.liveBytes;
+    memset(&allocationCounters, 0, sizeof(allocationCounters));
+    allocationCounters.liveBytes = _liveBytes;
+    allocationCounters.peakLiveBytes = _liveBytes;
+    _phase->nanoseconds = GetNanoseconds();
+}
+
+static inline void EndPhase(inibenchmarkphase_t* const _phase) {
+    _phase->nanoseconds = GetNanoseconds() - _phase->nanoseconds;
+    _phase->allocations = allocationCounters;
+    _phase->peakResidentKilobytes = GetPeakResidentKilobytes();
+}
+
+static void PrintPhase(const inibenchmarkoptions_t* const _options, const size_t _size, const size_t _outputLength, const inibenchmarkphase_t* const _phase, const bool _isFirstResult) {
+    const double _megabytesPerSecond = _phase->nanoseconds ? ((double)_size * 1e3 / (double)_phase->nanoseconds) : 0.0;
+    if (!strcmp(_options->format, "json")) {
+        printf("%s    {\"size\": %zu, \"phase\": \"%s\", \"ns\": %llu, \"mb_per_sec\": %.2f, \"mallocs\": %llu, \"reallocs\": %llu, \"frees\": %llu, "
+            "\"requested_bytes\": %llu, \"peak_heap_bytes\": %llu, \"peak_rss_kb\": %ld, \"output_bytes\": %zu}",
+            _isFirstResult ? "" : ",\n", _size, _phase->name, (unsigned long long)_phase->nanoseconds, _megabytesPerSecond,
+            (unsigned long long)_phase->allocations.mallocCount, (unsigned long long)_phase->allocations.reallocCount,
+            (unsigned long long)_phase->allocations.freeCount, (unsigned long long)_phase->allocations.requestedBytes,
+            (unsigned long long)_phase->allocations.peakLiveBytes, _phase->peakResidentKilobytes, _outputLength
+        );
+    } else {
+        printf("%zu,%s,%llu,%.2f,%llu,%llu,%llu,%llu,%llu,%ld,%zu\n",
+            _size, _phase->name, (unsigned long long)_phase->nanoseconds, _megabytesPerSecond,
+            (unsigned long long)_phase->allocations.mallocCount, (unsigned long long)_phase->allocations.reallocCount,
+            (unsigned long long)_phase->allocations.freeCount, (unsigned long long)_phase->allocations.requestedBytes,
+            (unsigned long long)_phase->allocations.peakLiveBytes, _phase->peakResidentKilobytes, _outputLength
+        );
+    }
+    fflush(stdout);
+}
+
+// runs the three phases on one generated file, returns false if insufficient memory
+static bool RunIniBenchmark(const inibenchmarkoptions_t* const _options, const size_t _size, bool* const _isFirstResult) {
+    size_t _length;
+    char* const _text = GenerateIni(_size, _options->seed ^ ((uint64_t)_size * 0x9E3779B97F4A7C15ULL), &_length);
+    if (!_text) {
+        return false; // insufficient memory
+    }
+    inibenchmarkphase_t _phases[3];
+    dynamicstringarray_t _tokens = {0}; // zeroed, the Init functions only allocate buffers that are NULL
+    dictionary_t _sections = {0};
+    stringbuilder_t _output = {0};
+    bool _isSuccessful = false;
+
+    BeginPhase(&_phases[0], "tokenize");
+    if (!DynamicStringArray_Init(&_tokens)) {
+        goto cleanupText;
+    }
+    if (!Tokenize(&_tokens, _text, _length)) {
+        goto cleanupTokens;
+    }
+    EndPhase(&_phases[0]);
+
+    BeginPhase(&_phases[1], "populate");
+    if (!Dictionary_Init(&_sections)) {
+        goto cleanupTokens;
+    }
+    if (!Populate(&_sections, &_tokens)) {
+        goto cleanupSections;
+    }
+    EndPhase(&_phases[1]);
+
+    BeginPhase(&_phases[2], "format");
+    if (!StringBuilder_InitWithMinSize(&_output, _length, _STRINGBUILDER_BUFFEREXPANSIONRATE)) {
+        goto cleanupSections;
+    }
+    if (!Format(&_output, &_sections)) {
+        goto cleanupOutput;
+    }
+    EndPhase(&_phases[2]);
+
+    const size_t _outputLength = StringBuilder_GetUsedLength(&_output);
+    for (size_t i = 0; i < 3; i++) {
+        PrintPhase(_options, _length, _outputLength, &_phases[i], *_isFirstResult);
+        *_isFirstResult = false;
+    }
+    _isSuccessful = true;
+
+cleanupOutput:
+    StringBuilder_FreeBuffer(&_output);
+cleanupSections:
+    FreeSections(&_sections);
+cleanupTokens:
+    DynamicStringArray_FreeStorage(&_tokens);
+cleanupText:
+    (free)(_text);
+    return _isSuccessful;
+}
+
+static bool ParseOptions(const int argc, char** const argv, inibenchmarkoptions_t* const _options) {
+    _options->format = "csv";
+    _options->minSize = INIBENCHMARK_DEFAULT_MINSIZE;
+    _options->maxSize = INIBENCHMARK_DEFAULT_MAXSIZE;
+    _options->seed = INIBENCHMARK_DEFAULT_SEED;
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc) {
+            return false; // every option requires a value
+        }
+        const char* const _option = argv[i];
+        const char* const _value = argv[++i];
+        if (!strcmp(_option, "--format")) {
+            _options->format = _value;
+        } else if (!strcmp(_option, "--min-size")) {
+            _options->minSize = strtoull(_value, NULL, 10);
+        } else if (!strcmp(_option, "--max-size")) {
+            _options->maxSize = strtoull(_value, NULL, 10);
+        } else if (!strcmp(_option, "--seed")) {
+            _options->seed = strtoull(_value, NULL, 10);
+        } else {
+            return false; // unknown option
+        }
+    }
+    return (!strcmp(_options->format, "csv") || !strcmp(_options->format, "json")) && _options->minSize;
+}
+
+int main(int argc, char** argv) {
+    inibenchmarkoptions_t _options;
+    if (!ParseOptions(argc, argv, &_options)) {
+        fprintf(stderr, "Usage: %s [--format csv|json] [--min-size BYTES] [--max-size BYTES] [--seed N]\n", argv[0]);
+        return 1;
+    }
+    const bool _isJson = !strcmp(_options.format, "json");
+    if (_isJson) {
+        printf("{\n  \"seed\": %llu,\n  \"results\": [\n", (unsigned long long)_options.seed);
+    } else {
+        printf("size,phase,ns,mb_per_sec,mallocs,reallocs,frees,requested_bytes,peak_heap_bytes,peak_rss_kb,output_bytes\n");
+    }
+    bool _isFirstResult = true;
+    for (size_t _size = _options.minSize; _size <= _options.maxSize; _size *= INIBENCHMARK_SIZESTEP) {
+        fprintf(stderr, "ini size=%zu\n", _size);
+        if (!RunIniBenchmark(&_options, _size, &_isFirstResult)) {
+            fprintf(stderr, "  skipped: insufficient memory\n");
+        }
+    }
+    if (_isJson) {
+        printf("\n  ]\n}\n");
+    }
+    return 0;
+}
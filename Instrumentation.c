@@ -0,0 +1,207 @@
+/*
+ * @File: Instrumentation.c
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Optional allocation and memory traffic counters of the containers
+ * @LastUpdate: October 18, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ */
+
+#ifndef _POSIX_C_SOURCE
+	#define _POSIX_C_SOURCE 199309L // clock_gettime()
+#endif
+
+#include "Instrumentation.h"
+
+#include <time.h>
+
+#ifdef DDS_INSTRUMENTATION
+
+instrumentation_globalcounters_t instrumentationGlobalCounters;
+
+/* Copies the sum of the events of every container
+ * Each counter is read on its own, counters updated by other threads during the copy may be one event apart
+ */
+void Instrumentation_GetGlobalCounters(instrumentation_counters_t* const out_counters) {
+	out_counters->allocationCount = atomic_load_explicit(&instrumentationGlobalCounters.allocationCount, memory_order_relaxed);
+	out_counters->reallocationCount = atomic_load_explicit(&instrumentationGlobalCounters.reallocationCount, memory_order_relaxed);
+	out_counters->freeCount = atomic_load_explicit(&instrumentationGlobalCounters.freeCount, memory_order_relaxed);
+	out_counters->allocatedBytes = atomic_load_explicit(&instrumentationGlobalCounters.allocatedBytes, memory_order_relaxed);
+	out_counters->movedBytes = atomic_load_explicit(&instrumentationGlobalCounters.movedBytes, memory_order_relaxed);
+	out_counters->growthCount = atomic_load_explicit(&instrumentationGlobalCounters.growthCount, memory_order_relaxed);
+}
+
+void Instrumentation_ResetGlobalCounters(void) {
+	atomic_store_explicit(&instrumentationGlobalCounters.allocationCount, 0, memory_order_relaxed);
+	atomic_store_explicit(&instrumentationGlobalCounters.reallocationCount, 0, memory_order_relaxed);
+	atomic_store_explicit(&instrumentationGlobalCounters.freeCount, 0, memory_order_relaxed);
+	atomic_store_explicit(&instrumentationGlobalCounters.allocatedBytes, 0, memory_order_relaxed);
+	atomic_store_explicit(&instrumentationGlobalCounters.movedBytes, 0, memory_order_relaxed);
+	atomic_store_explicit(&instrumentationGlobalCounters.growthCount, 0, memory_order_relaxed);
+}
+
+#else
+
+void Instrumentation_GetGlobalCounters(instrumentation_counters_t* const out_counters) {
+	memset(out_counters, 0, sizeof(instrumentation_counters_t));
+}
+
+void Instrumentation_ResetGlobalCounters(void) {
+}
+
+#endif
+
+static const char* const instrumentationOperationNames[INSTRUMENTATION_OPERATION_COUNT] = {
+	[INSTRUMENTATION_OPERATION_BINARYBUILDER_DELETE] = "BinaryBuilder_Delete",
+	[INSTRUMENTATION_OPERATION_BINARYBUILDER_INSERTBYTES] = "BinaryBuilder_InsertBytes",
+	[INSTRUMENTATION_OPERATION_DYNAMICARRAY_DELETE] = "DynamicArray_Delete",
+	[INSTRUMENTATION_OPERATION_DYNAMICARRAY_INSERT] = "DynamicArray_Insert",
+	[INSTRUMENTATION_OPERATION_DYNAMICARRAY_PUSH] = "DynamicArray_Push",
+	[INSTRUMENTATION_OPERATION_DYNAMICSTRINGARRAY_DELETE] = "DynamicStringArray_Delete",
+	[INSTRUMENTATION_OPERATION_DYNAMICSTRINGARRAY_INSERTSUBSTRING] = "DynamicStringArray_InsertSubString",
+	[INSTRUMENTATION_OPERATION_DICTIONARY_DELETEKEY] = "Dictionary_DeleteKey",
+	[INSTRUMENTATION_OPERATION_DICTIONARY_GETENTRY] = "Dictionary_Get_Entry",
+	[INSTRUMENTATION_OPERATION_DICTIONARY_SET] = "Dictionary_Set",
+	[INSTRUMENTATION_OPERATION_UNROLLEDLINKEDLIST_PUSH] = "UnrolledLinkedList_Push",
+	[INSTRUMENTATION_OPERATION_SKIPLIST_DELETE] = "SkipList_Delete",
+	[INSTRUMENTATION_OPERATION_SKIPLIST_INSERT] = "SkipList_Insert"
+};
+
+// Returns the name of the public function whose latency is recorded by the operation
+const char* Instrumentation_GetOperationName(const instrumentation_operation_t _operation) {
+	return (_operation < INSTRUMENTATION_OPERATION_COUNT) ? instrumentationOperationNames[_operation] : NULL;
+}
+
+// Returns a monotonic timestamp in nanoseconds
+uint64_t Instrumentation_GetNanoseconds(void) {
+	struct timespec _time;
+#ifdef CLOCK_MONOTONIC
+	clock_gettime(CLOCK_MONOTONIC, &_time);
+#else
+	timespec_get(&_time, TIME_UTC); // wall clock, may jump when the system time is adjusted
+#endif
+	return ((uint64_t)_time.tv_sec * 1000000000u) + (uint64_t)_time.tv_nsec;
+}
+
+// Returns the lowest latency, in nanoseconds, that is recorded into the bucket
+uint64_t Instrumentation_GetHistogramBucketValue(const size_t _bucketIndex) {
+	if (_bucketIndex < INSTRUMENTATION_HISTOGRAM_SUBBUCKETCOUNT) {
+		return _bucketIndex;
+	}
+	const size_t _group = _bucketIndex / INSTRUMENTATION_HISTOGRAM_SUBBUCKETCOUNT;
+	const uint64_t _subBucket = _bucketIndex % INSTRUMENTATION_HISTOGRAM_SUBBUCKETCOUNT;
+	return (INSTRUMENTATION_HISTOGRAM_SUBBUCKETCOUNT + _subBucket) << (_group - 1);
+}
+
+/* Returns the latency, in nanoseconds, that is not exceeded by _percentile (0 to 100) percent of the recorded latencies
+ * The highest latency sharing the bucket is reported, capped at the highest recorded latency
+ * Returns 0 if the histogram has no recorded latency
+ */
+uint64_t Instrumentation_GetHistogramPercentile(const instrumentation_histogram_t* const _histogram, const double _percentile) {
+	if (!_histogram->totalCount) {
+		return 0; // nothing recorded
+	}
+	uint64_t _rank = (uint64_t)((_percentile / 100.0) * (double)_histogram->totalCount + 0.5);
+	if (!_rank) {
+		_rank = 1;
+	} else if (_rank > _histogram->totalCount) {
+		_rank = _histogram->totalCount;
+	}
+	uint64_t _cumulativeCount = 0;
+	for (size_t i = 0; i < INSTRUMENTATION_HISTOGRAM_BUCKETCOUNT; i++) {
+		_cumulativeCount += _histogram->counts[i];
+		if (_cumulativeCount >= _rank) {
+			const uint64_t _highestValue = ((i + 1) < INSTRUMENTATION_HISTOGRAM_BUCKETCOUNT) ? (Instrumentation_GetHistogramBucketValue(i + 1) - 1) : UINT64_MAX;
+			return (_highestValue < _histogram->maxNanoseconds) ? _highestValue : _histogram->maxNanoseconds;
+		}
+	}
+	return _histogram->maxNanoseconds; // the buckets were updated while being copied
+}
+
+#ifdef DDS_LATENCY_HISTOGRAMS
+
+#include <stdatomic.h>
+
+typedef struct {
+	atomic_uint_fast64_t counts[INSTRUMENTATION_HISTOGRAM_BUCKETCOUNT];
+	atomic_uint_fast64_t totalCount;
+	atomic_uint_fast64_t totalNanoseconds;
+	atomic_uint_fast64_t maxNanoseconds;
+} instrumentation_globalhistogram_t;
+
+static instrumentation_globalhistogram_t instrumentationLatencyHistograms[INSTRUMENTATION_OPERATION_COUNT];
+
+static size_t Instrumentation_GetHistogramBucketIndex(const uint64_t _nanoseconds) {
+	if (_nanoseconds < INSTRUMENTATION_HISTOGRAM_SUBBUCKETCOUNT) {
+		return (size_t)_nanoseconds; // exact bucket
+	}
+#if defined(__GNUC__) || defined(__clang__)
+	const unsigned _exponent = 63 - (unsigned)__builtin_clzll(_nanoseconds);
+#else
+	unsigned _exponent = 0;
+	for (uint64_t _remaining = _nanoseconds; _remaining >>= 1;) {
+		_exponent++;
+	}
+#endif
+	const size_t _subBucket = (size_t)(_nanoseconds >> (_exponent - INSTRUMENTATION_HISTOGRAM_SUBBUCKETBITS)) & (INSTRUMENTATION_HISTOGRAM_SUBBUCKETCOUNT - 1);
+	return ((_exponent - INSTRUMENTATION_HISTOGRAM_SUBBUCKETBITS + 1) * INSTRUMENTATION_HISTOGRAM_SUBBUCKETCOUNT) + _subBucket;
+}
+
+// Records one latency of the operation, can be called by any number of threads at the same time
+void Instrumentation_RecordLatency(const instrumentation_operation_t _operation, const uint64_t _nanoseconds) {
+	instrumentation_globalhistogram_t* const _histogram = &instrumentationLatencyHistograms[_operation];
+	atomic_fetch_add_explicit(&_histogram->counts[Instrumentation_GetHistogramBucketIndex(_nanoseconds)], 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&_histogram->totalCount, 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&_histogram->totalNanoseconds, _nanoseconds, memory_order_relaxed);
+	uint_fast64_t _maxNanoseconds = atomic_load_explicit(&_histogram->maxNanoseconds, memory_order_relaxed);
+	while ((_nanoseconds > _maxNanoseconds)
+	&& !atomic_compare_exchange_weak_explicit(&_histogram->maxNanoseconds, &_maxNanoseconds, _nanoseconds, memory_order_relaxed, memory_order_relaxed));
+}
+
+/* Copies the latency histogram of the operation
+ * Buckets updated by other threads during the copy may be one latency apart from totalCount
+ */
+void Instrumentation_GetLatencyHistogram(const instrumentation_operation_t _operation, instrumentation_histogram_t* const out_histogram) {
+	instrumentation_globalhistogram_t* const _histogram = &instrumentationLatencyHistograms[_operation];
+	for (size_t i = 0; i < INSTRUMENTATION_HISTOGRAM_BUCKETCOUNT; i++) {
+		out_histogram->counts[i] = atomic_load_explicit(&_histogram->counts[i], memory_order_relaxed);
+	}
+	out_histogram->totalCount = atomic_load_explicit(&_histogram->totalCount, memory_order_relaxed);
+	out_histogram->totalNanoseconds = atomic_load_explicit(&_histogram->totalNanoseconds, memory_order_relaxed);
+	out_histogram->maxNanoseconds = atomic_load_explicit(&_histogram->maxNanoseconds, memory_order_relaxed);
+}
+
+void Instrumentation_ResetLatencyHistograms(void) {
+	for (size_t _operation = 0; _operation < INSTRUMENTATION_OPERATION_COUNT; _operation++) {
+		instrumentation_globalhistogram_t* const _histogram = &instrumentationLatencyHistograms[_operation];
+		for (size_t i = 0; i < INSTRUMENTATION_HISTOGRAM_BUCKETCOUNT; i++) {
+			atomic_store_explicit(&_histogram->counts[i], 0, memory_order_relaxed);
+		}
+		atomic_store_explicit(&_histogram->totalCount, 0, memory_order_relaxed);
+		atomic_store_explicit(&_histogram->totalNanoseconds, 0, memory_order_relaxed);
+		atomic_store_explicit(&_histogram->maxNanoseconds, 0, memory_order_relaxed);
+	}
+}
+
+#else
+
+void Instrumentation_RecordLatency(const instrumentation_operation_t _operation, const uint64_t _nanoseconds) {
+	(void)_operation;
+	(void)_nanoseconds;
+}
+
+void Instrumentation_GetLatencyHistogram(const instrumentation_operation_t _operation, instrumentation_histogram_t* const out_histogram) {
+	(void)_operation;
+	memset(out_histogram, 0, sizeof(instrumentation_histogram_t));
+}
+
+void Instrumentation_ResetLatencyHistograms(void) {
+}
+
+#endif
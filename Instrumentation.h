@@ -0,0 +1,217 @@
+/*
+ * @File: Instrumentation.h
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Optional allocation and memory traffic counters of the containers
+ * @LastUpdate: October 19, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ *
+ * Compile every container with DDS_INSTRUMENTATION defined (and Instrumentation.c linked) to enable the counters.
+ * Each container object then carries an "instrumentation" member counting its own events,
+ * while the global counters sum the events of every container, including the lock-free queues.
+ * Without DDS_INSTRUMENTATION the counting macros expand to nothing and every counter reads as zero.
+ *
+ * Compile with DDS_LATENCY_HISTOGRAMS defined (and Instrumentation.c linked) to record the latency of the hot operations
+ * listed by instrumentation_operation_t into log-linear histograms, readable with Instrumentation_GetLatencyHistogram.
+ *
+ * Compile with DDS_TRACEPOINTS defined to emit USDT probes of provider "dds" where <sys/sdt.h> is available,
+ * so perf and bpftrace can attach to them without recompiling:
+ *   dds:growth(const char* function, size_t capacity) a storage has been expanded to capacity bytes
+ *   dds:shift(const char* function, size_t size)      size bytes have been shifted inside, or copied between, storages
+ *
+ * Compile with DDS_TRACE_RECORDING defined (and TraceRecorder.c linked) to log every call of those operations
+ * into a binary trace, see TraceRecorder.h.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+typedef struct {
+    uint64_t allocationCount;   // malloc() and calloc() calls
+    uint64_t reallocationCount; // realloc() calls
+    uint64_t freeCount;         // free() calls
+    uint64_t allocatedBytes;    // bytes requested from malloc(), calloc() and realloc()
+    uint64_t movedBytes;        // bytes shifted inside, or copied between, the containers' own storages
+    uint64_t growthCount;       // how many times a storage's capacity was expanded
+} instrumentation_counters_t;
+
+typedef enum {
+	INSTRUMENTATION_OPERATION_BINARYBUILDER_DELETE,
+	INSTRUMENTATION_OPERATION_BINARYBUILDER_INSERTBYTES,
+	INSTRUMENTATION_OPERATION_DYNAMICARRAY_DELETE,
+	INSTRUMENTATION_OPERATION_DYNAMICARRAY_INSERT,
+	INSTRUMENTATION_OPERATION_DYNAMICARRAY_PUSH,
+	INSTRUMENTATION_OPERATION_DYNAMICSTRINGARRAY_DELETE,
+	INSTRUMENTATION_OPERATION_DYNAMICSTRINGARRAY_INSERTSUBSTRING,
+	INSTRUMENTATION_OPERATION_DICTIONARY_DELETEKEY,
+	INSTRUMENTATION_OPERATION_DICTIONARY_GETENTRY,
+	INSTRUMENTATION_OPERATION_DICTIONARY_SET,
+	INSTRUMENTATION_OPERATION_UNROLLEDLINKEDLIST_PUSH,
+	INSTRUMENTATION_OPERATION_SKIPLIST_DELETE,
+	INSTRUMENTATION_OPERATION_SKIPLIST_INSERT,
+	INSTRUMENTATION_OPERATION_COUNT
+} instrumentation_operation_t;
+
+/* Latencies below INSTRUMENTATION_HISTOGRAM_SUBBUCKETCOUNT nanoseconds have their own bucket,
+ * every higher power of two range is split into INSTRUMENTATION_HISTOGRAM_SUBBUCKETCOUNT linear buckets,
+ * so a recorded latency is off by less than 1/INSTRUMENTATION_HISTOGRAM_SUBBUCKETCOUNT of its value
+ */
+#define INSTRUMENTATION_HISTOGRAM_SUBBUCKETBITS 4
+#define INSTRUMENTATION_HISTOGRAM_SUBBUCKETCOUNT (1 << INSTRUMENTATION_HISTOGRAM_SUBBUCKETBITS)
+#define INSTRUMENTATION_HISTOGRAM_BUCKETCOUNT ((64 - INSTRUMENTATION_HISTOGRAM_SUBBUCKETBITS + 1) * INSTRUMENTATION_HISTOGRAM_SUBBUCKETCOUNT)
+
+typedef struct {
+    uint64_t counts[INSTRUMENTATION_HISTOGRAM_BUCKETCOUNT]; // recorded latencies per bucket
+    uint64_t totalCount;       // how many latencies were recorded
+    uint64_t totalNanoseconds; // sum of the recorded latencies
+    uint64_t maxNanoseconds;   // highest recorded latency
+} instrumentation_histogram_t;
+
+void Instrumentation_GetGlobalCounters(instrumentation_counters_t* const out_counters);
+void Instrumentation_ResetGlobalCounters(void);
+const char* Instrumentation_GetOperationName(const instrumentation_operation_t _operation);
+uint64_t Instrumentation_GetNanoseconds(void);
+void Instrumentation_RecordLatency(const instrumentation_operation_t _operation, const uint64_t _nanoseconds);
+void Instrumentation_GetLatencyHistogram(const instrumentation_operation_t _operation, instrumentation_histogram_t* const out_histogram);
+void Instrumentation_ResetLatencyHistograms(void);
+uint64_t Instrumentation_GetHistogramPercentile(const instrumentation_histogram_t* const _histogram, const double _percentile);
+uint64_t Instrumentation_GetHistogramBucketValue(const size_t _bucketIndex);
+
+#ifdef DDS_INSTRUMENTATION
+
+#include <stdatomic.h>
+
+typedef struct {
+    atomic_uint_fast64_t allocationCount;
+    atomic_uint_fast64_t reallocationCount;
+    atomic_uint_fast64_t freeCount;
+    atomic_uint_fast64_t allocatedBytes;
+    atomic_uint_fast64_t movedBytes;
+    atomic_uint_fast64_t growthCount;
+} instrumentation_globalcounters_t;
+
+extern instrumentation_globalcounters_t instrumentationGlobalCounters;
+
+// _counters can be NULL to count the event globally only
+static inline void Instrumentation_CountAllocation(instrumentation_counters_t* const _counters, const size_t _size) {
+	if (_counters) {
+		_counters->allocationCount++;
+		_counters->allocatedBytes += _size;
+	}
+	atomic_fetch_add_explicit(&instrumentationGlobalCounters.allocationCount, 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&instrumentationGlobalCounters.allocatedBytes, _size, memory_order_relaxed);
+}
+
+static inline void Instrumentation_CountReallocation(instrumentation_counters_t* const _counters, const size_t _size) {
+	if (_counters) {
+		_counters->reallocationCount++;
+		_counters->allocatedBytes += _size;
+	}
+	atomic_fetch_add_explicit(&instrumentationGlobalCounters.reallocationCount, 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&instrumentationGlobalCounters.allocatedBytes, _size, memory_order_relaxed);
+}
+
+static inline void Instrumentation_CountFree(instrumentation_counters_t* const _counters) {
+	if (_counters) {
+		_counters->freeCount++;
+	}
+	atomic_fetch_add_explicit(&instrumentationGlobalCounters.freeCount, 1, memory_order_relaxed);
+}
+
+static inline void Instrumentation_CountMove(instrumentation_counters_t* const _counters, const size_t _size) {
+	if (_counters) {
+		_counters->movedBytes += _size;
+	}
+	atomic_fetch_add_explicit(&instrumentationGlobalCounters.movedBytes, _size, memory_order_relaxed);
+}
+
+static inline void Instrumentation_CountGrowth(instrumentation_counters_t* const _counters) {
+	if (_counters) {
+		_counters->growthCount++;
+	}
+	atomic_fetch_add_explicit(&instrumentationGlobalCounters.growthCount, 1, memory_order_relaxed);
+}
+
+#define INSTRUMENTATION_ALLOCATION(_counters, _size) Instrumentation_CountAllocation(_counters, _size)
+#define INSTRUMENTATION_REALLOCATION(_counters, _size) Instrumentation_CountReallocation(_counters, _size)
+#define INSTRUMENTATION_FREE(_counters) Instrumentation_CountFree(_counters)
+#define INSTRUMENTATION_COUNT_MOVE(_counters, _size) Instrumentation_CountMove(_counters, _size)
+#define INSTRUMENTATION_COUNT_GROWTH(_counters) Instrumentation_CountGrowth(_counters)
+#define INSTRUMENTATION_RESET(_counters) memset(_counters, 0, sizeof(instrumentation_counters_t))
+
+// copies the counters of a container object, any container having the "instrumentation" member is accepted
+#define Instrumentation_GetCounters(_object, out_counters) (*(out_counters) = (_object)->instrumentation)
+#define Instrumentation_ResetCounters(_object) INSTRUMENTATION_RESET(&(_object)->instrumentation)
+
+#else
+
+#define INSTRUMENTATION_ALLOCATION(_counters, _size) ((void)0)
+#define INSTRUMENTATION_REALLOCATION(_counters, _size) ((void)0)
+#define INSTRUMENTATION_FREE(_counters) ((void)0)
+#define INSTRUMENTATION_COUNT_MOVE(_counters, _size) ((void)0)
+#define INSTRUMENTATION_COUNT_GROWTH(_counters) ((void)0)
+#define INSTRUMENTATION_RESET(_counters) ((void)0)
+
+#define Instrumentation_GetCounters(_object, out_counters) memset(out_counters, 0, sizeof(instrumentation_counters_t))
+#define Instrumentation_ResetCounters(_object) ((void)0)
+
+#endif
+
+#if defined(DDS_TRACEPOINTS) && defined(__has_include)
+	#if __has_include(<sys/sdt.h>)
+		#include <sys/sdt.h>
+		#define INSTRUMENTATION_PROBE(_name, _size) DTRACE_PROBE2(dds, _name, __func__, (size_t)(_size))
+	#endif
+#endif
+#ifndef INSTRUMENTATION_PROBE
+	#define INSTRUMENTATION_PROBE(_name, _size) ((void)0)
+#endif
+
+// _size bytes have been shifted inside, or copied between, the container's storages
+#define INSTRUMENTATION_MOVE(_counters, _size) do { \
+	INSTRUMENTATION_COUNT_MOVE(_counters, _size); \
+	INSTRUMENTATION_PROBE(shift, _size); \
+} while (0)
+
+// a storage of the container has been expanded to _capacity bytes
+#define INSTRUMENTATION_GROWTH(_counters, _capacity) do { \
+	INSTRUMENTATION_COUNT_GROWTH(_counters); \
+	INSTRUMENTATION_PROBE(growth, _capacity); \
+} while (0)
+
+#ifdef DDS_LATENCY_HISTOGRAMS
+	#define INSTRUMENTATION_LATENCY_BEGIN(_start) const uint64_t _start = Instrumentation_GetNanoseconds()
+	#define INSTRUMENTATION_LATENCY_END(_operation, _start) Instrumentation_RecordLatency(_operation, Instrumentation_GetNanoseconds() - (_start))
+#else
+	#define INSTRUMENTATION_LATENCY_BEGIN(_start) ((void)0)
+	#define INSTRUMENTATION_LATENCY_END(_operation, _start) ((void)0)
+#endif
+
+#ifdef DDS_TRACE_RECORDING
+	void TraceRecorder_Record(
+		const instrumentation_operation_t _operation, const void* const _object,
+		const uint64_t _argument0, const uint64_t _argument1,
+		const void* const _key, const size_t _keySize
+	);
+	void TraceRecorder_Forget(const instrumentation_operation_t _operation, const void* const _object);
+	#define INSTRUMENTATION_TRACE(_operation, _object, _argument0, _argument1, _key, _keySize) TraceRecorder_Record(_operation, _object, _argument0, _argument1, _key, _keySize)
+	#define INSTRUMENTATION_TRACE_FORGET(_operation, _object) TraceRecorder_Forget(_operation, _object)
+#else
+	#define INSTRUMENTATION_TRACE(_operation, _object, _argument0, _argument1, _key, _keySize) ((void)0)
+	#define INSTRUMENTATION_TRACE_FORGET(_operation, _object) ((void)0)
+#endif
+
+// the header-inline fast paths bypass the latency and trace recording of their out-of-line functions,
+// so the recorded operations only take them while neither is enabled
+#if !defined(DDS_LATENCY_HISTOGRAMS) && !defined(DDS_TRACE_RECORDING)
+	#define INSTRUMENTATION_INLINE_FASTPATHS
+#endif
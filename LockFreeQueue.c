@@ -0,0 +1,387 @@
+/*
+ * @File: LockFreeQueue.c
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Lock-free linked queues for passing data between threads
+ * @LastUpdate: October 18, 2026
+ * 
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ * 
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ */
+
+#include "LockFreeQueue.h"
+#include "Instrumentation.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Allocates a node that can hold the queue's payload. The node can be pushed with MPSCQueue_PushNode
+ * The queues are shared between threads, so their allocations are only counted by the global instrumentation counters
+ */
+lockfreequeue_node_t* MPSCQueue_AllocateNode(const mpscqueue_t* const _object) {
+	lockfreequeue_node_t* const _node = malloc(sizeof(lockfreequeue_node_t) + _object->dataSize);
+	if (_node) {
+		INSTRUMENTATION_ALLOCATION(NULL, sizeof(lockfreequeue_node_t) + _object->dataSize);
+	}
+	return _node;
+}
+
+// Pushes a node at the end of the queue. Can be called by any number of producers at the same time
+void MPSCQueue_PushNode(mpscqueue_t* const _object, lockfreequeue_node_t* const _node) {
+	atomic_store_explicit(&_node->next, NULL, memory_order_relaxed);
+	lockfreequeue_node_t* const _prev = atomic_exchange_explicit(&_object->head, _node, memory_order_acq_rel);
+	atomic_store_explicit(&_prev->next, _node, memory_order_release); // publish the node to the consumer
+}
+
+/* Pops the oldest node of the queue. Must only be called by the single consumer
+ * The popped node is owned by the caller and can be freed or pushed again
+ * Returns NULL if the queue is empty, or if a producer has not finished chaining its node yet
+ */
+lockfreequeue_node_t* MPSCQueue_PopNode(mpscqueue_t* const _object) {
+	lockfreequeue_node_t* _tail = _object->tail;
+	lockfreequeue_node_t* _next = atomic_load_explicit(&_tail->next, memory_order_acquire);
+	if (_tail == _object->stub) { // skip the stub
+		if (!_next) {
+			return NULL; // queue is empty
+		}
+		_object->tail = _next;
+		_tail = _next;
+		_next = atomic_load_explicit(&_next->next, memory_order_acquire);
+	}
+	if (_next) {
+		_object->tail = _next;
+		return _tail;
+	}
+	if (_tail != atomic_load_explicit(&_object->head, memory_order_acquire)) {
+		return NULL; // a producer is in the middle of chaining its node
+	}
+	MPSCQueue_PushNode(_object, _object->stub); // keep one node in the queue so that the last node can be popped
+	_next = atomic_load_explicit(&_tail->next, memory_order_acquire);
+	if (_next) {
+		_object->tail = _next;
+		return _tail;
+	}
+	return NULL;
+}
+
+// Pushes a copy of the data at the end of the queue. Can be called by any number of producers at the same time
+bool MPSCQueue_Push(mpscqueue_t* restrict const _object, const void* restrict const _data) {
+	lockfreequeue_node_t* const _node = MPSCQueue_AllocateNode(_object);
+	if (!_node) {
+		return false; // insufficient memory
+	}
+	memcpy(_node->data, _data, _object->dataSize);
+	MPSCQueue_PushNode(_object, _node);
+	return true;
+}
+
+/* Pops the oldest data of the queue and copies it to out_Data. Must only be called by the single consumer
+ * out_Data = NULL discards the data
+ * Returns false if nothing was popped
+ */
+bool MPSCQueue_Pop(mpscqueue_t* restrict const _object, void* restrict const out_Data) {
+	lockfreequeue_node_t* const _node = MPSCQueue_PopNode(_object);
+	if (!_node) {
+		return false; // queue is empty
+	}
+	if (out_Data) {
+		memcpy(out_Data, _node->data, _object->dataSize);
+	}
+	free(_node);
+	INSTRUMENTATION_FREE(NULL);
+	return true;
+}
+
+// Frees all the queued nodes and the stub. No thread must be using the queue
+void MPSCQueue_FreeStorage(mpscqueue_t* const _object) {
+	if (!_object->stub) {
+		return; // already freed
+	}
+	lockfreequeue_node_t* _node = _object->tail;
+	while (_node) { // traverse
+		lockfreequeue_node_t* const _deleted = _node;
+		_node = atomic_load_explicit(&_node->next, memory_order_relaxed);
+		if (_deleted != _object->stub) {
+			free(_deleted);
+			INSTRUMENTATION_FREE(NULL);
+		}
+	}
+	free(_object->stub);
+	INSTRUMENTATION_FREE(NULL);
+	_object->stub = NULL;
+}
+
+/* Frees an MPSCQueue object
+ * CAUTION! Do not pass pointer to a permanent MPSCQueue variable!
+ */
+void MPSCQueue_Free(mpscqueue_t* _object) {
+	MPSCQueue_FreeStorage(_object);
+	free((void*)_object);
+	INSTRUMENTATION_FREE(NULL);
+}
+
+/* Properly initializes the MPSCQueue variable.
+ * Allocates memory to the MPSCQueue variable if its current value is NULL
+ */
+mpscqueue_t* MPSCQueue_Init(mpscqueue_t* _object, const size_t _dataSize) {
+	bool _mallocVar;
+	if (!_object) { // if we are requesting to initialize it
+		_object = malloc(sizeof(mpscqueue_t));
+		if (!_object) {
+			return NULL; // failed allocating mpscqueue variable
+		}
+		_mallocVar = true;
+	} else {
+		_mallocVar = false;
+	}
+	_object->stub = malloc(sizeof(lockfreequeue_node_t));
+	if (!_object->stub) {
+		if (_mallocVar) {
+			free(_object);
+		}
+		return NULL; // failed allocating the stub
+	}
+	if (_mallocVar) {
+		INSTRUMENTATION_ALLOCATION(NULL, sizeof(mpscqueue_t));
+	}
+	INSTRUMENTATION_ALLOCATION(NULL, sizeof(lockfreequeue_node_t));
+	atomic_init(&_object->stub->next, NULL);
+	atomic_init(&_object->head, _object->stub);
+	_object->tail = _object->stub;
+	_object->dataSize = _dataSize;
+	return _object; // initialization sucessful
+}
+
+/* Claims an unused hazard pointer record for the calling thread
+ * Every thread must attach itself before pushing or popping, and detach when it no longer uses the queue
+ * Returns NULL if LOCKFREEQUEUE_MAX_THREADS threads are already attached
+ */
+mpmcqueue_thread_t* MPMCQueue_AttachThread(mpmcqueue_t* const _object) {
+	for (size_t i = 0; i < LOCKFREEQUEUE_MAX_THREADS; i++) {
+		bool _isAttached = false;
+		if (atomic_compare_exchange_strong(&_object->threads[i].isAttached, &_isAttached, true)) {
+			return &_object->threads[i];
+		}
+	}
+	return NULL; // all records are in use
+}
+
+// frees every retired node that is not protected by any thread's hazard pointer
+static void MPMCQueue_ReclaimRetiredNodes(mpmcqueue_t* const _object, mpmcqueue_thread_t* const _thread) {
+	size_t _keptCount = 0;
+	for (size_t i = 0; i < _thread->retiredCount; i++) {
+		lockfreequeue_node_t* const _node = _thread->retired[i];
+		bool _isProtected = false;
+		for (size_t t = 0; (t < LOCKFREEQUEUE_MAX_THREADS) && !_isProtected; t++) {
+			for (size_t h = 0; h < LOCKFREEQUEUE_HAZARDS_PER_THREAD; h++) {
+				if (atomic_load(&_object->threads[t].hazards[h]) == _node) {
+					_isProtected = true;
+					break;
+				}
+			}
+		}
+		if (_isProtected) {
+			_thread->retired[_keptCount++] = _node; // try again on the next reclamation
+		} else {
+			free(_node);
+			INSTRUMENTATION_FREE(NULL);
+		}
+	}
+	_thread->retiredCount = _keptCount;
+}
+
+// defers the freeing of a dequeued node until no thread references it
+static void MPMCQueue_RetireNode(mpmcqueue_t* const _object, mpmcqueue_thread_t* const _thread, lockfreequeue_node_t* const _node) {
+	if (_thread->retiredCount >= _thread->maxRetiredCount) { // retired list requires expansion
+		const size_t _maxRetiredCount = _thread->maxRetiredCount ? (_thread->maxRetiredCount * 2) : (LOCKFREEQUEUE_MAX_THREADS * LOCKFREEQUEUE_HAZARDS_PER_THREAD * 2);
+		lockfreequeue_node_t** const _expanded = realloc(_thread->retired, _maxRetiredCount * sizeof(lockfreequeue_node_t*));
+		if (!_expanded) { // cannot defer, so wait here until nobody references the node
+			MPMCQueue_ReclaimRetiredNodes(_object, _thread);
+			if (_thread->retiredCount < _thread->maxRetiredCount) {
+				_thread->retired[_thread->retiredCount++] = _node;
+				return;
+			}
+			bool _isProtected;
+			do {
+				_isProtected = false;
+				for (size_t t = 0; t < LOCKFREEQUEUE_MAX_THREADS; t++) {
+					for (size_t h = 0; h < LOCKFREEQUEUE_HAZARDS_PER_THREAD; h++) {
+						_isProtected |= (atomic_load(&_object->threads[t].hazards[h]) == _node);
+					}
+				}
+			} while (_isProtected);
+			free(_node);
+			INSTRUMENTATION_FREE(NULL);
+			return;
+		}
+		INSTRUMENTATION_REALLOCATION(NULL, _maxRetiredCount * sizeof(lockfreequeue_node_t*));
+		INSTRUMENTATION_GROWTH(NULL, _maxRetiredCount * sizeof(lockfreequeue_node_t*));
+		_thread->retired = _expanded;
+		_thread->maxRetiredCount = _maxRetiredCount;
+	}
+	_thread->retired[_thread->retiredCount++] = _node;
+	if (_thread->retiredCount >= (LOCKFREEQUEUE_MAX_THREADS * LOCKFREEQUEUE_HAZARDS_PER_THREAD * 2)) {
+		MPMCQueue_ReclaimRetiredNodes(_object, _thread);
+	}
+}
+
+// Releases the thread's hazard pointer record so that another thread can attach to it
+void MPMCQueue_DetachThread(mpmcqueue_t* const _object, mpmcqueue_thread_t* const _thread) {
+	for (size_t h = 0; h < LOCKFREEQUEUE_HAZARDS_PER_THREAD; h++) {
+		atomic_store(&_thread->hazards[h], NULL);
+	}
+	MPMCQueue_ReclaimRetiredNodes(_object, _thread); // the remaining retired nodes are inherited by the next attached thread
+	atomic_store(&_thread->isAttached, false);
+}
+
+// Pushes a copy of the data at the end of the queue
+bool MPMCQueue_Push(mpmcqueue_t* restrict const _object, mpmcqueue_thread_t* restrict const _thread, const void* restrict const _data) {
+	lockfreequeue_node_t* const _node = malloc(sizeof(lockfreequeue_node_t) + _object->dataSize);
+	if (!_node) {
+		return false; // insufficient memory
+	}
+	INSTRUMENTATION_ALLOCATION(NULL, sizeof(lockfreequeue_node_t) + _object->dataSize);
+	memcpy(_node->data, _data, _object->dataSize);
+	atomic_init(&_node->next, NULL);
+	for (;;) {
+		lockfreequeue_node_t* const _tail = atomic_load(&_object->tail);
+		atomic_store(&_thread->hazards[0], _tail);
+		if (_tail != atomic_load(&_object->tail)) {
+			continue; // tail changed before it was protected
+		}
+		lockfreequeue_node_t* _next = atomic_load(&_tail->next);
+		if (_next) { // tail is lagging behind, help advancing it
+			atomic_compare_exchange_weak(&_object->tail, &(lockfreequeue_node_t*){_tail}, _next);
+			continue;
+		}
+		if (atomic_compare_exchange_weak(&_tail->next, &_next, _node)) { // node has been chained
+			atomic_compare_exchange_strong(&_object->tail, &(lockfreequeue_node_t*){_tail}, _node);
+			break;
+		}
+	}
+	atomic_store(&_thread->hazards[0], NULL);
+	return true;
+}
+
+/* Pops the oldest data of the queue and copies it to out_Data
+ * out_Data = NULL discards the data
+ * Returns false if the queue is empty
+ */
+bool MPMCQueue_Pop(mpmcqueue_t* restrict const _object, mpmcqueue_thread_t* restrict const _thread, void* restrict const out_Data) {
+	lockfreequeue_node_t* _head;
+	for (;;) {
+		_head = atomic_load(&_object->head);
+		atomic_store(&_thread->hazards[0], _head);
+		if (_head != atomic_load(&_object->head)) {
+			continue; // head changed before it was protected
+		}
+		lockfreequeue_node_t* const _tail = atomic_load(&_object->tail);
+		lockfreequeue_node_t* const _next = atomic_load(&_head->next);
+		atomic_store(&_thread->hazards[1], _next);
+		if (_head != atomic_load(&_object->head)) {
+			continue; // next may have been freed before it was protected
+		}
+		if (!_next) { // queue is empty
+			atomic_store(&_thread->hazards[0], NULL);
+			atomic_store(&_thread->hazards[1], NULL);
+			return false;
+		}
+		if (_head == _tail) { // tail is lagging behind, help advancing it
+			atomic_compare_exchange_weak(&_object->tail, &(lockfreequeue_node_t*){_tail}, _next);
+			continue;
+		}
+		if (out_Data) {
+			memcpy(out_Data, _next->data, _object->dataSize); // copy before another consumer can retire the node
+		}
+		if (atomic_compare_exchange_weak(&_object->head, &_head, _next)) { // next became the new dummy node
+			break;
+		}
+	}
+	atomic_store(&_thread->hazards[0], NULL);
+	atomic_store(&_thread->hazards[1], NULL);
+	MPMCQueue_RetireNode(_object, _thread, _head);
+	return true;
+}
+
+// Frees all the queued and retired nodes. No thread must be using the queue
+void MPMCQueue_FreeStorage(mpmcqueue_t* const _object) {
+	lockfreequeue_node_t* _node = atomic_load(&_object->head);
+	while (_node) { // traverse
+		lockfreequeue_node_t* const _deleted = _node;
+		_node = atomic_load_explicit(&_node->next, memory_order_relaxed);
+		free(_deleted);
+		INSTRUMENTATION_FREE(NULL);
+	}
+	atomic_store(&_object->head, NULL);
+	atomic_store(&_object->tail, NULL);
+	for (size_t t = 0; t < LOCKFREEQUEUE_MAX_THREADS; t++) {
+		mpmcqueue_thread_t* const _thread = &_object->threads[t];
+		for (size_t i = 0; i < _thread->retiredCount; i++) {
+			free(_thread->retired[i]);
+			INSTRUMENTATION_FREE(NULL);
+		}
+		if (_thread->retired) {
+			free(_thread->retired);
+			INSTRUMENTATION_FREE(NULL);
+			_thread->retired = NULL;
+		}
+		_thread->retiredCount = 0;
+		_thread->maxRetiredCount = 0;
+	}
+}
+
+/* Frees an MPMCQueue object
+ * CAUTION! Do not pass pointer to a permanent MPMCQueue variable!
+ */
+void MPMCQueue_Free(mpmcqueue_t* _object) {
+	MPMCQueue_FreeStorage(_object);
+	free((void*)_object);
+	INSTRUMENTATION_FREE(NULL);
+}
+
+/* Properly initializes the MPMCQueue variable.
+ * Allocates memory to the MPMCQueue variable if its current value is NULL
+ */
+mpmcqueue_t* MPMCQueue_Init(mpmcqueue_t* _object, const size_t _dataSize) {
+	bool _mallocVar;
+	if (!_object) { // if we are requesting to initialize it
+		_object = malloc(sizeof(mpmcqueue_t));
+		if (!_object) {
+			return NULL; // failed allocating mpmcqueue variable
+		}
+		_mallocVar = true;
+	} else {
+		_mallocVar = false;
+	}
+	lockfreequeue_node_t* const _dummy = malloc(sizeof(lockfreequeue_node_t) + _dataSize);
+	if (!_dummy) {
+		if (_mallocVar) {
+			free(_object);
+		}
+		return NULL; // failed allocating the dummy node
+	}
+	if (_mallocVar) {
+		INSTRUMENTATION_ALLOCATION(NULL, sizeof(mpmcqueue_t));
+	}
+	INSTRUMENTATION_ALLOCATION(NULL, sizeof(lockfreequeue_node_t) + _dataSize);
+	atomic_init(&_dummy->next, NULL);
+	atomic_init(&_object->head, _dummy);
+	atomic_init(&_object->tail, _dummy);
+	_object->dataSize = _dataSize;
+	for (size_t t = 0; t < LOCKFREEQUEUE_MAX_THREADS; t++) {
+		mpmcqueue_thread_t* const _thread = &_object->threads[t];
+		for (size_t h = 0; h < LOCKFREEQUEUE_HAZARDS_PER_THREAD; h++) {
+			atomic_init(&_thread->hazards[h], NULL);
+		}
+		atomic_init(&_thread->isAttached, false);
+		_thread->retired = NULL;
+		_thread->retiredCount = 0;
+		_thread->maxRetiredCount = 0;
+	}
+	return _object; // initialization sucessful
+}
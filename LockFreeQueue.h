@@ -0,0 +1,72 @@
+/*
+ * @File: LockFreeQueue.h
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Lock-free linked queues for passing data between threads
+ * @LastUpdate: October 19, 2026
+ * 
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ * 
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+#define LOCKFREEQUEUE_MAX_THREADS 64 // max number of threads that can be attached to an MPMC queue at the same time
+#define LOCKFREEQUEUE_HAZARDS_PER_THREAD 2
+
+// same layout as td_SinglyLinkedList_node: the payload is stored after the next pointer, aligned for any type
+typedef struct lockfreequeue_node_t {
+    _Atomic(struct lockfreequeue_node_t*) next;
+    _Alignas(max_align_t) uint8_t data[]; // dataSize bytes
+} lockfreequeue_node_t;
+
+// Multiple Producers, Single Consumer queue (Dmitry Vyukov's intrusive algorithm)
+typedef struct {
+    _Atomic(lockfreequeue_node_t*) head; // producers push here
+    lockfreequeue_node_t* tail;          // only touched by the consumer
+    lockfreequeue_node_t* stub;          // payload-less node that keeps the queue non-empty
+    size_t dataSize;                     // size of every node's payload
+} mpscqueue_t;
+
+// per thread hazard pointers and retired nodes of an MPMC queue
+typedef struct {
+    _Atomic(lockfreequeue_node_t*) hazards[LOCKFREEQUEUE_HAZARDS_PER_THREAD];
+    atomic_bool isAttached;
+    lockfreequeue_node_t** retired; // dequeued nodes waiting until no thread references them
+    size_t retiredCount;
+    size_t maxRetiredCount;
+} mpmcqueue_thread_t;
+
+// Multiple Producers, Multiple Consumers queue (Michael-Scott algorithm with hazard pointer reclamation)
+typedef struct {
+    _Atomic(lockfreequeue_node_t*) head; // dummy node, its successor is the oldest node
+    _Atomic(lockfreequeue_node_t*) tail;
+    size_t dataSize;                     // size of every node's payload
+    mpmcqueue_thread_t threads[LOCKFREEQUEUE_MAX_THREADS];
+} mpmcqueue_t;
+
+lockfreequeue_node_t* MPSCQueue_AllocateNode(const mpscqueue_t* const _object);
+void MPSCQueue_PushNode(mpscqueue_t* const _object, lockfreequeue_node_t* const _node);
+lockfreequeue_node_t* MPSCQueue_PopNode(mpscqueue_t* const _object);
+bool MPSCQueue_Push(mpscqueue_t* restrict const _object, const void* restrict const _data);
+bool MPSCQueue_Pop(mpscqueue_t* restrict const _object, void* restrict const out_Data);
+void MPSCQueue_FreeStorage(mpscqueue_t* const _object);
+void MPSCQueue_Free(mpscqueue_t* _object);
+mpscqueue_t* MPSCQueue_Init(mpscqueue_t* _object, const size_t _dataSize);
+
+mpmcqueue_thread_t* MPMCQueue_AttachThread(mpmcqueue_t* const _object);
+void MPMCQueue_DetachThread(mpmcqueue_t* const _object, mpmcqueue_thread_t* const _thread);
+bool MPMCQueue_Push(mpmcqueue_t* restrict const _object, mpmcqueue_thread_t* restrict const _thread, const void* restrict const _data);
+bool MPMCQueue_Pop(mpmcqueue_t* restrict const _object, mpmcqueue_thread_t* restrict const _thread, void* restrict const out_Data);
+void MPMCQueue_FreeStorage(mpmcqueue_t* const _object);
+void MPMCQueue_Free(mpmcqueue_t* _object);
+mpmcqueue_t* MPMCQueue_Init(mpmcqueue_t* _object, const size_t _dataSize);
@@ -0,0 +1,158 @@
+/*
+ * @File: LockFreeQueueBenchmark.c
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Contention benchmark of the lock-free queues against a mutex-wrapped SinglyLinkedList
+ * @LastUpdate: October 18, 2026
+ * 
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ * 
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ *
+ * Build: cc -O2 -pthread LockFreeQueueBenchmark.c -o LockFreeQueueBenchmark
+ * Usage: ./LockFreeQueueBenchmark [itemsPerProducer]
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "Instrumentation.c"
+#include "DynamicArray.c"
+#include "SinglyLinkedList.c"
+#include "LockFreeQueue.c"
+
+#include <pthread.h>
+#include <time.h>
+
+#define BENCHMARK_DEFAULT_ITEMSPERPRODUCER 200000
+
+typedef enum {
+    QUEUE_MUTEXLIST,
+    QUEUE_MPSC,
+    QUEUE_MPMC
+} queuekind_t;
+
+typedef struct {
+    queuekind_t kind;
+    size_t itemsPerProducer;
+    size_t producerCount;
+    atomic_size_t consumedCount;
+    atomic_uint_fast64_t consumedSum;
+    pthread_mutex_t listMutex;
+    td_SinglyLinkedList_info list;
+    mpscqueue_t mpsc;
+    mpmcqueue_t mpmc;
+} benchmark_t;
+
+static double GetSeconds(void) {
+    struct timespec _now;
+    clock_gettime(CLOCK_MONOTONIC, &_now);
+    return (double)_now.tv_sec + ((double)_now.tv_nsec / 1e9);
+}
+
+static void* ProducerThread(void* _argument) {
+    benchmark_t* const _benchmark = _argument;
+    mpmcqueue_thread_t* const _thread = (_benchmark->kind == QUEUE_MPMC) ? MPMCQueue_AttachThread(&_benchmark->mpmc) : NULL;
+    for (uint64_t _value = 1; _value <= _benchmark->itemsPerProducer; _value++) {
+        switch (_benchmark->kind) {
+        case QUEUE_MUTEXLIST:
+            pthread_mutex_lock(&_benchmark->listMutex);
+            SinglyLinkedList_AddNode(&_benchmark->list, &_value);
+            pthread_mutex_unlock(&_benchmark->listMutex);
+        break; case QUEUE_MPSC:
+            while (!MPSCQueue_Push(&_benchmark->mpsc, &_value));
+        break; case QUEUE_MPMC:
+            while (!MPMCQueue_Push(&_benchmark->mpmc, _thread, &_value));
+        break;
+        }
+    }
+    if (_thread) {
+        MPMCQueue_DetachThread(&_benchmark->mpmc, _thread);
+    }
+    return NULL;
+}
+
+static void* ConsumerThread(void* _argument) {
+    benchmark_t* const _benchmark = _argument;
+    mpmcqueue_thread_t* const _thread = (_benchmark->kind == QUEUE_MPMC) ? MPMCQueue_AttachThread(&_benchmark->mpmc) : NULL;
+    const size_t _totalCount = _benchmark->itemsPerProducer * _benchmark->producerCount;
+    uint64_t _value;
+    while (atomic_load_explicit(&_benchmark->consumedCount, memory_order_relaxed) < _totalCount) {
+        bool _isPopped = false;
+        switch (_benchmark->kind) {
+        case QUEUE_MUTEXLIST:
+            pthread_mutex_lock(&_benchmark->listMutex);
+            _isPopped = SinglyLinkedList_PopFront(&_benchmark->list, &_value);
+            pthread_mutex_unlock(&_benchmark->listMutex);
+        break; case QUEUE_MPSC:
+            _isPopped = MPSCQueue_Pop(&_benchmark->mpsc, &_value);
+        break; case QUEUE_MPMC:
+            _isPopped = MPMCQueue_Pop(&_benchmark->mpmc, _thread, &_value);
+        break;
+        }
+        if (_isPopped) {
+            atomic_fetch_add_explicit(&_benchmark->consumedSum, _value, memory_order_relaxed);
+            atomic_fetch_add_explicit(&_benchmark->consumedCount, 1, memory_order_relaxed);
+        }
+    }
+    if (_thread) {
+        MPMCQueue_DetachThread(&_benchmark->mpmc, _thread);
+    }
+    return NULL;
+}
+
+static void RunBenchmark(const queuekind_t _kind, const size_t _producerCount, const size_t _consumerCount, const size_t _itemsPerProducer) {
+    static const char* const kindNames[] = {"mutex+SinglyLinkedList", "MPSCQueue", "MPMCQueue"};
+    static benchmark_t _benchmark; // too large for the stack because of the MPMC thread records
+    memset(&_benchmark, 0, sizeof(_benchmark));
+    _benchmark.kind = _kind;
+    _benchmark.itemsPerProducer = _itemsPerProducer;
+    _benchmark.producerCount = _producerCount;
+    pthread_mutex_init(&_benchmark.listMutex, NULL);
+    SinglyLinkedList_Reset(&_benchmark.list, sizeof(uint64_t));
+    MPSCQueue_Init(&_benchmark.mpsc, sizeof(uint64_t));
+    MPMCQueue_Init(&_benchmark.mpmc, sizeof(uint64_t));
+
+    pthread_t _threads[LOCKFREEQUEUE_MAX_THREADS];
+    const double _start = GetSeconds();
+    for (size_t i = 0; i < _consumerCount; i++) {
+        pthread_create(&_threads[i], NULL, ConsumerThread, &_benchmark);
+    }
+    for (size_t i = 0; i < _producerCount; i++) {
+        pthread_create(&_threads[_consumerCount + i], NULL, ProducerThread, &_benchmark);
+    }
+    for (size_t i = 0; i < (_producerCount + _consumerCount); i++) {
+        pthread_join(_threads[i], NULL);
+    }
+    const double _elapsed = GetSeconds() - _start;
+
+    const uint64_t _expectedSum = (uint64_t)_producerCount * _itemsPerProducer * (_itemsPerProducer + 1) / 2;
+    const size_t _totalCount = _producerCount * _itemsPerProducer;
+    printf("%-24s %9zu %9zu %12.0f %s\n",
+        kindNames[_kind], _producerCount, _consumerCount, _totalCount / _elapsed,
+        (atomic_load(&_benchmark.consumedSum) == _expectedSum) ? "ok" : "MISMATCH"
+    );
+
+    SinglyLinkedList_DeleteAllNodes(&_benchmark.list);
+    MPSCQueue_FreeStorage(&_benchmark.mpsc);
+    MPMCQueue_FreeStorage(&_benchmark.mpmc);
+    pthread_mutex_destroy(&_benchmark.listMutex);
+}
+
+int main(int argc, char** argv) {
+    const size_t _itemsPerProducer = (argc > 1) ? strtoull(argv[1], NULL, 10) : BENCHMARK_DEFAULT_ITEMSPERPRODUCER;
+    static const size_t producerCounts[] = {1, 2, 4, 8};
+    printf("%-24s %9s %9s %12s %s\n", "queue", "producers", "consumers", "items/s", "check");
+    for (size_t i = 0; i < (sizeof(producerCounts) / sizeof(producerCounts[0])); i++) {
+        RunBenchmark(QUEUE_MUTEXLIST, producerCounts[i], 1, _itemsPerProducer);
+        RunBenchmark(QUEUE_MPSC, producerCounts[i], 1, _itemsPerProducer);
+        RunBenchmark(QUEUE_MPMC, producerCounts[i], 1, _itemsPerProducer);
+    }
+    for (size_t i = 1; i < (sizeof(producerCounts) / sizeof(producerCounts[0])); i++) {
+        RunBenchmark(QUEUE_MUTEXLIST, producerCounts[i], producerCounts[i], _itemsPerProducer);
+        RunBenchmark(QUEUE_MPMC, producerCounts[i], producerCounts[i], _itemsPerProducer);
+    }
+    return 0;
+}
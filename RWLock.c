@@ -0,0 +1,103 @@
+/*
+ * @File: RWLock.c
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Reader-writer lock with writer preference, used by the concurrent containers
+ * @LastUpdate: October 18, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ */
+
+#include "RWLock.h"
+
+/* Properly initializes the lock
+ * Returns false if the system ran out of synchronization resources
+ */
+bool RWLock_Init(rwlock_t* const _lock) {
+	if (pthread_mutex_init(&_lock->mutex, NULL)) {
+		return false;
+	}
+	if (pthread_cond_init(&_lock->readersCondition, NULL)) {
+		pthread_mutex_destroy(&_lock->mutex);
+		return false;
+	}
+	if (pthread_cond_init(&_lock->writersCondition, NULL)) {
+		pthread_cond_destroy(&_lock->readersCondition);
+		pthread_mutex_destroy(&_lock->mutex);
+		return false;
+	}
+	atomic_init(&_lock->state, 0);
+	_lock->waitingWriterCount = 0;
+	_lock->isWriting = false;
+	return true; // initialization sucessful
+}
+
+// Releases the resources of the lock, no thread must be holding or waiting for it
+void RWLock_Destroy(rwlock_t* const _lock) {
+	pthread_cond_destroy(&_lock->writersCondition);
+	pthread_cond_destroy(&_lock->readersCondition);
+	pthread_mutex_destroy(&_lock->mutex);
+}
+
+// Waits until no writer is waiting or writing, then shares the lock with the other readers
+void RWLock_ReadLock(rwlock_t* const _lock) {
+	size_t _state = atomic_load_explicit(&_lock->state, memory_order_relaxed);
+	for (;;) {
+		if (!(_state & RWLOCK_WRITERBIT)) { // no writer, join the readers
+			if (atomic_compare_exchange_weak_explicit(&_lock->state, &_state, _state + 1, memory_order_acquire, memory_order_relaxed)) {
+				return;
+			}
+			continue; // _state has been reloaded
+		}
+		pthread_mutex_lock(&_lock->mutex);
+		while (atomic_load_explicit(&_lock->state, memory_order_relaxed) & RWLOCK_WRITERBIT) {
+			pthread_cond_wait(&_lock->readersCondition, &_lock->mutex);
+		}
+		pthread_mutex_unlock(&_lock->mutex);
+		_state = atomic_load_explicit(&_lock->state, memory_order_relaxed);
+	}
+}
+
+void RWLock_ReadUnlock(rwlock_t* const _lock) {
+	const size_t _previousState = atomic_fetch_sub_explicit(&_lock->state, 1, memory_order_release);
+	if (_previousState == (RWLOCK_WRITERBIT | 1)) { // last reader leaves while a writer waits
+		pthread_mutex_lock(&_lock->mutex);
+		pthread_cond_broadcast(&_lock->writersCondition);
+		pthread_mutex_unlock(&_lock->mutex);
+	}
+}
+
+// Holds back the new readers, then waits until the lock is no longer used by any reader or writer
+void RWLock_WriteLock(rwlock_t* const _lock) {
+	pthread_mutex_lock(&_lock->mutex);
+	_lock->waitingWriterCount++;
+	atomic_fetch_or_explicit(&_lock->state, RWLOCK_WRITERBIT, memory_order_relaxed);
+	while (_lock->isWriting) { // another writer goes first
+		pthread_cond_wait(&_lock->writersCondition, &_lock->mutex);
+	}
+	_lock->waitingWriterCount--;
+	_lock->isWriting = true;
+	while (atomic_load_explicit(&_lock->state, memory_order_acquire) != RWLOCK_WRITERBIT) { // readers are still active
+		pthread_cond_wait(&_lock->writersCondition, &_lock->mutex);
+	}
+	pthread_mutex_unlock(&_lock->mutex);
+}
+
+// Hands the lock to the next waiting writer if there is one, else lets the readers in
+void RWLock_WriteUnlock(rwlock_t* const _lock) {
+	pthread_mutex_lock(&_lock->mutex);
+	_lock->isWriting = false;
+	if (_lock->waitingWriterCount) { // readers stay held back
+		atomic_thread_fence(memory_order_release);
+		pthread_cond_broadcast(&_lock->writersCondition);
+	} else {
+		atomic_fetch_and_explicit(&_lock->state, ~RWLOCK_WRITERBIT, memory_order_release);
+		pthread_cond_broadcast(&_lock->readersCondition);
+	}
+	pthread_mutex_unlock(&_lock->mutex);
+}
@@ -0,0 +1,45 @@
+/*
+ * @File: RWLock.h
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Reader-writer lock with writer preference, used by the concurrent containers
+ * @LastUpdate: October 18, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ *
+ * Readers take and release the lock with a single atomic operation while no writer is waiting,
+ * so read-heavy workloads don't serialize on a mutex. Once a writer is waiting, new readers are held back
+ * until every waiting writer has had its turn.
+ * Build with -pthread.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#define RWLOCK_WRITERBIT (((size_t)1) << ((sizeof(size_t) * 8) - 1))
+
+typedef struct {
+    atomic_size_t state;               // number of active readers, RWLOCK_WRITERBIT is set while a writer waits or writes
+    pthread_mutex_t mutex;             // protects the fields below, and the sleeping of the threads
+    pthread_cond_t readersCondition;   // readers sleep here while RWLOCK_WRITERBIT is set
+    pthread_cond_t writersCondition;   // writers sleep here while another writer writes, or readers are active
+    size_t waitingWriterCount;
+    bool isWriting;
+} rwlock_t;
+
+bool RWLock_Init(rwlock_t* const _lock);
+void RWLock_Destroy(rwlock_t* const _lock);
+void RWLock_ReadLock(rwlock_t* const _lock);
+void RWLock_ReadUnlock(rwlock_t* const _lock);
+void RWLock_WriteLock(rwlock_t* const _lock);
+void RWLock_WriteUnlock(rwlock_t* const _lock);
@@ -0,0 +1,400 @@
+/*
+ * @File: Replayer.c
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Deterministically replays a trace recorded by TraceRecorder and reports the latency of every operation
+ * @LastUpdate: October 19, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ *
+ * Build: cc -O2 Replayer.c -o Replayer
+ * Usage: ./Replayer TRACE [--format csv|json] [--repeat N]
+ *
+ * The trace is decoded before the timing starts, then every recorded call is executed again, in order,
+ * against fresh container objects of this build. Keys and values are regenerated from the recorded key hashes,
+ * so equal keys stay equal and the replay is identical from one run, and one build, to another.
+ * --repeat replays the whole trace N times on fresh objects and merges the latencies.
+ * Results are written to stdout, progress is written to stderr.
+ */
+
+#define _DEFAULT_SOURCE // clock_gettime() and strcasecmp()
+
+#include "Instrumentation.c"
+#include "TraceRecorder.c"
+#include "BinaryBuilder.c"
+#include "DynamicArray.c"
+#include "DynamicStringArray.c"
+#include "Dictionary.c"
+#include "UnrolledLinkedList.c"
+#include "SkipList.c"
+#include "Hash.h"
+
+#include <stdio.h>
+
+typedef struct {
+    tracerecorder_container_t container;
+    void* object; // NULL until the first replayed call of the object
+} replayerobject_t;
+
+typedef struct {
+    dynamicarray_t samples; // latency of every replayed call, in nanoseconds
+    uint64_t totalNanoseconds;
+} replayerresult_t;
+
+typedef struct {
+    const char* tracePath;
+    const char* format;
+    size_t repeatCount;
+} replayeroptions_t;
+
+static volatile uintptr_t replayerSink; // keeps results alive so the compiler can't discard the replayed calls
+
+// elements of the replayed skiplists are ordered by their bytes
+static int CompareElements(const void* _a, const void* _b, void* _context) {
+    return memcmp(_a, _b, (size_t)(uintptr_t)_context);
+}
+
+// regenerates the bytes of a key or an element from its recorded hash
+static void FillFromHash(uint8_t* const _destination, const size_t _size, uint64_t _hash) {
+    for (size_t i = 0; i < _size; i += sizeof(uint64_t)) {
+        const uint64_t _value = Hash_SplitMix64(&_hash);
+        const size_t _remaining = _size - i;
+        memcpy(_destination + i, &_value, (_remaining < sizeof(uint64_t)) ? _remaining : sizeof(uint64_t));
+    }
+}
+
+static void* CreateObject(const tracerecorder_container_t _container, const tracerecorder_record_t* const _record) {
+    const size_t _elementSize = _record->argument1 ? (size_t)_record->argument1 : 1;
+    switch (_container) {
+    case TRACERECORDER_CONTAINER_BINARYBUILDER:
+        return BinaryBuilder_Init(NULL);
+    case TRACERECORDER_CONTAINER_DYNAMICARRAY:
+        return DynamicArray_Init(NULL, _elementSize);
+    case TRACERECORDER_CONTAINER_DYNAMICSTRINGARRAY:
+        return DynamicStringArray_Init(NULL);
+    case TRACERECORDER_CONTAINER_DICTIONARY:
+        return Dictionary_Init(NULL);
+    case TRACERECORDER_CONTAINER_UNROLLEDLINKEDLIST:
+        return UnrolledLinkedList_Init(NULL, _elementSize);
+    case TRACERECORDER_CONTAINER_SKIPLIST:
+        return SkipList_Init(NULL, _elementSize, CompareElements, (void*)(uintptr_t)_elementSize);
+    }
+    return NULL;
+}
+
+static void FreeObject(replayerobject_t* const _object) {
+    if (!_object->object) {
+        return; // never replayed
+    }
+    switch (_object->container) {
+    case TRACERECORDER_CONTAINER_BINARYBUILDER:
+        BinaryBuilder_Free(_object->object);
+        break;
+    case TRACERECORDER_CONTAINER_DYNAMICARRAY:
+        DynamicArray_Free(_object->object);
+        break;
+    case TRACERECORDER_CONTAINER_DYNAMICSTRINGARRAY:
+        DynamicStringArray_Free(_object->object);
+        break;
+    case TRACERECORDER_CONTAINER_DICTIONARY:
+        Dictionary_Free(_object->object);
+        break;
+    case TRACERECORDER_CONTAINER_UNROLLEDLINKEDLIST:
+        UnrolledLinkedList_Free(_object->object);
+        break;
+    case TRACERECORDER_CONTAINER_SKIPLIST:
+        SkipList_Free(_object->object);
+        break;
+    }
+    _object->object = NULL;
+}
+
+// size of the scratch memory a record needs for its key, element or inserted bytes
+static size_t GetScratchSize(const tracerecorder_record_t* const _record) {
+    return (TraceRecorder_GetOperationContainer(_record->operation) == TRACERECORDER_CONTAINER_DICTIONARY) ? (size_t)_record->argument0 : (size_t)_record->argument1;
+}
+
+/* Replays one call, the arguments are prepared before the timing starts
+ * The object must be of the operation's container, which the decoding assures
+ * Returns the latency of the call, in nanoseconds
+ */
+static uint64_t ReplayRecord(const tracerecorder_record_t* const _record, void* const _object, uint8_t* const _scratch, char* const _text) {
+    const size_t _argument0 = (size_t)_record->argument0;
+    const size_t _argument1 = (size_t)_record->argument1;
+    uintptr_t _result = 0;
+    uint64_t _start;
+    switch (_record->operation) {
+    case INSTRUMENTATION_OPERATION_BINARYBUILDER_DELETE:
+        BinaryBuilder_SetWriteOffset(_object, _argument0);
+        _start = Instrumentation_GetNanoseconds();
+        _result = BinaryBuilder_Delete(_object, _argument1);
+        break;
+    case INSTRUMENTATION_OPERATION_BINARYBUILDER_INSERTBYTES:
+        BinaryBuilder_SetWriteOffset(_object, _argument0);
+        _start = Instrumentation_GetNanoseconds();
+        _result = BinaryBuilder_InsertBytes(_object, _scratch, _argument1);
+        break;
+    case INSTRUMENTATION_OPERATION_DYNAMICARRAY_DELETE:
+        _start = Instrumentation_GetNanoseconds();
+        _result = DynamicArray_Delete(_object, _argument0);
+        break;
+    case INSTRUMENTATION_OPERATION_DYNAMICARRAY_INSERT:
+        _start = Instrumentation_GetNanoseconds();
+        _result = DynamicArray_Insert(_object, _argument0, _scratch);
+        break;
+    case INSTRUMENTATION_OPERATION_DYNAMICARRAY_PUSH:
+        _start = Instrumentation_GetNanoseconds();
+        _result = DynamicArray_Push(_object, _scratch);
+        break;
+    case INSTRUMENTATION_OPERATION_DYNAMICSTRINGARRAY_DELETE:
+        _start = Instrumentation_GetNanoseconds();
+        _result = DynamicStringArray_Delete(_object, _argument0);
+        break;
+    case INSTRUMENTATION_OPERATION_DYNAMICSTRINGARRAY_INSERTSUBSTRING:
+        _start = Instrumentation_GetNanoseconds();
+        _result = DynamicStringArray_InsertSubString(_object, _argument0, _text, _argument1);
+        break;
+    case INSTRUMENTATION_OPERATION_DICTIONARY_DELETEKEY:
+        FillFromHash(_scratch, _argument0, _record->keyHash);
+        _start = Instrumentation_GetNanoseconds();
+        _result = Dictionary_DeleteKey(_object, _scratch, _argument0);
+        break;
+    case INSTRUMENTATION_OPERATION_DICTIONARY_GETENTRY:
+        FillFromHash(_scratch, _argument0, _record->keyHash);
+        _start = Instrumentation_GetNanoseconds();
+        _result = (uintptr_t)Dictionary_Get_Entry(_object, _scratch, _argument0);
+        break;
+    case INSTRUMENTATION_OPERATION_DICTIONARY_SET:
+        FillFromHash(_scratch, _argument0, _record->keyHash);
+        _start = Instrumentation_GetNanoseconds();
+        _result = (uintptr_t)Dictionary_Set(_object, _scratch, _argument0, NULL, _argument1); // zero filled data
+        break;
+    case INSTRUMENTATION_OPERATION_UNROLLEDLINKEDLIST_PUSH:
+        _start = Instrumentation_GetNanoseconds();
+        _result = UnrolledLinkedList_Push(_object, _scratch);
+        break;
+    case INSTRUMENTATION_OPERATION_SKIPLIST_DELETE:
+        FillFromHash(_scratch, _argument1, _record->keyHash);
+        _start = Instrumentation_GetNanoseconds();
+        _result = SkipList_Delete(_object, _scratch);
+        break;
+    case INSTRUMENTATION_OPERATION_SKIPLIST_INSERT:
+        FillFromHash(_scratch, _argument1, _record->keyHash);
+        _start = Instrumentation_GetNanoseconds();
+        _result = (uintptr_t)SkipList_Insert(_object, _scratch);
+        break;
+    default:
+        return 0;
+    }
+    const uint64_t _elapsed = Instrumentation_GetNanoseconds() - _start;
+    replayerSink ^= _result;
+    return _elapsed;
+}
+
+static int CompareSamples(const void* _a, const void* _b) {
+    const uint64_t _sampleA = *(const uint64_t*)_a;
+    const uint64_t _sampleB = *(const uint64_t*)_b;
+    return (_sampleA > _sampleB) - (_sampleA < _sampleB);
+}
+
+static inline uint64_t GetPercentile(const uint64_t* const _sortedSamples, const size_t _sampleCount, const double _percentile) {
+    size_t _index = (size_t)(_percentile * _sampleCount);
+    return _sortedSamples[(_index < _sampleCount) ? _index : (_sampleCount - 1)];
+}
+
+static void PrintResult(const instrumentation_operation_t _operation, replayerresult_t* const _result, const bool _isJson, const bool _isFirstResult) {
+    uint64_t* const _samples = _result->samples.array;
+    const size_t _sampleCount = _result->samples.elementCount;
+    qsort(_samples, _sampleCount, sizeof(uint64_t), CompareSamples);
+    const double _callsPerSecond = _result->totalNanoseconds ? ((double)_sampleCount * 1e9 / (double)_result->totalNanoseconds) : 0.0;
+    const uint64_t _p50 = GetPercentile(_samples, _sampleCount, 0.50);
+    const uint64_t _p90 = GetPercentile(_samples, _sampleCount, 0.90);
+    const uint64_t _p99 = GetPercentile(_samples, _sampleCount, 0.99);
+    const uint64_t _p999 = GetPercentile(_samples, _sampleCount, 0.999);
+    const uint64_t _max = _samples[_sampleCount - 1];
+    if (_isJson) {
+        printf("%s    {\"operation\": \"%s\", \"calls\": %zu, \"total_ns\": %llu, \"calls_per_sec\": %.1f, "
+            "\"p50_ns\": %llu, \"p90_ns\": %llu, \"p99_ns\": %llu, \"p999_ns\": %llu, \"max_ns\": %llu}",
+            _isFirstResult ? "" : ",\n", Instrumentation_GetOperationName(_operation), _sampleCount,
+            (unsigned long long)_result->totalNanoseconds, _callsPerSecond, (unsigned long long)_p50, (unsigned long long)_p90,
+            (unsigned long long)_p99, (unsigned long long)_p999, (unsigned long long)_max);
+    } else {
+        printf("%s,%zu,%llu,%.1f,%llu,%llu,%llu,%llu,%llu\n",
+            Instrumentation_GetOperationName(_operation), _sampleCount,
+            (unsigned long long)_result->totalNanoseconds, _callsPerSecond, (unsigned long long)_p50, (unsigned long long)_p90,
+            (unsigned long long)_p99, (unsigned long long)_p999, (unsigned long long)_max);
+    }
+}
+
+// reads the whole file, returns NULL if it can't be read
+static uint8_t* ReadFile(const char* const _path, size_t* const out_size) {
+    FILE* const _file = fopen(_path, "rb");
+    if (!_file) {
+        return NULL;
+    }
+    uint8_t* _data = NULL;
+    long _size;
+    if (!fseek(_file, 0, SEEK_END) && ((_size = ftell(_file)) > 0) && !fseek(_file, 0, SEEK_SET)
+    && (_data = malloc((size_t)_size))) {
+        if (fread(_data, 1, (size_t)_size, _file) != (size_t)_size) {
+            free(_data);
+            _data = NULL;
+        }
+        *out_size = (size_t)_size;
+    }
+    fclose(_file);
+    return _data;
+}
+
+static bool ParseOptions(const int argc, char** const argv, replayeroptions_t* const _options) {
+    _options->tracePath = NULL;
+    _options->format = "csv";
+    _options->repeatCount = 1;
+    for (int i = 1; i < argc; i++) {
+        const char* const _option = argv[i];
+        if (strncmp(_option, "--", 2)) {
+            if (_options->tracePath) {
+                return false; // only one trace can be replayed
+            }
+            _options->tracePath = _option;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            return false; // every option requires a value
+        }
+        const char* const _value = argv[++i];
+        if (!strcmp(_option, "--format")) {
+            _options->format = _value;
+        } else if (!strcmp(_option, "--repeat")) {
+            _options->repeatCount = strtoull(_value, NULL, 10);
+        } else {
+            return false; // unknown option
+        }
+    }
+    return _options->tracePath && (!strcmp(_options->format, "csv") || !strcmp(_options->format, "json")) && _options->repeatCount;
+}
+
+int main(int argc, char** argv) {
+    replayeroptions_t _options;
+    if (!ParseOptions(argc, argv, &_options)) {
+        fprintf(stderr, "Usage: %s TRACE [--format csv|json] [--repeat N]\n", argv[0]);
+        return 1;
+    }
+    size_t _traceSize;
+    uint8_t* const _trace = ReadFile(_options.tracePath, &_traceSize);
+    if (!_trace) {
+        fprintf(stderr, "cannot read %s\n", _options.tracePath);
+        return 1;
+    }
+    size_t _offset = TraceRecorder_ReadHeader(_trace, _traceSize);
+    if (!_offset) {
+        fprintf(stderr, "%s is not a trace recorded by a compatible build\n", _options.tracePath);
+        free(_trace);
+        return 1;
+    }
+
+    // decode every record before replaying, so the decoding isn't timed
+    dynamicarray_t _records = {0};
+    dynamicarray_t _objects = {0};
+    if (!DynamicArray_Init(&_records, sizeof(tracerecorder_record_t)) || !DynamicArray_Init(&_objects, sizeof(replayerobject_t))) {
+        fprintf(stderr, "insufficient memory\n");
+        return 1;
+    }
+    size_t _scratchSize = 1;
+    tracerecorder_record_t _record;
+    size_t _nextOffset;
+    while ((_nextOffset = TraceRecorder_ReadRecord(_trace, _traceSize, _offset, &_record))) {
+        if (_record.objectId > _objects.elementCount) {
+            break; // corrupted, objects are numbered in order of first appearance
+        }
+        const tracerecorder_container_t _container = TraceRecorder_GetOperationContainer(_record.operation);
+        if (_record.objectId == _objects.elementCount) { // first appearance of the object
+            const replayerobject_t _object = {_container, NULL};
+            if (!DynamicArray_Push(&_objects, &_object)) {
+                fprintf(stderr, "insufficient memory\n");
+                return 1;
+            }
+        }
+        if (((const replayerobject_t*)_objects.array)[_record.objectId].container != _container) {
+            break; // corrupted, the object was created by an operation of another container
+        }
+        _offset = _nextOffset;
+        if (!DynamicArray_Push(&_records, &_record)) {
+            fprintf(stderr, "insufficient memory\n");
+            return 1;
+        }
+        const size_t _size = GetScratchSize(&_record);
+        if (_scratchSize <= _size) {
+            _scratchSize = _size + 1;
+        }
+    }
+    if (_offset != _traceSize) {
+        fprintf(stderr, "trace is truncated or corrupted after %zu records, replaying them only\n", _records.elementCount);
+    }
+    free(_trace);
+    uint8_t* const _scratch = calloc(_scratchSize, 1);
+    char* const _text = malloc(_scratchSize);
+    if (!_scratch || !_text) {
+        fprintf(stderr, "insufficient memory\n");
+        return 1;
+    }
+    memset(_text, 'x', _scratchSize - 1); // inserted strings must not end early
+    _text[_scratchSize - 1] = 0;
+
+    replayerresult_t _results[INSTRUMENTATION_OPERATION_COUNT] = {0};
+    for (size_t _round = 0; _round < _options.repeatCount; _round++) {
+        fprintf(stderr, "replaying %zu records, round %zu\n", _records.elementCount, _round + 1);
+        const tracerecorder_record_t* const _replayed = _records.array;
+        replayerobject_t* const _replayedObjects = _objects.array;
+        for (size_t i = 0; i < _records.elementCount; i++) {
+            replayerobject_t* const _object = &_replayedObjects[_replayed[i].objectId];
+            if (!_object->object && !(_object->object = CreateObject(_object->container, &_replayed[i]))) {
+                fprintf(stderr, "insufficient memory\n");
+                return 1;
+            }
+            const uint64_t _elapsed = ReplayRecord(&_replayed[i], _object->object, _scratch, _text);
+            replayerresult_t* const _result = &_results[_replayed[i].operation];
+            if (!_result->samples.array && !DynamicArray_Init(&_result->samples, sizeof(uint64_t))) {
+                fprintf(stderr, "insufficient memory\n");
+                return 1;
+            }
+            if (!DynamicArray_Push(&_result->samples, &_elapsed)) {
+                fprintf(stderr, "insufficient memory\n");
+                return 1;
+            }
+            _result->totalNanoseconds += _elapsed;
+        }
+        for (size_t i = 0; i < _objects.elementCount; i++) { // the next round starts from empty containers
+            FreeObject(&_replayedObjects[i]);
+        }
+    }
+
+    const bool _isJson = !strcmp(_options.format, "json");
+    if (_isJson) {
+        printf("{\n  \"records\": %zu,\n  \"repeat\": %zu,\n  \"results\": [\n", _records.elementCount, _options.repeatCount);
+    } else {
+        printf("operation,calls,total_ns,calls_per_sec,p50_ns,p90_ns,p99_ns,p999_ns,max_ns\n");
+    }
+    bool _isFirstResult = true;
+    for (size_t _operation = 0; _operation < INSTRUMENTATION_OPERATION_COUNT; _operation++) {
+        if (!_results[_operation].samples.elementCount) {
+            continue; // not in the trace
+        }
+        PrintResult((instrumentation_operation_t)_operation, &_results[_operation], _isJson, _isFirstResult);
+        _isFirstResult = false;
+        DynamicArray_FreeBuffer(&_results[_operation].samples);
+    }
+    if (_isJson) {
+        printf("\n  ]\n}\n");
+    }
+    DynamicArray_FreeBuffer(&_records);
+    DynamicArray_FreeBuffer(&_objects);
+    free(_scratch);
+    free(_text);
+    return 0;
+}
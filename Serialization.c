@@ -0,0 +1,548 @@
+/*
+ * @File: Serialization.c
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Saves containers into one versioned image that is loaded back by mapping it, without parsing nor copying
+ * @LastUpdate: October 19, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ */
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE // mmap(), fstat() and the strcasecmp() of the containers included after it
+#endif
+
+#include "Serialization.h"
+#include "Hash.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SERIALIZATION_HAS_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define SERIALIZATION_STORAGE_BUFFER 0    // owned by the caller
+#define SERIALIZATION_STORAGE_MAPPED 1    // mapped by SerializationFile_Open
+#define SERIALIZATION_STORAGE_ALLOCATED 2 // read into memory by SerializationFile_Open, where mapping isn't available
+
+// pads the image with zeroes until its size is a multiple of SERIALIZATION_ALIGNMENT
+static bool SerializationWriter_Align(binarybuilder_t* const _image) {
+	const size_t _padding = (SERIALIZATION_ALIGNMENT - (BinaryBuilder_GetCurrentSize(_image) % SERIALIZATION_ALIGNMENT)) % SERIALIZATION_ALIGNMENT;
+	return !_padding || (BinaryBuilder_SetBytes(_image, NULL, _padding) != UINTPTR_MAX);
+}
+
+// appends the bytes to the image, nothing is appended if the size is 0
+static inline bool SerializationWriter_Append(binarybuilder_t* const _image, const void* const _source, const size_t _size) {
+	return !_size || (BinaryBuilder_SetBytes(_image, _source, _size) != UINTPTR_MAX);
+}
+
+/* aligns the image, then returns the offset where the new section starts
+ * returns SIZE_MAX if the writer is already finished, or insufficient memory
+ */
+static size_t SerializationWriter_BeginSection(serialization_writer_t* const _object) {
+	if (_object->isFinished || !SerializationWriter_Align(&_object->image)) {
+		return SIZE_MAX;
+	}
+	return BinaryBuilder_GetCurrentSize(&_object->image);
+}
+
+// registers every byte written since _offset as a section
+static bool SerializationWriter_EndSection(
+	serialization_writer_t* const _object, const serialization_sectiontype_t _type,
+	const size_t _offset, const size_t _elementCount, const size_t _elementSize
+) {
+	const serialization_section_t _section = {
+		.type = _type,
+		.offset = _offset,
+		.size = BinaryBuilder_GetCurrentSize(&_object->image) - _offset,
+		.elementCount = _elementCount,
+		.elementSize = _elementSize
+	};
+	return DynamicArray_Push(&_object->sections, &_section);
+}
+
+// Adds the whole buffer of the BinaryData as a section
+bool SerializationWriter_AddBinaryData(serialization_writer_t* restrict const _object, const binarydata_t* restrict const _binaryData) {
+	const size_t _offset = SerializationWriter_BeginSection(_object);
+	return (_offset != SIZE_MAX)
+		&& SerializationWriter_Append(&_object->image, _binaryData->data, _binaryData->capacity)
+		&& SerializationWriter_EndSection(_object, SERIALIZATION_SECTION_BINARYDATA, _offset, 0, 0);
+}
+
+// Adds the valid elements of the DynamicArray as a section
+bool SerializationWriter_AddDynamicArray(serialization_writer_t* restrict const _object, const dynamicarray_t* restrict const _array) {
+	const size_t _offset = SerializationWriter_BeginSection(_object);
+	return (_offset != SIZE_MAX)
+		&& SerializationWriter_Append(&_object->image, _array->array, _array->elementCount * _array->elementSize)
+		&& SerializationWriter_EndSection(_object, SERIALIZATION_SECTION_DYNAMICARRAY, _offset, _array->elementCount, _array->elementSize);
+}
+
+// Adds the strings of the DynamicStringArray as a section
+bool SerializationWriter_AddDynamicStringArray(serialization_writer_t* restrict const _object, const dynamicstringarray_t* restrict const _stringArray) {
+	const size_t _offset = SerializationWriter_BeginSection(_object);
+	const size_t _tableSize = (_stringArray->elementCount + 1) * sizeof(uint64_t);
+	if ((_offset == SIZE_MAX)
+	|| !SerializationWriter_Append(&_object->image, NULL, _tableSize)) {
+		return false; // insufficient memory
+	}
+	uint64_t _stringOffset = _tableSize;
+	for (size_t i = 0; i < _stringArray->elementCount; i++) {
+		const size_t _size = strlen(_stringArray->array[i]) + 1; // includes the null terminator
+		if (!SerializationWriter_Append(&_object->image, _stringArray->array[i], _size)) {
+			return false; // insufficient memory
+		}
+		// the image may have moved, so the table is located again
+		memcpy((uint8_t*)_object->image.data + _offset + (i * sizeof(uint64_t)), &_stringOffset, sizeof(uint64_t));
+		_stringOffset += _size;
+	}
+	memcpy((uint8_t*)_object->image.data + _offset + (_stringArray->elementCount * sizeof(uint64_t)), &_stringOffset, sizeof(uint64_t));
+	return SerializationWriter_EndSection(_object, SERIALIZATION_SECTION_DYNAMICSTRINGARRAY, _offset, _stringArray->elementCount, 0);
+}
+
+// Adds the key-value pairs of the Dictionary as a section, their data are aligned to SERIALIZATION_ALIGNMENT
+bool SerializationWriter_AddDictionary(serialization_writer_t* restrict const _object, const dictionary_t* restrict const _dictionary) {
+	const size_t _offset = SerializationWriter_BeginSection(_object);
+	if ((_offset == SIZE_MAX)
+	|| !SerializationWriter_Append(&_object->image, NULL, _dictionary->elementCount * sizeof(serialization_dictionaryentry_t))) {
+		return false; // insufficient memory
+	}
+	dictionary_iterator_t _iterator;
+	Dictionary_GetIterator(_dictionary, NULL, 0, &_iterator);
+	for (size_t i = 0; i < _dictionary->elementCount; i++) {
+		const dictionary_entry_t* const _entry = Dictionary_NextEntry(&_iterator);
+		serialization_dictionaryentry_t _serializedEntry = {.keySize = _entry->keySize, .dataSize = _entry->dataSize};
+		if (!SerializationWriter_Align(&_object->image)) {
+			return false; // insufficient memory
+		}
+		_serializedEntry.keyOffset = BinaryBuilder_GetCurrentSize(&_object->image) - _offset;
+		if (!SerializationWriter_Append(&_object->image, _entry->key, _entry->keySize)
+		|| !SerializationWriter_Align(&_object->image)) {
+			return false; // insufficient memory
+		}
+		_serializedEntry.dataOffset = BinaryBuilder_GetCurrentSize(&_object->image) - _offset;
+		if (!SerializationWriter_Append(&_object->image, _entry->data, _entry->dataSize)) {
+			return false; // insufficient memory
+		}
+		// the image may have moved, so the table is located again
+		memcpy((uint8_t*)_object->image.data + _offset + (i * sizeof(serialization_dictionaryentry_t)), &_serializedEntry, sizeof(serialization_dictionaryentry_t));
+	}
+	return SerializationWriter_EndSection(_object, SERIALIZATION_SECTION_DICTIONARY, _offset, _dictionary->elementCount, 0);
+}
+
+/* Appends the section table and completes the header
+ * Afterwards the image is found at _object->image, and no more containers can be added
+ */
+bool SerializationWriter_Finish(serialization_writer_t* const _object) {
+	if (_object->isFinished) {
+		return true; // already finished
+	}
+	const size_t _tableOffset = SerializationWriter_BeginSection(_object);
+	if ((_tableOffset == SIZE_MAX)
+	|| !SerializationWriter_Append(&_object->image, _object->sections.array, _object->sections.elementCount * sizeof(serialization_section_t))) {
+		return false; // insufficient memory
+	}
+	serialization_header_t _header = {
+		.version = SERIALIZATION_VERSION,
+		.byteOrderMark = SERIALIZATION_BYTEORDERMARK,
+		.headerSize = sizeof(serialization_header_t),
+		.imageSize = BinaryBuilder_GetCurrentSize(&_object->image),
+		.sectionTableOffset = _tableOffset,
+		.sectionCount = _object->sections.elementCount
+	};
+	memcpy(_header.magic, SERIALIZATION_MAGIC, sizeof(_header.magic));
+	_header.checksum = Hash_FNV1a((uint8_t*)_object->image.data + sizeof(serialization_header_t), _header.imageSize - sizeof(serialization_header_t));
+	memcpy(_object->image.data, &_header, sizeof(serialization_header_t));
+	_object->isFinished = true;
+	return true;
+}
+
+// Finishes the image if it isn't yet, then writes it to a file
+bool SerializationWriter_SaveToFile(serialization_writer_t* restrict const _object, const char* restrict const _path) {
+	if (!SerializationWriter_Finish(_object)) {
+		return false; // insufficient memory
+	}
+	FILE* const _file = fopen(_path, "wb");
+	if (!_file) {
+		return false; // failed opening the file
+	}
+	const size_t _imageSize = BinaryBuilder_GetCurrentSize(&_object->image);
+	const bool _isWritten = (fwrite(_object->image.data, 1, _imageSize, _file) == _imageSize);
+	return (fclose(_file) == 0) && _isWritten;
+}
+
+void SerializationWriter_FreeStorage(serialization_writer_t* const _object) {
+	BinaryBuilder_FreeBuffer(&_object->image);
+	DynamicArray_FreeBuffer(&_object->sections);
+}
+
+/* Frees a SerializationWriter object
+ * CAUTION! Do not pass pointer to a permanent SerializationWriter variable!
+ */
+void SerializationWriter_Free(serialization_writer_t* _object) {
+	SerializationWriter_FreeStorage(_object);
+	free((void*)_object);
+}
+
+/* Properly initializes the SerializationWriter variable, discarding the containers added previously
+ * Allocates memory to the SerializationWriter variable if its current value is NULL
+ */
+serialization_writer_t* SerializationWriter_Init(serialization_writer_t* _object) {
+	bool _mallocVar;
+	if (!_object) { // if we are requesting to initialize it
+		_object = malloc(sizeof(serialization_writer_t));
+		if (!_object) {
+			return NULL; // failed allocating serializationwriter variable
+		}
+		_object->image.data = NULL; // indicate buffer requires initialization later
+		_object->sections.array = NULL;
+		_mallocVar = true;
+	} else {
+		_mallocVar = false;
+	}
+	if (!BinaryBuilder_Init(&_object->image)
+	|| !DynamicArray_Init(&_object->sections, sizeof(serialization_section_t))
+	|| !SerializationWriter_Append(&_object->image, NULL, sizeof(serialization_header_t))) { // completed by SerializationWriter_Finish
+		if (_mallocVar) {
+			SerializationWriter_Free(_object);
+		}
+		return NULL; // insufficient memory
+	}
+	_object->isFinished = false;
+	return _object; // initialization sucessful
+}
+
+/* Validates an image that is already in memory, for example the image of a finished SerializationWriter
+ * The image must stay valid until SerializationFile_Close, and be aligned to SERIALIZATION_ALIGNMENT
+ * for the loaded containers to keep their alignment.
+ * _isVerified = true compares the checksum, which reads the whole image
+ * Returns false if the image is malformed, was saved by a newer version or a machine having another byte order
+ */
+bool SerializationFile_OpenBuffer(serialization_file_t* restrict const _object, const void* restrict const _image, const size_t _imageSize, const bool _isVerified) {
+	const serialization_header_t* const _header = _image;
+	if (((uintptr_t)_image % sizeof(uint64_t)) // misaligned image
+	|| (_imageSize < sizeof(serialization_header_t))
+	|| memcmp(_header->magic, SERIALIZATION_MAGIC, sizeof(_header->magic))
+	|| (_header->byteOrderMark != SERIALIZATION_BYTEORDERMARK) // saved by a machine having another byte order
+	|| !_header->version || (_header->version > SERIALIZATION_VERSION) // saved by a newer version
+	|| (_header->headerSize < sizeof(serialization_header_t)) || (_header->headerSize > _imageSize)
+	|| (_header->imageSize != _imageSize) // truncated image
+	|| (_header->sectionTableOffset % sizeof(uint64_t)) || (_header->sectionTableOffset > _imageSize)
+	|| (_header->sectionCount > ((_imageSize - _header->sectionTableOffset) / sizeof(serialization_section_t)))) {
+		return false; // malformed header
+	}
+	const serialization_section_t* const _sections = (const serialization_section_t*)((const uint8_t*)_image + _header->sectionTableOffset);
+	for (size_t i = 0; i < _header->sectionCount; i++) {
+		if ((_sections[i].offset % SERIALIZATION_ALIGNMENT)
+		|| (_sections[i].offset < _header->headerSize) || (_sections[i].offset > _imageSize)
+		|| (_sections[i].size > (_imageSize - _sections[i].offset))) {
+			return false; // section is out of bounds
+		}
+	}
+	if (_isVerified
+	&& (_header->checksum != Hash_FNV1a((const uint8_t*)_image + _header->headerSize, _imageSize - _header->headerSize))) {
+		return false; // corrupted image
+	}
+	_object->image = _image;
+	_object->imageSize = _imageSize;
+	_object->sections = _sections;
+	_object->sectionCount = _header->sectionCount;
+	_object->storage = SERIALIZATION_STORAGE_BUFFER;
+	return true;
+}
+
+/* Maps a saved image read-only, so its pages are only read once a loaded container accesses them
+ * Where mapping isn't available, the whole file is read into memory instead
+ * _isVerified = true compares the checksum, which reads the whole image
+ */
+bool SerializationFile_Open(serialization_file_t* restrict const _object, const char* restrict const _path, const bool _isVerified) {
+#ifdef SERIALIZATION_HAS_MMAP
+	const int _descriptor = open(_path, O_RDONLY);
+	if (_descriptor < 0) {
+		return false; // failed opening the file
+	}
+	struct stat _status;
+	if (fstat(_descriptor, &_status) || (_status.st_size <= 0)) {
+		close(_descriptor);
+		return false; // empty file
+	}
+	const size_t _imageSize = (size_t)_status.st_size;
+	void* const _image = mmap(NULL, _imageSize, PROT_READ, MAP_PRIVATE, _descriptor, 0);
+	close(_descriptor); // the mapping stays valid
+	if (_image == MAP_FAILED) {
+		return false; // failed mapping the file
+	}
+	if (!SerializationFile_OpenBuffer(_object, _image, _imageSize, _isVerified)) {
+		munmap(_image, _imageSize);
+		return false; // invalid image
+	}
+	_object->storage = SERIALIZATION_STORAGE_MAPPED;
+	return true;
+#else
+	FILE* const _file = fopen(_path, "rb");
+	if (!_file) {
+		return false; // failed opening the file
+	}
+	long _fileSize = -1;
+	if (!fseek(_file, 0, SEEK_END)) {
+		_fileSize = ftell(_file);
+		rewind(_file);
+	}
+	void* const _image = (_fileSize > 0) ? malloc((size_t)_fileSize) : NULL;
+	const bool _isRead = _image && (fread(_image, 1, (size_t)_fileSize, _file) == (size_t)_fileSize);
+	fclose(_file);
+	if (!_isRead || !SerializationFile_OpenBuffer(_object, _image, (size_t)_fileSize, _isVerified)) {
+		free(_image);
+		return false; // failed reading the file, or invalid image
+	}
+	_object->storage = SERIALIZATION_STORAGE_ALLOCATED;
+	return true;
+#endif
+}
+
+// Releases the image. Every container loaded from it becomes invalid
+void SerializationFile_Close(serialization_file_t* const _object) {
+	switch (_object->storage) {
+#ifdef SERIALIZATION_HAS_MMAP
+	case SERIALIZATION_STORAGE_MAPPED:
+		munmap((void*)_object->image, _object->imageSize);
+	break;
+#endif
+	case SERIALIZATION_STORAGE_ALLOCATED:
+		free((void*)_object->image);
+	break;
+	}
+	_object->image = NULL;
+	_object->imageSize = 0;
+	_object->sections = NULL;
+	_object->sectionCount = 0;
+}
+
+// Returns the type of the section, 0 if the index is out of bounds
+serialization_sectiontype_t SerializationFile_GetSectionType(const serialization_file_t* const _object, const size_t _sectionIndex) {
+	return (_sectionIndex < _object->sectionCount) ? (serialization_sectiontype_t)_object->sections[_sectionIndex].type : 0;
+}
+
+// returns NULL if the index is out of bounds, or the section has another type
+static const serialization_section_t* SerializationFile_GetSection(const serialization_file_t* const _object, const size_t _sectionIndex, const serialization_sectiontype_t _type) {
+	if ((_sectionIndex >= _object->sectionCount) || (_object->sections[_sectionIndex].type != (uint32_t)_type)) {
+		return NULL;
+	}
+	return &_object->sections[_sectionIndex];
+}
+
+/* Loads the BinaryData stored at the section, its buffer is the mapped section itself
+ * Returns false if the section isn't a BinaryData
+ */
+bool SerializationFile_GetBinaryData(const serialization_file_t* restrict const _object, const size_t _sectionIndex, binarydata_t* restrict const out_binaryData) {
+	const serialization_section_t* const _section = SerializationFile_GetSection(_object, _sectionIndex, SERIALIZATION_SECTION_BINARYDATA);
+	if (!_section) {
+		return false;
+	}
+	memset(out_binaryData, 0, sizeof(binarydata_t));
+	out_binaryData->data = (void*)(_object->image + _section->offset);
+	out_binaryData->capacity = _section->size;
+	return true;
+}
+
+/* Loads the DynamicArray stored at the section, its array is the mapped section itself
+ * Returns false if the section isn't a DynamicArray, or is malformed
+ */
+bool SerializationFile_GetDynamicArray(const serialization_file_t* restrict const _object, const size_t _sectionIndex, dynamicarray_t* restrict const out_array) {
+	const serialization_section_t* const _section = SerializationFile_GetSection(_object, _sectionIndex, SERIALIZATION_SECTION_DYNAMICARRAY);
+	if (!_section
+	|| !_section->elementSize
+	|| (_section->elementCount > (_section->size / _section->elementSize))) {
+		return false;
+	}
+	memset(out_array, 0, sizeof(dynamicarray_t)); // expansionRate = 0 forbids expansion
+	out_array->array = (void*)(_object->image + _section->offset);
+	out_array->elementCount = _section->elementCount;
+	out_array->maxElementCount = _section->elementCount;
+	out_array->elementSize = _section->elementSize;
+	return true;
+}
+
+/* Reads the DynamicStringArray stored at the section without copying its strings
+ * Returns false if the section isn't a DynamicStringArray, or is malformed
+ */
+bool SerializationFile_GetStringArrayView(const serialization_file_t* restrict const _object, const size_t _sectionIndex, serialization_stringarrayview_t* restrict const out_view) {
+	const serialization_section_t* const _section = SerializationFile_GetSection(_object, _sectionIndex, SERIALIZATION_SECTION_DYNAMICSTRINGARRAY);
+	if (!_section
+	|| (_section->elementCount >= (_section->size / sizeof(uint64_t)))) { // the table doesn't fit
+		return false;
+	}
+	out_view->section = (const char*)(_object->image + _section->offset);
+	out_view->sectionSize = _section->size;
+	out_view->offsets = (const uint64_t*)out_view->section;
+	out_view->elementCount = _section->elementCount;
+	return true;
+}
+
+/* Reads the Dictionary stored at the section without copying its entries
+ * Returns false if the section isn't a Dictionary, or is malformed
+ */
+bool SerializationFile_GetDictionaryView(const serialization_file_t* restrict const _object, const size_t _sectionIndex, serialization_dictionaryview_t* restrict const out_view) {
+	const serialization_section_t* const _section = SerializationFile_GetSection(_object, _sectionIndex, SERIALIZATION_SECTION_DICTIONARY);
+	if (!_section
+	|| (_section->elementCount > (_section->size / sizeof(serialization_dictionaryentry_t)))) { // the table doesn't fit
+		return false;
+	}
+	out_view->section = _object->image + _section->offset;
+	out_view->sectionSize = _section->size;
+	out_view->entries = (const serialization_dictionaryentry_t*)out_view->section;
+	out_view->elementCount = _section->elementCount;
+	return true;
+}
+
+/* Copies the DynamicStringArray stored at the section into a modifiable DynamicStringArray
+ * Allocates memory to the DynamicStringArray variable if its current value is NULL
+ */
+dynamicstringarray_t* SerializationFile_LoadDynamicStringArray(const serialization_file_t* restrict const _object, const size_t _sectionIndex, dynamicstringarray_t* restrict _stringArray) {
+	serialization_stringarrayview_t _view;
+	if (!SerializationFile_GetStringArrayView(_object, _sectionIndex, &_view)) {
+		return NULL; // not a DynamicStringArray
+	}
+	const bool _mallocVar = !_stringArray;
+	_stringArray = DynamicStringArray_InitAll(_stringArray, _view.elementCount, _view.sectionSize, _DYNAMICARRAY_DEFAULT_EXPANSIONRATE);
+	if (!_stringArray) {
+		return NULL; // insufficient memory
+	}
+	for (size_t i = 0; i < _view.elementCount; i++) {
+		size_t _length;
+		const char* const _string = SerializationStringArray_Get(&_view, i, &_length);
+		if (!_string || !DynamicStringArray_PushSubString(_stringArray, _string, _length)) {
+			if (_mallocVar) {
+				DynamicStringArray_Free(_stringArray);
+			} else {
+				DynamicStringArray_Clear(_stringArray);
+			}
+			return NULL; // malformed string, or insufficient memory
+		}
+	}
+	return _stringArray;
+}
+
+/* Copies the Dictionary stored at the section into a modifiable Dictionary
+ * Allocates memory to the Dictionary variable if its current value is NULL
+ */
+dictionary_t* SerializationFile_LoadDictionary(const serialization_file_t* restrict const _object, const size_t _sectionIndex, dictionary_t* restrict _dictionary) {
+	serialization_dictionaryview_t _view;
+	if (!SerializationFile_GetDictionaryView(_object, _sectionIndex, &_view)) {
+		return NULL; // not a Dictionary
+	}
+	const bool _mallocVar = !_dictionary;
+	_dictionary = Dictionary_InitWithMinSize(_dictionary, _view.elementCount, DICTIONARY_DEFAULT_EXPANSIONRATE);
+	if (!_dictionary) {
+		return NULL; // insufficient memory
+	}
+	for (size_t i = 0; i < _view.elementCount; i++) {
+		const void* _key;
+		size_t _keySize, _dataSize;
+		const void* const _data = SerializationDictionary_GetAt(&_view, i, &_key, &_keySize, &_dataSize);
+		// the entries are already sorted, so every key is appended at the end
+		if (!_data || !Dictionary_Set(_dictionary, _key, _keySize, _data, _dataSize)) {
+			if (_mallocVar) {
+				Dictionary_Free(_dictionary);
+			} else {
+				Dictionary_DeleteAllKeys(_dictionary);
+			}
+			return NULL; // malformed entry, or insufficient memory
+		}
+	}
+	return _dictionary;
+}
+
+/* Returns the string at the index, out_length receives its length. out_length = NULL is allowed
+ * Returns NULL if the index is out of bounds or the string is malformed
+ */
+const char* SerializationStringArray_Get(const serialization_stringarrayview_t* restrict const _view, const size_t _index, size_t* restrict const out_length) {
+	if (_index >= _view->elementCount) {
+		return NULL; // out of bounds
+	}
+	const uint64_t _start = _view->offsets[_index];
+	const uint64_t _end = _view->offsets[_index + 1];
+	if ((_start >= _end) || (_end > _view->sectionSize) || _view->section[_end - 1]) {
+		return NULL; // malformed string
+	}
+	if (out_length) {
+		*out_length = _end - _start - 1;
+	}
+	return _view->section + _start;
+}
+
+// checks that the key and data of the entry are inside the section
+static inline bool SerializationDictionary_IsEntryValid(const serialization_dictionaryview_t* restrict const _view, const serialization_dictionaryentry_t* restrict const _entry) {
+	return (_entry->keyOffset <= _view->sectionSize) && (_entry->keySize <= (_view->sectionSize - _entry->keyOffset))
+		&& (_entry->dataOffset <= _view->sectionSize) && (_entry->dataSize <= (_view->sectionSize - _entry->dataOffset));
+}
+
+/* Reads the entry at the index, the entries are sorted like the Dictionary's entries
+ * out_key, out_keySize and out_dataSize receive the key, its size, and the size of the data. NULL is allowed for each of them
+ * Returns the data, or NULL if the index is out of bounds or the entry is malformed
+ */
+const void* SerializationDictionary_GetAt(
+	const serialization_dictionaryview_t* restrict const _view, const size_t _index,
+	const void** restrict const out_key, size_t* restrict const out_keySize,
+	size_t* restrict const out_dataSize
+) {
+	if (_index >= _view->elementCount) {
+		return NULL; // out of bounds
+	}
+	const serialization_dictionaryentry_t* const _entry = &_view->entries[_index];
+	if (!SerializationDictionary_IsEntryValid(_view, _entry)) {
+		return NULL; // malformed entry
+	}
+	if (out_key) {
+		*out_key = _view->section + _entry->keyOffset;
+	}
+	if (out_keySize) {
+		*out_keySize = _entry->keySize;
+	}
+	if (out_dataSize) {
+		*out_dataSize = _entry->dataSize;
+	}
+	return _view->section + _entry->dataOffset;
+}
+
+/* Searches the key inside the mapped Dictionary, see Dictionary_Get
+ * Returns the data associated with the key, out_dataSize receives its size. out_dataSize = NULL is allowed
+ * Returns NULL if the key was not found, or a traversed entry is malformed
+ */
+const void* SerializationDictionary_Get(
+	const serialization_dictionaryview_t* restrict const _view,
+	const void* restrict const _key, const size_t _keySize,
+	size_t* restrict const out_dataSize
+) {
+	size_t _left = 0;
+	size_t _right = _view->elementCount;
+	while (_left < _right) {
+		const size_t _middle = _left + ((_right - _left) >> 1); // avoid overflow
+		const serialization_dictionaryentry_t* const _entry = &_view->entries[_middle];
+		if (!SerializationDictionary_IsEntryValid(_view, _entry)) {
+			return NULL; // malformed entry
+		}
+		const int8_t _compareResult = Dictionary_CompareKeys(_key, _keySize, _view->section + _entry->keyOffset, _entry->keySize);
+		if (_compareResult < 0) { // key is at the left side
+			_right = _middle;
+		} else if (_compareResult > 0) { // key is at the right side
+			_left = _middle + 1;
+		} else {
+			if (out_dataSize) {
+				*out_dataSize = _entry->dataSize;
+			}
+			return _view->section + _entry->dataOffset;
+		}
+	}
+	return NULL; // key was not found
+}
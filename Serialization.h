@@ -0,0 +1,153 @@
+/*
+ * @File: Serialization.h
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Saves containers into one versioned image that is loaded back by mapping it, without parsing nor copying
+ * @LastUpdate: October 18, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ *
+ * Link Serialization.c, BinaryBuilder.c, DynamicArray.c, DynamicStringArray.c and Dictionary.c.
+ *
+ * Image layout, integers are stored in the byte order of the saving machine:
+ *   header:        serialization_header_t
+ *   sections:      one per added container, each starting at a multiple of SERIALIZATION_ALIGNMENT
+ *   section table: serialization_section_t per section, in the order they were added
+ * Every offset is relative to the start of the image, or to the start of its section, never an address.
+ * So the image can be mapped anywhere, and a loaded BinaryData or DynamicArray points straight into the mapping.
+ * The Dictionary and the DynamicStringArray store pointers, so they are read through the
+ * serialization_dictionaryview_t and serialization_stringarrayview_t which decode the offsets on access.
+ *
+ * Section contents:
+ *   BinaryData:         the bytes
+ *   DynamicArray:       elementCount * elementSize bytes
+ *   DynamicStringArray: uint64_t offsets[elementCount + 1], then every null terminated string.
+ *                       The length of string i is offsets[i + 1] - offsets[i] - 1
+ *   Dictionary:         serialization_dictionaryentry_t[elementCount] sorted like the dictionary,
+ *                       then every key and data, each starting at a multiple of SERIALIZATION_ALIGNMENT
+ *
+ * An image can only be loaded by a machine having the same byte order, the loader rejects the others.
+ * Every loaded container is read-only, and must not be freed nor modified.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "BinaryBuilder.h"
+#include "DynamicArray.h"
+#include "DynamicStringArray.h"
+#include "Dictionary.h"
+
+#define SERIALIZATION_MAGIC "DDSIMAGE"
+#define SERIALIZATION_VERSION 1
+#define SERIALIZATION_BYTEORDERMARK 0xFEFF
+#define SERIALIZATION_ALIGNMENT 16
+
+typedef enum {
+	SERIALIZATION_SECTION_BINARYDATA = 1,
+	SERIALIZATION_SECTION_DYNAMICARRAY,
+	SERIALIZATION_SECTION_DYNAMICSTRINGARRAY,
+	SERIALIZATION_SECTION_DICTIONARY
+} serialization_sectiontype_t;
+
+typedef struct {
+    char magic[8];                // SERIALIZATION_MAGIC without its null terminator
+    uint32_t version;             // SERIALIZATION_VERSION of the saving build
+    uint16_t byteOrderMark;       // SERIALIZATION_BYTEORDERMARK as stored by the saving machine
+    uint16_t headerSize;          // sizeof(serialization_header_t)
+    uint64_t imageSize;
+    uint64_t sectionTableOffset;
+    uint64_t sectionCount;
+    uint64_t checksum;            // FNV-1a of every byte after the header
+} serialization_header_t;
+
+typedef struct {
+    uint32_t type;                // serialization_sectiontype_t
+    uint32_t reserved;
+    uint64_t offset;              // start of the section inside the image
+    uint64_t size;                // size of the section in bytes
+    uint64_t elementCount;        // ignored by BinaryData
+    uint64_t elementSize;         // DynamicArray only
+} serialization_section_t;
+
+typedef struct {
+    uint64_t keyOffset;           // from the start of the section
+    uint64_t keySize;
+    uint64_t dataOffset;          // from the start of the section
+    uint64_t dataSize;
+} serialization_dictionaryentry_t;
+
+typedef struct {
+    binarybuilder_t image;        // the image being built, complete after SerializationWriter_Finish
+    dynamicarray_t sections;      // serialization_section_t of the added containers
+    bool isFinished;
+} serialization_writer_t;
+
+typedef struct {
+    const uint8_t* image;
+    size_t imageSize;
+    const serialization_section_t* sections;
+    size_t sectionCount;
+    uint8_t storage;              // how the image was obtained, tells SerializationFile_Close how to release it
+} serialization_file_t;
+
+typedef struct {
+    const uint8_t* section;
+    size_t sectionSize;
+    const serialization_dictionaryentry_t* entries;
+    size_t elementCount;
+} serialization_dictionaryview_t;
+
+typedef struct {
+    const char* section;
+    size_t sectionSize;
+    const uint64_t* offsets;
+    size_t elementCount;
+} serialization_stringarrayview_t;
+
+bool SerializationWriter_AddBinaryData(serialization_writer_t* restrict const _object, const binarydata_t* restrict const _binaryData);
+bool SerializationWriter_AddDynamicArray(serialization_writer_t* restrict const _object, const dynamicarray_t* restrict const _array);
+bool SerializationWriter_AddDynamicStringArray(serialization_writer_t* restrict const _object, const dynamicstringarray_t* restrict const _stringArray);
+bool SerializationWriter_AddDictionary(serialization_writer_t* restrict const _object, const dictionary_t* restrict const _dictionary);
+bool SerializationWriter_Finish(serialization_writer_t* const _object);
+bool SerializationWriter_SaveToFile(serialization_writer_t* restrict const _object, const char* restrict const _path);
+void SerializationWriter_FreeStorage(serialization_writer_t* const _object);
+void SerializationWriter_Free(serialization_writer_t* _object);
+serialization_writer_t* SerializationWriter_Init(serialization_writer_t* _object);
+
+bool SerializationFile_OpenBuffer(serialization_file_t* restrict const _object, const void* restrict const _image, const size_t _imageSize, const bool _isVerified);
+bool SerializationFile_Open(serialization_file_t* restrict const _object, const char* restrict const _path, const bool _isVerified);
+void SerializationFile_Close(serialization_file_t* const _object);
+serialization_sectiontype_t SerializationFile_GetSectionType(const serialization_file_t* const _object, const size_t _sectionIndex);
+bool SerializationFile_GetBinaryData(const serialization_file_t* restrict const _object, const size_t _sectionIndex, binarydata_t* restrict const out_binaryData);
+bool SerializationFile_GetDynamicArray(const serialization_file_t* restrict const _object, const size_t _sectionIndex, dynamicarray_t* restrict const out_array);
+bool SerializationFile_GetStringArrayView(const serialization_file_t* restrict const _object, const size_t _sectionIndex, serialization_stringarrayview_t* restrict const out_view);
+bool SerializationFile_GetDictionaryView(const serialization_file_t* restrict const _object, const size_t _sectionIndex, serialization_dictionaryview_t* restrict const out_view);
+dynamicstringarray_t* SerializationFile_LoadDynamicStringArray(const serialization_file_t* restrict const _object, const size_t _sectionIndex, dynamicstringarray_t* restrict _stringArray);
+dictionary_t* SerializationFile_LoadDictionary(const serialization_file_t* restrict const _object, const size_t _sectionIndex, dictionary_t* restrict _dictionary);
+
+const char* SerializationStringArray_Get(const serialization_stringarrayview_t* restrict const _view, const size_t _index, size_t* restrict const out_length);
+
+const void* SerializationDictionary_GetAt(
+	const serialization_dictionaryview_t* restrict const _view, const size_t _index,
+	const void** restrict const out_key, size_t* restrict const out_keySize,
+	size_t* restrict const out_dataSize
+);
+const void* SerializationDictionary_Get(
+	const serialization_dictionaryview_t* restrict const _view,
+	const void* restrict const _key, const size_t _keySize,
+	size_t* restrict const out_dataSize
+);
+
+#define SerializationFile_GetSectionCount(_object) ((_object)->sectionCount)
+#define SerializationStringArray_GetCount(_view) ((_view)->elementCount)
+#define SerializationDictionary_GetCount(_view) ((_view)->elementCount)
+#define SerializationDictionary_HasKey(_view, _key, _keySize) (SerializationDictionary_Get(_view, _key, _keySize, NULL) != NULL)
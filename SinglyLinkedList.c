@@ -3,7 +3,7 @@
  * @Author: Aldrin John O. Manalansan (ajom)
  * @Email: aldrinjohnolaermanalansan@gmail.com
  * @Brief: Attempted Implementation of Singly Linked List
- * @LastUpdate: June 7, 2025
+ * @LastUpdate: October 19, 2026
  * 
  * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
  * 
@@ -15,50 +15,309 @@
 
 #include "SinglyLinkedList.h"
 
+#if defined(__GNUC__) || defined(__clang__)
+    #define SINGLYLINKEDLIST_PREFETCH(_address) __builtin_prefetch(_address)
+#else
+    #define SINGLYLINKEDLIST_PREFETCH(_address) ((void)(_address))
+#endif
+
+// memory size of a node together with its payload, padded so that the next carved node stays aligned
+static inline size_t SinglyLinkedList_GetNodeStride(const td_SinglyLinkedList_info *info) {
+    return (sizeof(td_SinglyLinkedList_node) + info->dataSize + (_Alignof(max_align_t) - 1)) & ~(_Alignof(max_align_t) - 1);
+}
+
+/*
+ * Allocates a slab that can hold nodeCount nodes and makes it the slab where new nodes are carved from
+ * Returns NULL if the slab allocation fails
+ */
+static td_SinglyLinkedList_slab* SinglyLinkedList_AllocateSlab(td_SinglyLinkedList_info *info, const size_t nodeCount) {
+    td_SinglyLinkedList_slab *slab = malloc(sizeof(td_SinglyLinkedList_slab) + (nodeCount * SinglyLinkedList_GetNodeStride(info)));
+    if (!slab) {
+        return NULL; // failed allocating memory
+    }
+    INSTRUMENTATION_ALLOCATION(&info->instrumentation, sizeof(td_SinglyLinkedList_slab) + (nodeCount * SinglyLinkedList_GetNodeStride(info)));
+    INSTRUMENTATION_GROWTH(&info->instrumentation, sizeof(td_SinglyLinkedList_slab) + (nodeCount * SinglyLinkedList_GetNodeStride(info)));
+    slab->nodeCount = nodeCount;
+    slab->usedCount = 0;
+    slab->next = info->slabs;
+    if (!info->slabs) { // first slab of the list
+        info->lastSlab = slab;
+    }
+    info->slabs = slab;
+    return slab;
+}
+
+/*
+ * Pops a node from the free list, carving it from a slab if the free list is empty
+ * The returned node is not chained to the list
+ * Returns NULL if node creation fails
+ */
+static td_SinglyLinkedList_node* SinglyLinkedList_AllocateNode(td_SinglyLinkedList_info *info) {
+    td_SinglyLinkedList_node *node = info->freeNodes;
+    if (node) { // reuse a deleted node
+        info->freeNodes = node->next;
+        return node;
+    }
+    td_SinglyLinkedList_slab *slab = info->slabs;
+    if (!slab || (slab->usedCount >= slab->nodeCount)) { // current slab is exhausted
+        slab = SinglyLinkedList_AllocateSlab(info, info->slabNodeCount ? info->slabNodeCount : SINGLYLINKEDLIST_DEFAULT_SLABNODECOUNT);
+        if (!slab) {
+            return NULL; // insufficient memory
+        }
+    }
+    node = (td_SinglyLinkedList_node*)(slab->nodes + (slab->usedCount * SinglyLinkedList_GetNodeStride(info)));
+    slab->usedCount++;
+    return node;
+}
+
+// returns the node to the free list so that a newer node can reuse it
+static inline void SinglyLinkedList_ReleaseNode(td_SinglyLinkedList_info *info, td_SinglyLinkedList_node *node) {
+    node->next = info->freeNodes;
+    info->freeNodes = node;
+}
+
 /*
  * Deletes all nodes found on the list
+ * Nodes are released together with the slabs they were carved from
  */
 void SinglyLinkedList_DeleteAllNodes(td_SinglyLinkedList_info *info) {
-    if (info->first) {
-        td_SinglyLinkedList_node *node = info->first;
-        do { // traverse
-            if (node->data) {
-                free(node->data);
-            }
-            td_SinglyLinkedList_node *deleted = node;
-            node = node->next;
-            free(deleted);
-        } while (node);
-        
-        info->first = NULL;
-        info->indexed = NULL;
-        info->last = NULL;
+    td_SinglyLinkedList_slab *slab = info->slabs;
+    while (slab) { // traverse
+        td_SinglyLinkedList_slab *deleted = slab;
+        slab = slab->next;
+        free(deleted);
+        INSTRUMENTATION_FREE(&info->instrumentation);
     }
+    info->slabs = NULL;
+    info->lastSlab = NULL;
+    info->freeNodes = NULL;
+    info->first = NULL;
+    info->indexed = NULL;
+    info->last = NULL;
+    info->nodeCount = 0;
 }
 
 /*
  * Creates a new node at the end of the list and returns its pointer
+ * The node and its payload are carved from the list's slabs as one memory block
+ * data = NULL leaves the payload uninitialized
  * Returns NULL if node creation fails
  */
 td_SinglyLinkedList_node* SinglyLinkedList_AddNode(td_SinglyLinkedList_info *info, const void *data) {
-    td_SinglyLinkedList_node *newNode = malloc(sizeof(td_SinglyLinkedList_node));
-    if (newNode) { // allocated successfully
-        newNode->data = malloc(info->dataSize);
-        if (!newNode->data) { // failed to allocate memory
-            free(newNode); // cancel node creation
-        } else {
-            newNode->next = NULL;
-            if (!info->first) { // first node doesn't exist yet
-                info->first = newNode;
+    td_SinglyLinkedList_node *newNode = SinglyLinkedList_AllocateNode(info);
+    if (!newNode) {
+        return NULL; // node creation failed
+    }
+    if (data) {
+        memcpy(newNode->data, data, info->dataSize);
+    }
+    newNode->next = NULL;
+    if (!info->first) { // first node doesn't exist yet
+        info->first = newNode;
+    }
+    if (info->last) { // last node exists
+        info->last->next = newNode; // chain the last node to the new node
+    }
+    info->last = newNode; // update last node to newly created node
+    info->nodeCount++;
+    return newNode;
+}
+
+/*
+ * Creates a new node at the start of the list and returns its pointer
+ * data = NULL leaves the payload uninitialized
+ * Returns NULL if node creation fails
+ */
+td_SinglyLinkedList_node* SinglyLinkedList_PushFront(td_SinglyLinkedList_info *info, const void *data) {
+    td_SinglyLinkedList_node *newNode = SinglyLinkedList_AllocateNode(info);
+    if (!newNode) {
+        return NULL; // node creation failed
+    }
+    if (data) {
+        memcpy(newNode->data, data, info->dataSize);
+    }
+    newNode->next = info->first;
+    info->first = newNode;
+    if (!info->last) { // list was empty
+        info->last = newNode;
+    }
+    info->nodeCount++;
+    return newNode;
+}
+
+// unchains the node that follows prev (prev = NULL for the first node) and returns it to the free list
+static void SinglyLinkedList_DeleteNode(td_SinglyLinkedList_info *info, td_SinglyLinkedList_node *prev, td_SinglyLinkedList_node *node) {
+    if (info->first == node) {
+        info->first = node->next;
+    }
+    if (info->last == node) {
+        info->last = prev;
+        if (info->indexed == node) {
+            info->indexed = info->first;
+        }
+    } else if (info->indexed == node) {
+        info->indexed = node->next;
+    }
+    if (prev) {
+        prev->next = node->next;
+    }
+    info->nodeCount--;
+    SinglyLinkedList_ReleaseNode(info, node);
+}
+
+/*
+ * Copies the payload of the first node to out_data, then deletes the node
+ * out_data = NULL discards the payload
+ * The deleted node is reused by the next node creation, so PushFront/PopFront cycles do not allocate
+ * Returns false if the list is empty
+ */
+bool SinglyLinkedList_PopFront(td_SinglyLinkedList_info *info, void *out_data) {
+    td_SinglyLinkedList_node *node = info->first;
+    if (!node) {
+        return false; // list is empty
+    }
+    if (out_data) {
+        memcpy(out_data, node->data, info->dataSize);
+    }
+    SinglyLinkedList_DeleteNode(info, NULL, node);
+    return true;
+}
+
+/*
+ * Creates a new node after the last node whose data is less than or equal to data, keeping an ascending list ascending
+ * CompareFunction returns a negative value, zero, or a positive value when its first data is less than, equal to, or greater than its second data
+ * data = NULL is not allowed since it is needed for the comparison
+ * Returns NULL if node creation fails
+ */
+td_SinglyLinkedList_node* SinglyLinkedList_SortedInsert(td_SinglyLinkedList_info *info, const void *data, int (*CompareFunction)(const void*, const void*, void*), void *context) {
+    td_SinglyLinkedList_node *prev = NULL;
+    for (td_SinglyLinkedList_node *node = info->first; node && ((*CompareFunction)(node->data, data, context) <= 0); node = node->next) {
+        SINGLYLINKEDLIST_PREFETCH(node->next);
+        prev = node;
+    }
+    td_SinglyLinkedList_node *newNode = SinglyLinkedList_AllocateNode(info);
+    if (!newNode) {
+        return NULL; // node creation failed
+    }
+    memcpy(newNode->data, data, info->dataSize);
+    if (prev) {
+        newNode->next = prev->next;
+        prev->next = newNode;
+    } else {
+        newNode->next = info->first;
+        info->first = newNode;
+    }
+    if (info->last == prev) { // inserted at the end of the list
+        info->last = newNode;
+    }
+    info->nodeCount++;
+    return newNode;
+}
+
+/*
+ * Sorts the list in ascending order using a bottom-up merge sort
+ * Nodes are relinked in place, so no payload is copied and only O(1) extra memory is used
+ * The sort is stable: nodes with equal data keep their relative order
+ * CompareFunction returns a negative value, zero, or a positive value when its first data is less than, equal to, or greater than its second data
+ */
+void SinglyLinkedList_Sort(td_SinglyLinkedList_info *info, int (*CompareFunction)(const void*, const void*, void*), void *context) {
+    td_SinglyLinkedList_node *list = info->first;
+    if (!list) {
+        return; // nothing to sort
+    }
+    for (size_t runSize = 1;; runSize *= 2) { // merge adjacent runs of runSize nodes
+        td_SinglyLinkedList_node *left = list;
+        td_SinglyLinkedList_node *tail = NULL;
+        size_t mergeCount = 0;
+        list = NULL;
+        while (left) {
+            mergeCount++;
+            td_SinglyLinkedList_node *right = left;
+            size_t leftSize = 0;
+            do { // the right run starts after runSize nodes
+                leftSize++;
+                right = right->next;
+            } while (right && (leftSize < runSize));
+            size_t rightSize = runSize;
+            while (leftSize || (rightSize && right)) {
+                td_SinglyLinkedList_node *picked;
+                if (!leftSize) {
+                    picked = right;
+                    right = right->next;
+                    rightSize--;
+                } else if (!rightSize || !right || ((*CompareFunction)(left->data, right->data, context) <= 0)) { // ties pick the left run for stability
+                    picked = left;
+                    left = left->next;
+                    leftSize--;
+                } else {
+                    picked = right;
+                    right = right->next;
+                    rightSize--;
+                }
+                if (tail) {
+                    tail->next = picked;
+                } else {
+                    list = picked;
+                }
+                tail = picked;
             }
-            if (info->last) { // last node exists
-                info->last->next = newNode; // chain the last node to the new node
+            left = right;
+        }
+        tail->next = NULL;
+        if (mergeCount <= 1) { // the whole list was merged into a single run
+            info->first = list;
+            info->last = tail;
+            return;
+        }
+    }
+}
+
+/*
+ * Moves all the nodes of the source list in between position and its next node in O(1)
+ * position = NULL moves the nodes at the start of the destination list
+ * The source's slabs are handed over to the destination, leaving the source empty
+ * Returns false if both lists doesn't have the same data size
+ */
+bool SinglyLinkedList_Splice(td_SinglyLinkedList_info *destination, td_SinglyLinkedList_node *position, td_SinglyLinkedList_info *source) {
+    if ((destination == source) || (destination->dataSize != source->dataSize)) {
+        return false; // incompatible lists
+    }
+    if (source->first) { // relink the source's nodes
+        if (position) {
+            source->last->next = position->next;
+            position->next = source->first;
+        } else {
+            source->last->next = destination->first;
+            destination->first = source->first;
+        }
+        if (destination->last == position) { // source's nodes became the tail
+            destination->last = source->last;
+        }
+        destination->nodeCount += source->nodeCount;
+    }
+    if (source->slabs) { // hand over the slabs owning the moved nodes
+        if (!destination->slabs) {
+            destination->slabs = source->slabs;
+            destination->lastSlab = source->lastSlab;
+        } else { // keep carving from the destination's current slab
+            source->lastSlab->next = destination->slabs->next;
+            destination->slabs->next = source->slabs;
+            if (destination->lastSlab == destination->slabs) {
+                destination->lastSlab = source->lastSlab;
             }
-            info->last = newNode; // update last node to newly created node
-            return newNode;
         }
     }
-    return NULL; // node creation failed
+    if (!destination->freeNodes) { // otherwise, the source's free nodes stay unused until the slabs are released
+        destination->freeNodes = source->freeNodes;
+    }
+    source->first = NULL;
+    source->indexed = NULL;
+    source->last = NULL;
+    source->nodeCount = 0;
+    source->slabs = NULL;
+    source->lastSlab = NULL;
+    source->freeNodes = NULL;
+    return true;
 }
 
 /*
@@ -76,25 +335,7 @@ uint32_t SinglyLinkedList_DeleteNodeByCondition(td_SinglyLinkedList_info *info,
             if (!(*InspectorFunction)(node->data)) {
                 prev = node;
             } else { // inspected node matches the required condition
-                    // delete the node
-                if (info->first == node) {
-                    info->first = node->next;
-                }
-                if (info->last == node) {
-                    info->last = prev;
-                    if (info->indexed == node) {
-                        info->indexed = info->first;
-                    }
-                } else if (info->indexed == node) {
-                    info->indexed = node->next;
-                }
-                if (prev) {
-                    prev->next = node->next;
-                }
-                free(node->data);
-                free(node);
-                    //
-
+                SinglyLinkedList_DeleteNode(info, prev, node);
                 deletedCount++;
                 if (trueOnce) {
                     return deletedCount;
@@ -106,21 +347,164 @@ uint32_t SinglyLinkedList_DeleteNodeByCondition(td_SinglyLinkedList_info *info,
     return deletedCount;
 }
 
+/*
+ * Passes every node's data together with the context to the InspectorFunction
+ * The InspectorFunction returns SINGLYLINKEDLIST_DELETE to delete the inspected node,
+ * and/or SINGLYLINKEDLIST_STOP to end the traversal after the inspected node
+ * The next node is prefetched while the InspectorFunction runs
+ * Returns the number of nodes deleted from the list
+ */
+uint32_t SinglyLinkedList_DeleteNodesWithContext(td_SinglyLinkedList_info *info, uint8_t (*InspectorFunction)(const void*, void*), void *context) {
+    uint32_t deletedCount = 0;
+    td_SinglyLinkedList_node *prev = NULL;
+    td_SinglyLinkedList_node *node = info->first;
+    while (node) { // traverse
+        td_SinglyLinkedList_node *nextNode = node->next;
+        SINGLYLINKEDLIST_PREFETCH(nextNode);
+        const uint8_t verdict = (*InspectorFunction)(node->data, context);
+        if (verdict & SINGLYLINKEDLIST_DELETE) {
+            SinglyLinkedList_DeleteNode(info, prev, node);
+            deletedCount++;
+        } else {
+            prev = node;
+        }
+        if (verdict & SINGLYLINKEDLIST_STOP) {
+            break;
+        }
+        node = nextNode;
+    }
+    return deletedCount;
+}
+
+/*
+ * Returns the first node which the InspectorFunction evaluated as true
+ * The next node is prefetched while the InspectorFunction runs
+ * Returns NULL if no node matched
+ */
+td_SinglyLinkedList_node* SinglyLinkedList_FindFirst(const td_SinglyLinkedList_info *info, bool (*InspectorFunction)(const void*, void*), void *context) {
+    for (td_SinglyLinkedList_node *node = info->first; node; node = node->next) {
+        SINGLYLINKEDLIST_PREFETCH(node->next);
+        if ((*InspectorFunction)(node->data, context)) {
+            return node;
+        }
+    }
+    return NULL; // no node matched
+}
+
 /*
  * Executes the passed function to every nodes on the list
  */
 void SinglyLinkedList_ExecuteFunctionForEachNode(td_SinglyLinkedList_info *info, void (*ExecutedFunction)(const void*)) {
-    uint32_t deletedCount = 0;
     if (info->first) {
         td_SinglyLinkedList_node *node = info->first;
         do { // traverse
+            SINGLYLINKEDLIST_PREFETCH(node->next);
             (*ExecutedFunction)(node->data);
             node = node->next;
         } while (node);
     }
 }
 
-void SinglyLinkedList_Reset(td_SinglyLinkedList_info *info, const size_t size) {
+/*
+ * Executes the passed function to every nodes on the list, passing the context along with the node's data
+ * The function returns SINGLYLINKEDLIST_STOP to end the traversal early, or SINGLYLINKEDLIST_CONTINUE otherwise
+ * The next node is prefetched while the function runs
+ * Returns the node where the traversal stopped, or NULL if every node was visited
+ */
+td_SinglyLinkedList_node* SinglyLinkedList_ExecuteFunctionForEachNodeWithContext(td_SinglyLinkedList_info *info, uint8_t (*ExecutedFunction)(void*, void*), void *context) {
+    for (td_SinglyLinkedList_node *node = info->first; node; node = node->next) {
+        SINGLYLINKEDLIST_PREFETCH(node->next);
+        if ((*ExecutedFunction)(node->data, context) & SINGLYLINKEDLIST_STOP) {
+            return node;
+        }
+    }
+    return NULL; // every node was visited
+}
+
+/*
+ * Copies the payload of every node, in order, to the destination dynamicarray
+ * The destination is reinitialized to hold exactly the list's node count, then filled in one traversal
+ * set destination = NULL to create a new dynamicarray object
+ * Returns NULL if the dynamicarray could not be initialized
+ */
+dynamicarray_t* SinglyLinkedList_ToDynamicArray(const td_SinglyLinkedList_info *info, dynamicarray_t *destination) {
+    destination = DynamicArray_InitAll(destination, info->dataSize, info->nodeCount ? info->nodeCount : 1, _object_DEFAULT_EXPANSIONRATE);
+    if (!destination) {
+        return NULL;
+    }
+    uint8_t *element = destination->array;
+    for (const td_SinglyLinkedList_node *node = info->first; node; node = node->next) {
+        SINGLYLINKEDLIST_PREFETCH(node->next);
+        memcpy(element, node->data, info->dataSize);
+        element += info->dataSize;
+    }
+    destination->elementCount = info->nodeCount;
+    INSTRUMENTATION_MOVE(&destination->instrumentation, info->nodeCount * info->dataSize);
+    return destination;
+}
+
+/*
+ * Appends a node for every element of the source dynamicarray, in order
+ * All the nodes are carved from a single slab allocation
+ * Returns false if the element size differs from the list's data size, or if the slab allocation fails
+ */
+bool SinglyLinkedList_FromDynamicArray(td_SinglyLinkedList_info *info, const dynamicarray_t *source) {
+    if (source->elementSize != info->dataSize) {
+        return false; // incompatible layout
+    }
+    if (!source->elementCount) {
+        return true; // nothing to append
+    }
+    const size_t stride = SinglyLinkedList_GetNodeStride(info);
+    td_SinglyLinkedList_slab *slab = malloc(sizeof(td_SinglyLinkedList_slab) + (source->elementCount * stride));
+    if (!slab) {
+        return false; // insufficient memory
+    }
+    INSTRUMENTATION_ALLOCATION(&info->instrumentation, sizeof(td_SinglyLinkedList_slab) + (source->elementCount * stride));
+    INSTRUMENTATION_GROWTH(&info->instrumentation, sizeof(td_SinglyLinkedList_slab) + (source->elementCount * stride));
+    INSTRUMENTATION_MOVE(&info->instrumentation, source->elementCount * info->dataSize);
+    slab->nodeCount = source->elementCount;
+    slab->usedCount = source->elementCount;
+    if (info->slabs) { // keep carving from the current slab
+        slab->next = info->slabs->next;
+        info->slabs->next = slab;
+        if (info->lastSlab == info->slabs) {
+            info->lastSlab = slab;
+        }
+    } else {
+        slab->next = NULL;
+        info->slabs = slab;
+        info->lastSlab = slab;
+    }
+
+    const uint8_t *element = source->array;
+    td_SinglyLinkedList_node *node = (td_SinglyLinkedList_node*)slab->nodes;
+    if (info->last) {
+        info->last->next = node;
+    } else {
+        info->first = node;
+    }
+    for (size_t i = 1; i < source->elementCount; i++) { // chain every node to its neighbor inside the slab
+        td_SinglyLinkedList_node *nextNode = (td_SinglyLinkedList_node*)((uint8_t*)node + stride);
+        memcpy(node->data, element, info->dataSize);
+        node->next = nextNode;
+        node = nextNode;
+        element += info->dataSize;
+    }
+    memcpy(node->data, element, info->dataSize);
+    node->next = NULL;
+    info->last = node;
+    info->nodeCount += source->elementCount;
+    return true;
+}
+
+/*
+ * Deletes all nodes and prepares the list to store payloads of size bytes
+ * slabNodeCount is the number of nodes carved from every slab allocation
+ */
+void SinglyLinkedList_ResetWithSlabSize(td_SinglyLinkedList_info *info, const size_t size, const size_t slabNodeCount) {
     SinglyLinkedList_DeleteAllNodes(info);
+    INSTRUMENTATION_RESET(&info->instrumentation);
     info->dataSize = size;
+    info->slabNodeCount = slabNodeCount;
 }
\ No newline at end of file
@@ -3,7 +3,7 @@
  * @Author: Aldrin John O. Manalansan (ajom)
  * @Email: aldrinjohnolaermanalansan@gmail.com
  * @Brief: Attempted Implementation of Singly Linked List
- * @LastUpdate: June 7, 2025
+ * @LastUpdate: October 19, 2026
  * 
  * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
  * 
@@ -20,24 +20,66 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <string.h>
 
+#include "DynamicArray.h"
+#include "Instrumentation.h"
+
+#define SINGLYLINKEDLIST_DEFAULT_SLABNODECOUNT 64
+
+// verdicts returned by the context-passing callbacks
+#define SINGLYLINKEDLIST_CONTINUE 0
+#define SINGLYLINKEDLIST_DELETE 1 // deletes the inspected node
+#define SINGLYLINKEDLIST_STOP 2   // ends the traversal after the inspected node
+
+// the payload is stored after the next pointer, inside the same allocation, aligned for any type
 typedef struct td_SinglyLinkedList_node {
-	void *data;
 	struct td_SinglyLinkedList_node *next;
+	_Alignas(max_align_t) uint8_t data[]; // dataSize bytes
 } td_SinglyLinkedList_node;
 
+// a large memory block where nodes are carved from
+typedef struct td_SinglyLinkedList_slab {
+	struct td_SinglyLinkedList_slab *next;
+	size_t nodeCount; // how much nodes this slab can hold
+	size_t usedCount; // how much nodes has been carved from this slab
+	_Alignas(max_align_t) uint8_t nodes[]; // nodeCount nodes, each one SinglyLinkedList_GetNodeStride bytes apart
+} td_SinglyLinkedList_slab;
+
 typedef struct {
 	size_t dataSize;
 	td_SinglyLinkedList_node *first;
 	td_SinglyLinkedList_node *indexed;
 	td_SinglyLinkedList_node *last;
+	size_t nodeCount;                    // how much nodes is currently chained to the list
+	size_t slabNodeCount;                // how much nodes every newly allocated slab can hold
+	td_SinglyLinkedList_slab *slabs;     // newest slab first, new nodes are carved from it
+	td_SinglyLinkedList_slab *lastSlab;  // oldest slab, allows the slabs to be handed over in O(1)
+	td_SinglyLinkedList_node *freeNodes; // deleted nodes waiting to be reused
+#ifdef DDS_INSTRUMENTATION
+	instrumentation_counters_t instrumentation; // every slab counts as one allocation and one growth
+#endif
 } td_SinglyLinkedList_info;
 
 void SinglyLinkedList_DeleteAllNodes(td_SinglyLinkedList_info *info);
 td_SinglyLinkedList_node* SinglyLinkedList_AddNode(td_SinglyLinkedList_info *info, const void *data);
+td_SinglyLinkedList_node* SinglyLinkedList_PushFront(td_SinglyLinkedList_info *info, const void *data);
+bool SinglyLinkedList_PopFront(td_SinglyLinkedList_info *info, void *out_data);
+td_SinglyLinkedList_node* SinglyLinkedList_SortedInsert(td_SinglyLinkedList_info *info, const void *data, int (*CompareFunction)(const void*, const void*, void*), void *context);
+void SinglyLinkedList_Sort(td_SinglyLinkedList_info *info, int (*CompareFunction)(const void*, const void*, void*), void *context);
+bool SinglyLinkedList_Splice(td_SinglyLinkedList_info *destination, td_SinglyLinkedList_node *position, td_SinglyLinkedList_info *source);
 uint32_t SinglyLinkedList_DeleteNodeByCondition(td_SinglyLinkedList_info *info, bool (*InspectorFunction)(const void*), bool trueOnce);
+uint32_t SinglyLinkedList_DeleteNodesWithContext(td_SinglyLinkedList_info *info, uint8_t (*InspectorFunction)(const void*, void*), void *context);
+td_SinglyLinkedList_node* SinglyLinkedList_FindFirst(const td_SinglyLinkedList_info *info, bool (*InspectorFunction)(const void*, void*), void *context);
 void SinglyLinkedList_ExecuteFunctionForEachNode(td_SinglyLinkedList_info *info, void (*ExecutedFunction)(const void*));
-void SinglyLinkedList_Reset(td_SinglyLinkedList_info *info, const size_t size);
+td_SinglyLinkedList_node* SinglyLinkedList_ExecuteFunctionForEachNodeWithContext(td_SinglyLinkedList_info *info, uint8_t (*ExecutedFunction)(void*, void*), void *context);
+dynamicarray_t* SinglyLinkedList_ToDynamicArray(const td_SinglyLinkedList_info *info, dynamicarray_t *destination);
+bool SinglyLinkedList_FromDynamicArray(td_SinglyLinkedList_info *info, const dynamicarray_t *source);
+void SinglyLinkedList_ResetWithSlabSize(td_SinglyLinkedList_info *info, const size_t size, const size_t slabNodeCount);
+
+#define SinglyLinkedList_Concat(destination, source) SinglyLinkedList_Splice(destination, (destination)->last, source)
+#define SinglyLinkedList_GetNodeCount(info) ((info)->nodeCount)
+#define SinglyLinkedList_Reset(info, size) SinglyLinkedList_ResetWithSlabSize(info, size, SINGLYLINKEDLIST_DEFAULT_SLABNODECOUNT)
 
 #endif /* SINGLYLINKEDLIST_H */
\ No newline at end of file
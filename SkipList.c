@@ -0,0 +1,254 @@
+/*
+ * @File: SkipList.c
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Ordered container with O(log n) insertion, searching and deletion
+ * @LastUpdate: October 19, 2026
+ * 
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ * 
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ */
+
+#include "SkipList.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// loads the successor of a node at a level, pairing with the release store that published it
+static inline skiplist_node_t* SkipList_LoadNext(const skiplist_node_t* const _node, const size_t _level) {
+	return atomic_load_explicit(&_node->next[_level], memory_order_acquire);
+}
+
+// picks a level where each higher level is 4 times less likely than the previous one
+static uint8_t SkipList_PickLevel(skiplist_t* const _object) {
+	uint64_t _random = _object->randomState; // xorshift64
+	_random ^= _random << 13;
+	_random ^= _random >> 7;
+	_random ^= _random << 17;
+	_object->randomState = _random;
+	uint8_t _level = 1;
+	while ((_level < SKIPLIST_MAX_LEVEL) && !(_random & 3)) {
+		_level++;
+		_random >>= 2;
+	}
+	return _level;
+}
+
+/* finds the rightmost node of every level whose element is less than the key
+ * Returns the level 0 predecessor
+ */
+static skiplist_node_t* SkipList_FindPredecessors(
+	const skiplist_t* restrict const _object,
+	const void* restrict const _key,
+	skiplist_node_t** restrict const out_Predecessors
+) {
+	skiplist_node_t* _node = _object->head;
+	for (size_t _level = atomic_load_explicit(&_object->levelCount, memory_order_relaxed); _level--;) {
+		skiplist_node_t* _next;
+		while ((_next = SkipList_LoadNext(_node, _level)) && (_object->Compare(SkipList_GetNodeData(_next), _key, _object->context) < 0)) {
+			_node = _next;
+		}
+		if (out_Predecessors) {
+			out_Predecessors[_level] = _node;
+		}
+	}
+	return _node;
+}
+
+// Frees all the nodes of the skiplist, making it look empty
+void SkipList_Clear(skiplist_t* const _object) {
+	skiplist_node_t* _node = SkipList_LoadNext(_object->head, 0);
+	while (_node) { // traverse
+		skiplist_node_t* const _deleted = _node;
+		_node = SkipList_LoadNext(_node, 0);
+		free(_deleted);
+		INSTRUMENTATION_FREE(&_object->instrumentation);
+	}
+	for (size_t _level = 0; _level < SKIPLIST_MAX_LEVEL; _level++) {
+		atomic_store_explicit(&_object->head->next[_level], NULL, memory_order_relaxed);
+	}
+	atomic_store_explicit(&_object->levelCount, 1, memory_order_relaxed);
+	atomic_store_explicit(&_object->elementCount, 0, memory_order_relaxed);
+}
+
+// Frees all the nodes of the skiplist together with its sentinel
+// Since the storage has been freed, it must be re-initialized again before reusing it.
+void SkipList_FreeStorage(skiplist_t* const _object) {
+	INSTRUMENTATION_TRACE_FORGET(INSTRUMENTATION_OPERATION_SKIPLIST_INSERT, _object);
+	if (_object->head) { // has allocated sentinel
+		SkipList_Clear(_object);
+		free(_object->head);
+		INSTRUMENTATION_FREE(&_object->instrumentation);
+		_object->head = NULL;
+	}
+}
+
+/* Frees a SkipList object
+ * CAUTION! Do not pass pointer to a permanent SkipList variable!
+ */
+void SkipList_Free(skiplist_t* _object) {
+	SkipList_FreeStorage(_object);
+	free((void*)_object);
+	INSTRUMENTATION_FREE(NULL);
+}
+
+// SkipList_Insert without recording its latency nor its trace
+static inline void* SkipList_InsertUntimed(skiplist_t* restrict const _object, const void* restrict const _value) {
+	skiplist_node_t* _predecessors[SKIPLIST_MAX_LEVEL];
+	skiplist_node_t* _node = _object->head;
+	const uint8_t _objectLevelCount = atomic_load_explicit(&_object->levelCount, memory_order_relaxed);
+	for (size_t _level = _objectLevelCount; _level--;) { // find the rightmost node that is less than or equal to the value
+		skiplist_node_t* _next;
+		while ((_next = SkipList_LoadNext(_node, _level)) && (_object->Compare(SkipList_GetNodeData(_next), _value, _object->context) <= 0)) {
+			_node = _next;
+		}
+		_predecessors[_level] = _node;
+	}
+
+	const uint8_t _levelCount = SkipList_PickLevel(_object);
+	skiplist_node_t* const _newNode = malloc(SkipList_GetDataOffset(_levelCount) + _object->elementSize);
+	if (!_newNode) {
+		return NULL; // insufficient memory
+	}
+	INSTRUMENTATION_ALLOCATION(&_object->instrumentation, SkipList_GetDataOffset(_levelCount) + _object->elementSize);
+	_newNode->levelCount = _levelCount;
+	for (size_t _level = _objectLevelCount; _level < _levelCount; _level++) { // new levels start at the sentinel
+		_predecessors[_level] = _object->head;
+	}
+	for (size_t _level = 0; _level < _levelCount; _level++) { // the node isn't reachable yet
+		atomic_init(&_newNode->next[_level], SkipList_LoadNext(_predecessors[_level], _level));
+	}
+	void* const _data = SkipList_GetNodeData(_newNode);
+	memcpy(_data, _value, _object->elementSize);
+
+	for (size_t _level = 0; _level < _levelCount; _level++) { // publish bottom-up, each release orders the node's initialization before its link
+		atomic_store_explicit(&_predecessors[_level]->next[_level], _newNode, memory_order_release);
+	}
+	if (_objectLevelCount < _levelCount) {
+		atomic_store_explicit(&_object->levelCount, _levelCount, memory_order_relaxed);
+	}
+	atomic_store_explicit(&_object->elementCount, atomic_load_explicit(&_object->elementCount, memory_order_relaxed) + 1, memory_order_relaxed);
+	return _data;
+}
+
+/* Inserts a copy of the value at its ordered position, after any equal elements
+ * The node is fully initialized before being chained from the lowest level up with release stores,
+ * and readers follow the links with acquire loads, so SkipList_Find, SkipList_LowerBound and the node
+ * traversal macros may run concurrently with a single inserting thread and never observe a partially built node
+ * Concurrent inserts, and deletions or clearing concurrent with anything, still require external synchronization
+ * Returns a pointer to the stored element
+ * Returns NULL if the element wasn't inserted due to insufficient memory
+ */
+void* SkipList_Insert(skiplist_t* restrict const _object, const void* restrict const _value) {
+	INSTRUMENTATION_TRACE(INSTRUMENTATION_OPERATION_SKIPLIST_INSERT, _object, 0, _object->elementSize, _value, _object->elementSize);
+	INSTRUMENTATION_LATENCY_BEGIN(_start);
+	void* const _data = SkipList_InsertUntimed(_object, _value);
+	INSTRUMENTATION_LATENCY_END(INSTRUMENTATION_OPERATION_SKIPLIST_INSERT, _start);
+	return _data;
+}
+
+/* Returns the first node whose element is not less than the key
+ * Iterate from it with SkipList_GetNextNode to perform an ordered range scan
+ * Returns NULL if every element is less than the key
+ */
+skiplist_node_t* SkipList_LowerBound(const skiplist_t* restrict const _object, const void* restrict const _key) {
+	return SkipList_LoadNext(SkipList_FindPredecessors(_object, _key, NULL), 0);
+}
+
+/* Searches the first element that is equal to the key
+ * Returns a pointer to the stored element
+ * Returns NULL if no element is equal to the key
+ */
+void* SkipList_Find(const skiplist_t* restrict const _object, const void* restrict const _key) {
+	skiplist_node_t* const _node = SkipList_LowerBound(_object, _key);
+	if (!_node) {
+		return NULL; // all elements are less than the key
+	}
+	void* const _data = SkipList_GetNodeData(_node);
+	return _object->Compare(_data, _key, _object->context) ? NULL : _data;
+}
+
+// SkipList_Delete without recording its latency nor its trace
+static inline bool SkipList_DeleteUntimed(skiplist_t* restrict const _object, const void* restrict const _key) {
+	skiplist_node_t* _predecessors[SKIPLIST_MAX_LEVEL];
+	skiplist_node_t* const _node = SkipList_LoadNext(SkipList_FindPredecessors(_object, _key, _predecessors), 0);
+	if (!_node || _object->Compare(SkipList_GetNodeData(_node), _key, _object->context)) {
+		return false; // key not found
+	}
+	for (size_t _level = 0; _level < _node->levelCount; _level++) { // unchain the node from every level it belongs to
+		atomic_store_explicit(&_predecessors[_level]->next[_level], SkipList_LoadNext(_node, _level), memory_order_release);
+	}
+	free(_node);
+	INSTRUMENTATION_FREE(&_object->instrumentation);
+	uint8_t _levelCount = atomic_load_explicit(&_object->levelCount, memory_order_relaxed);
+	while ((_levelCount > 1) && !SkipList_LoadNext(_object->head, _levelCount - 1)) { // drop the emptied levels
+		_levelCount--;
+	}
+	atomic_store_explicit(&_object->levelCount, _levelCount, memory_order_relaxed);
+	atomic_store_explicit(&_object->elementCount, atomic_load_explicit(&_object->elementCount, memory_order_relaxed) - 1, memory_order_relaxed);
+	return true;
+}
+
+// Deletes the first element that is equal to the key
+bool SkipList_Delete(skiplist_t* restrict const _object, const void* restrict const _key) {
+	INSTRUMENTATION_TRACE(INSTRUMENTATION_OPERATION_SKIPLIST_DELETE, _object, 0, _object->elementSize, _key, _object->elementSize);
+	INSTRUMENTATION_LATENCY_BEGIN(_start);
+	const bool _isDeleted = SkipList_DeleteUntimed(_object, _key);
+	INSTRUMENTATION_LATENCY_END(INSTRUMENTATION_OPERATION_SKIPLIST_DELETE, _start);
+	return _isDeleted;
+}
+
+// Executes the passed function to every elements on the skiplist, in ascending order
+void SkipList_ExecuteFunctionForEachElement(const skiplist_t* const _object, void (*ExecutedFunction)(const void*)) {
+	for (const skiplist_node_t* _node = SkipList_GetFirstNode(_object); _node; _node = SkipList_GetNextNode(_node)) {
+		(*ExecutedFunction)(SkipList_GetNodeData(_node));
+	}
+}
+
+/* Properly initializes the SkipList variable, discarding its previous elements
+ * Allocates memory to the SkipList variable if its current value is NULL
+ * A permanent variable must have its head set to NULL, or be already initialized
+ * _seed must be non-zero, it makes the shape of the skiplist reproducible
+ */
+skiplist_t* SkipList_InitAll(skiplist_t* _object, const size_t _elementSize, const skiplist_compare_t _Compare, void* const _context, const uint64_t _seed) {
+	bool _mallocVar;
+	if (!_object) { // if we are requesting to initialize it
+		_object = malloc(sizeof(skiplist_t));
+		if (!_object) {
+			return NULL; // failed allocating skiplist variable
+		}
+		_object->head = NULL; // indicate the sentinel requires allocation later
+		_mallocVar = true;
+	} else {
+		_mallocVar = false;
+	}
+	if (_object->head) { // already initialized, its nodes must not leak
+		SkipList_Clear(_object);
+	} else {
+		_object->head = calloc(1, sizeof(skiplist_node_t) + (SKIPLIST_MAX_LEVEL * sizeof(skiplist_link_t)));
+		if (!_object->head) {
+			if (_mallocVar) {
+				free(_object);
+			}
+			return NULL; // failed allocating the sentinel
+		}
+	}
+	INSTRUMENTATION_RESET(&_object->instrumentation);
+	if (_mallocVar) {
+		INSTRUMENTATION_ALLOCATION(&_object->instrumentation, sizeof(skiplist_t));
+	}
+	INSTRUMENTATION_ALLOCATION(&_object->instrumentation, sizeof(skiplist_node_t) + (SKIPLIST_MAX_LEVEL * sizeof(skiplist_link_t)));
+	_object->head->levelCount = SKIPLIST_MAX_LEVEL;
+	atomic_init(&_object->elementCount, 0);
+	_object->elementSize = _elementSize;
+	atomic_init(&_object->levelCount, 1);
+	_object->randomState = _seed ? _seed : SKIPLIST_DEFAULT_SEED;
+	_object->Compare = _Compare;
+	_object->context = _context;
+	return _object; // initialization sucessful
+}
@@ -0,0 +1,72 @@
+/*
+ * @File: SkipList.h
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Ordered container with O(log n) insertion, searching and deletion
+ * @LastUpdate: October 19, 2026
+ * 
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ * 
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+#include "Instrumentation.h"
+
+#define SKIPLIST_MAX_LEVEL 32
+#define SKIPLIST_DEFAULT_SEED 0x9E3779B97F4A7C15ULL
+
+/* compares two elements
+ * returns a negative value if _a < _b
+ * returns 0 if _a == _b
+ * returns a positive value if _a > _b
+ */
+typedef int (*skiplist_compare_t)(const void* _a, const void* _b, void* _context);
+
+// chains a node to its successor, stored with release ordering and loaded with acquire ordering
+typedef _Atomic(struct skiplist_node_t*) skiplist_link_t;
+
+// the node's levels and its payload are allocated as one memory block
+typedef struct skiplist_node_t {
+    uint8_t levelCount;             // how much levels this node is chained to
+    skiplist_link_t next[];         // levelCount links, followed by elementSize bytes of payload at SkipList_GetDataOffset
+} skiplist_node_t;
+
+typedef struct {
+    skiplist_node_t* head;          // sentinel chained to every level
+    atomic_size_t elementCount;     // how much elements is currently stored
+    size_t elementSize;             // size per element
+    atomic_uint_least8_t levelCount; // highest level currently used by a node
+    uint64_t randomState;           // xorshift state used to pick the level of new nodes
+    skiplist_compare_t Compare;
+    void* context;                  // passed to every Compare call
+#ifdef DDS_INSTRUMENTATION
+    instrumentation_counters_t instrumentation; // every node counts as one allocation
+#endif
+} skiplist_t;
+
+void SkipList_Clear(skiplist_t* const _object);
+void SkipList_FreeStorage(skiplist_t* const _object);
+void SkipList_Free(skiplist_t* _object);
+void* SkipList_Insert(skiplist_t* restrict const _object, const void* restrict const _value);
+skiplist_node_t* SkipList_LowerBound(const skiplist_t* restrict const _object, const void* restrict const _key);
+void* SkipList_Find(const skiplist_t* restrict const _object, const void* restrict const _key);
+bool SkipList_Delete(skiplist_t* restrict const _object, const void* restrict const _key);
+void SkipList_ExecuteFunctionForEachElement(const skiplist_t* const _object, void (*ExecutedFunction)(const void*));
+skiplist_t* SkipList_InitAll(skiplist_t* _object, const size_t _elementSize, const skiplist_compare_t _Compare, void* const _context, const uint64_t _seed);
+
+#define SkipList_Init(_object, _elementSize, _Compare, _context) SkipList_InitAll(_object, _elementSize, _Compare, _context, SKIPLIST_DEFAULT_SEED)
+// offset of the payload inside a node of _levelCount levels, padded to be aligned for any type
+#define SkipList_GetDataOffset(_levelCount) ((sizeof(skiplist_node_t) + ((_levelCount) * sizeof(skiplist_link_t)) + (_Alignof(max_align_t) - 1)) & ~(_Alignof(max_align_t) - 1))
+#define SkipList_GetNodeData(_node) ((void*)((uint8_t*)(_node) + SkipList_GetDataOffset((_node)->levelCount)))
+#define SkipList_GetFirstNode(_object) SkipList_GetNextNode((_object)->head)
+#define SkipList_GetNextNode(_node) atomic_load_explicit(&(_node)->next[0], memory_order_acquire)
@@ -0,0 +1,154 @@
+/*
+ * @File: SlotMap.c
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Densely packed container whose elements are addressed by generation checked handles
+ * @LastUpdate: October 18, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ */
+
+#include "SlotMap.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// assures that the slot map can insert the number of elements without expanding
+bool SlotMap_ReserveElements(slotmap_t* const _object, const size_t _reservedElementCount) {
+	return DynamicArray_ReserveElements(&_object->elements, _reservedElementCount)
+		&& DynamicArray_ReserveElements(&_object->denseSlots, _reservedElementCount);
+}
+
+/* Copies the value at the end of the packed elements, _value = NULL fills the element with zeroes
+ * Returns the handle of the inserted element
+ * Returns SLOTMAP_INVALIDHANDLE if the element was not inserted due to insufficient memory
+ */
+slotmap_handle_t SlotMap_Insert(slotmap_t* restrict const _object, const void* restrict const _value) {
+	const bool _isNewSlot = (_object->freeSlot == SLOTMAP_NOSLOT);
+	if ((_isNewSlot && (_object->slots.elementCount >= SLOTMAP_NOSLOT)) // every slot index is used
+	|| !SlotMap_ReserveElements(_object, 1)
+	|| (_isNewSlot && !DynamicArray_ReserveElements(&_object->slots, 1))) {
+		return SLOTMAP_INVALIDHANDLE; // insufficient memory
+	}
+	uint32_t _slotIndex;
+	if (_isNewSlot) {
+		const slotmap_slot_t _newSlot = {.index = 0, .generation = 0};
+		_slotIndex = (uint32_t)_object->slots.elementCount;
+		DynamicArray_Push(&_object->slots, &_newSlot);
+	} else { // reuse a free slot
+		_slotIndex = _object->freeSlot;
+	}
+	slotmap_slot_t* const _slot = (slotmap_slot_t*)_object->slots.array + _slotIndex;
+	if (!_isNewSlot) {
+		_object->freeSlot = _slot->index; // next free slot
+	}
+
+	const size_t _denseIndex = _object->elements.elementCount;
+	if (_value) {
+		DynamicArray_Push(&_object->elements, _value);
+	} else {
+		memset((uint8_t*)_object->elements.array + (_denseIndex * _object->elements.elementSize), 0, _object->elements.elementSize);
+		_object->elements.elementCount++;
+	}
+	DynamicArray_Push(&_object->denseSlots, &_slotIndex);
+
+	_slot->index = (uint32_t)_denseIndex;
+	_slot->generation++; // odd, the slot is occupied
+	return ((slotmap_handle_t)_slot->generation << 32) | _slotIndex;
+}
+
+/* Removes the element addressed by the handle. The last element is moved into its place
+ * Returns false if the handle is stale
+ */
+bool SlotMap_Remove(slotmap_t* const _object, const slotmap_handle_t _handle) {
+	if (!SlotMap_Get(_object, _handle)) {
+		return false; // stale handle
+	}
+	const uint32_t _slotIndex = (uint32_t)_handle;
+	slotmap_slot_t* const _slots = _object->slots.array;
+	uint32_t* const _denseSlots = _object->denseSlots.array;
+	const size_t _elementSize = _object->elements.elementSize;
+	const uint32_t _denseIndex = _slots[_slotIndex].index;
+	const size_t _lastIndex = _object->elements.elementCount - 1;
+	if (_denseIndex != _lastIndex) { // keep the elements packed
+		memcpy((uint8_t*)_object->elements.array + ((size_t)_denseIndex * _elementSize), (uint8_t*)_object->elements.array + (_lastIndex * _elementSize), _elementSize);
+		INSTRUMENTATION_MOVE(&_object->elements.instrumentation, _elementSize);
+		const uint32_t _movedSlotIndex = _denseSlots[_lastIndex];
+		_denseSlots[_denseIndex] = _movedSlotIndex;
+		_slots[_movedSlotIndex].index = _denseIndex;
+	}
+	_object->elements.elementCount--;
+	_object->denseSlots.elementCount--;
+
+	slotmap_slot_t* const _slot = &_slots[_slotIndex];
+	_slot->generation++; // even, the slot is free
+	if (_slot->generation) { // a wrapped around generation retires the slot
+		_slot->index = _object->freeSlot;
+		_object->freeSlot = _slotIndex;
+	}
+	return true;
+}
+
+// Removes every element, every handle becomes stale
+void SlotMap_Clear(slotmap_t* const _object) {
+	slotmap_slot_t* const _slots = _object->slots.array;
+	const uint32_t* const _denseSlots = _object->denseSlots.array;
+	for (size_t i = 0; i < _object->elements.elementCount; i++) {
+		slotmap_slot_t* const _slot = &_slots[_denseSlots[i]];
+		_slot->generation++; // even, the slot is free
+		if (_slot->generation) { // a wrapped around generation retires the slot
+			_slot->index = _object->freeSlot;
+			_object->freeSlot = _denseSlots[i];
+		}
+	}
+	_object->elements.elementCount = 0;
+	_object->denseSlots.elementCount = 0;
+}
+
+void SlotMap_FreeStorage(slotmap_t* const _object) {
+	DynamicArray_FreeBuffer(&_object->elements);
+	DynamicArray_FreeBuffer(&_object->denseSlots);
+	DynamicArray_FreeBuffer(&_object->slots);
+}
+
+/* Frees a SlotMap object
+ * CAUTION! Do not pass pointer to a permanent SlotMap variable!
+ */
+void SlotMap_Free(slotmap_t* _object) {
+	SlotMap_FreeStorage(_object);
+	free((void*)_object);
+}
+
+/* Properly initializes the SlotMap variable, removing its previous elements and slots
+ * Allocates memory to the SlotMap variable if its current value is NULL
+ */
+slotmap_t* SlotMap_InitAll(slotmap_t* _object, const size_t _elementSize, const size_t _minCount) {
+	bool _mallocVar;
+	if (!_object) { // if we are requesting to initialize it
+		_object = malloc(sizeof(slotmap_t));
+		if (!_object) {
+			return NULL; // failed allocating slotmap variable
+		}
+		_object->elements.array = NULL; // indicate buffer requires initialization later
+		_object->denseSlots.array = NULL;
+		_object->slots.array = NULL;
+		_mallocVar = true;
+	} else {
+		_mallocVar = false;
+	}
+	if (!DynamicArray_InitAll(&_object->elements, _elementSize, _minCount, _object_DEFAULT_EXPANSIONRATE)
+	|| !DynamicArray_InitAll(&_object->denseSlots, sizeof(uint32_t), _minCount, _object_DEFAULT_EXPANSIONRATE)
+	|| !DynamicArray_InitAll(&_object->slots, sizeof(slotmap_slot_t), _minCount, _object_DEFAULT_EXPANSIONRATE)) {
+		if (_mallocVar) {
+			SlotMap_Free(_object);
+		}
+		return NULL; // insufficient memory
+	}
+	_object->freeSlot = SLOTMAP_NOSLOT;
+	return _object; // initialization sucessful
+}
@@ -0,0 +1,85 @@
+/*
+ * @File: SlotMap.h
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Densely packed container whose elements are addressed by generation checked handles
+ * @LastUpdate: October 18, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ *
+ * The elements are packed at the start of one DynamicArray, so iterating them is a plain array walk.
+ * Every inserted element receives a slot that keeps its dense index, and a handle = slot index + slot generation.
+ * Removing an element moves the last element into its place, and bumps the generation of its slot,
+ * so every handle of the removed element becomes stale instead of addressing whichever element reuses the slot.
+ * A slot whose generation wraps around is retired, so a stale handle can never become valid again.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "DynamicArray.h"
+
+#define SLOTMAP_DEFAULT_INITIALCOUNT 30
+#define SLOTMAP_INVALIDHANDLE ((slotmap_handle_t)0) // never returned for an inserted element
+#define SLOTMAP_NOSLOT UINT32_MAX
+
+typedef uint64_t slotmap_handle_t; // lower 32 bits: slot index, upper 32 bits: generation of the slot
+
+typedef struct {
+    uint32_t index;         // dense index of the element while occupied, next free slot while free
+    uint32_t generation;    // odd while occupied, even while free
+} slotmap_slot_t;
+
+typedef struct {
+    dynamicarray_t elements;    // the elements, packed
+    dynamicarray_t denseSlots;  // uint32_t slot index of every element
+    dynamicarray_t slots;       // slotmap_slot_t, indexed by the handles
+    uint32_t freeSlot;          // first slot of the free list, SLOTMAP_NOSLOT if there's none
+} slotmap_t;
+
+bool SlotMap_ReserveElements(slotmap_t* const _object, const size_t _reservedElementCount);
+slotmap_handle_t SlotMap_Insert(slotmap_t* restrict const _object, const void* restrict const _value);
+bool SlotMap_Remove(slotmap_t* const _object, const slotmap_handle_t _handle);
+void SlotMap_Clear(slotmap_t* const _object);
+void SlotMap_FreeStorage(slotmap_t* const _object);
+void SlotMap_Free(slotmap_t* _object);
+slotmap_t* SlotMap_InitAll(slotmap_t* _object, const size_t _elementSize, const size_t _minCount);
+
+#define SlotMap_Init(_object, _elementSize) SlotMap_InitAll(_object, _elementSize, SLOTMAP_DEFAULT_INITIALCOUNT)
+#define SlotMap_GetCount(_object) ((_object)->elements.elementCount)
+#define SlotMap_GetElements(_object) ((_object)->elements.array) // the packed elements, invalidated by any insertion or removal
+#define SlotMap_Contains(_object, _handle) (SlotMap_Get(_object, _handle) != NULL)
+
+/* Returns a pointer to the element addressed by the handle
+ * Returns NULL if the handle is stale, or was never returned by SlotMap_Insert
+ * WARNING: the pointer becomes invalid once an element is inserted or removed
+ */
+static inline void* SlotMap_Get(const slotmap_t* const _object, const slotmap_handle_t _handle) {
+	const uint32_t _slotIndex = (uint32_t)_handle;
+	const uint32_t _generation = (uint32_t)(_handle >> 32);
+	if (_slotIndex >= _object->slots.elementCount) {
+		return NULL; // out of bounds
+	}
+	const slotmap_slot_t* const _slot = (const slotmap_slot_t*)_object->slots.array + _slotIndex;
+	if ((_slot->generation != _generation) || !(_generation & 1)) {
+		return NULL; // stale handle
+	}
+	return (uint8_t*)_object->elements.array + ((size_t)_slot->index * _object->elements.elementSize);
+}
+
+// Returns the handle of the element at the dense index, SLOTMAP_INVALIDHANDLE if the index is out of bounds
+static inline slotmap_handle_t SlotMap_GetHandleAt(const slotmap_t* const _object, const size_t _denseIndex) {
+	if (_denseIndex >= _object->elements.elementCount) {
+		return SLOTMAP_INVALIDHANDLE;
+	}
+	const uint32_t _slotIndex = ((const uint32_t*)_object->denseSlots.array)[_denseIndex];
+	return ((slotmap_handle_t)((const slotmap_slot_t*)_object->slots.array)[_slotIndex].generation << 32) | _slotIndex;
+}
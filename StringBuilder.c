@@ -3,7 +3,7 @@
  * @Author: Aldrin John O. Manalansan (ajom)
  * @Email: aldrinjohnolaermanalansan@gmail.com
  * @Brief: Dynamically construct strings without worrying about the allocated memory size
- * @LastUpdate: June 16, 2025
+ * @LastUpdate: October 18, 2026
  * 
  * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
  * 
@@ -41,17 +41,18 @@ size_t StringBuilder_Delete(stringbuilder_t* const _stringBuilder, size_t _lengt
 	return _length;
 }
 
-/* Inserts a single character at the write offset without deleting any characters at the current string
+/* Inserts a single character at the write offset, shifting the characters after it and expanding the buffer if necessary. See StringBuilder_InsertCharacter
  * Returns an offset to where the byte got written
  * Returns -1 if the byte wasn't written
  */
-uintptr_t StringBuilder_InsertCharacter(stringbuilder_t* const _stringBuilder, const char character) {
+uintptr_t StringBuilder_InsertCharacterSlow(stringbuilder_t* const _stringBuilder, const char character) {
 	if (UINTPTR_MAX == StringBuilder_ReserveStringLength(_stringBuilder, 1)) {
 		return UINTPTR_MAX; // insufficient memory
 	}
 	const uintptr_t initialOffset = _stringBuilder->writePtr - _stringBuilder->string;
 	if (_stringBuilder->writePtr < _stringBuilder->endPtr) { // write pointer is in between the string content of the buffer
 		memmove(_stringBuilder->writePtr + 1, _stringBuilder->writePtr, _stringBuilder->endPtr - _stringBuilder->writePtr);
+		INSTRUMENTATION_MOVE(&_stringBuilder->instrumentation, _stringBuilder->endPtr - _stringBuilder->writePtr);
 	}
 	*_stringBuilder->writePtr = character; // change the character at the write pointer to our desired character
 	_stringBuilder->writePtr++;
@@ -115,6 +116,7 @@ uintptr_t StringBuilder_InsertFormattedString(stringbuilder_t* const _stringBuil
 	if (_stringBuilder->writePtr < _stringBuilder->endPtr) { // write pointer is in between the string content of the buffer
 		// shift the righthand substring to the right
 		memmove(_stringBuilder->writePtr + _length, _stringBuilder->writePtr, _stringBuilder->endPtr - _stringBuilder->writePtr);
+		INSTRUMENTATION_MOVE(&_stringBuilder->instrumentation, _stringBuilder->endPtr - _stringBuilder->writePtr);
 	}
 	char savedChar = _stringBuilder->writePtr[_length]; // temporarily save the character before it becomes a null terminator later
 	vsprintf(_stringBuilder->writePtr, _format, _args);
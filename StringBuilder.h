@@ -3,7 +3,7 @@
  * @Author: Aldrin John O. Manalansan (ajom)
  * @Email: aldrinjohnolaermanalansan@gmail.com
  * @Brief: Dynamically construct strings without worrying about the allocated memory size
- * @LastUpdate: June 16, 2025
+ * @LastUpdate: October 18, 2026
  * 
  * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
  * 
@@ -34,6 +34,9 @@ typedef struct {
     char* writePtr;
     char* endPtr;       	// buffer <= writePtr <= endPtr <= (buffer + capacity - 1)
 	float expansionRate;	// how much memory is increased every memory expansion
+#ifdef DDS_INSTRUMENTATION
+    instrumentation_counters_t instrumentation; // mirrors binarybuilder_t
+#endif
 } stringbuilder_t;
 
 // assures the minimum size of the string buffer. Expanding its memory size if necessary
@@ -91,7 +94,7 @@ static inline void StringBuilder_InitUsingBuffer(stringbuilder_t* const _stringB
 char* StringBuilder_GetStringWithOffset(const stringbuilder_t* const _stringBuilder, const uintptr_t offset);
 size_t StringBuilder_GetUsedLength(stringbuilder_t* const _stringBuilder);
 size_t StringBuilder_Delete(stringbuilder_t* const _stringBuilder, size_t _length);
-uintptr_t StringBuilder_InsertCharacter(stringbuilder_t* const _stringBuilder, const char character);
+uintptr_t StringBuilder_InsertCharacterSlow(stringbuilder_t* const _stringBuilder, const char character);
 uintptr_t StringBuilder_InsertCharacters(stringbuilder_t* const _stringBuilder, const char* restrict const _str, const size_t _length);
 uintptr_t StringBuilder_InsertString(stringbuilder_t* const _stringBuilder, const char* restrict const _str);
 uintptr_t StringBuilder_InsertFormattedString(stringbuilder_t* const _stringBuilder, const char* _format, ...);
@@ -101,3 +104,23 @@ void StringBuilder_Clear(stringbuilder_t* const _stringBuilder);
 #define StringBuilder_SetAutoExpand(_stringBuilder) StringBuilder_SetAutoExpandWithMinSize(_stringBuilder, _STRINGBUILDER_INITIALCAPACITY, _STRINGBUILDER_BUFFEREXPANSIONRATE)
 #define StringBuilder_GetExpansionRate(_stringBuilder) ((_stringBuilder)->expansionRate - 1.0)
 #define StringBuilder_SetExpansionRate(_stringBuilder, _expansionRate) ((_stringBuilder)->expansionRate = (_expansionRate) + 1.0)
+
+/* Inserts a single character at the write offset without deleting any characters at the current string
+ * appends the character inline while the write offset is at the end and the buffer has room,
+ * else StringBuilder_InsertCharacterSlow shifts the following characters or expands the buffer
+ * Returns an offset to where the byte got written
+ * Returns -1 if the byte wasn't written
+ */
+static inline uintptr_t StringBuilder_InsertCharacter(stringbuilder_t* const _stringBuilder, const char character) {
+	if ((_stringBuilder->writePtr != _stringBuilder->endPtr) // requires shifting
+	|| ((size_t)((_stringBuilder->string + _stringBuilder->capacity) - _stringBuilder->endPtr) < 2)) { // no room for the character and the null terminator
+		return StringBuilder_InsertCharacterSlow(_stringBuilder, character);
+	}
+	const uintptr_t initialOffset = _stringBuilder->writePtr - _stringBuilder->string;
+	char* const _writePtr = _stringBuilder->writePtr;
+	_writePtr[0] = character;
+	_writePtr[1] = 0; // null terminator
+	_stringBuilder->writePtr = _writePtr + 1;
+	_stringBuilder->endPtr = _writePtr + 1;
+	return initialOffset;
+}
@@ -0,0 +1,281 @@
+/*
+ * @File: TraceRecorder.c
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Records the container operations into a compact binary trace that can be replayed offline
+ * @LastUpdate: October 19, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ */
+
+#include "TraceRecorder.h"
+#include "Hash.h"
+
+#include <string.h>
+
+static const tracerecorder_container_t traceRecorderOperationContainers[INSTRUMENTATION_OPERATION_COUNT] = {
+	[INSTRUMENTATION_OPERATION_BINARYBUILDER_DELETE] = TRACERECORDER_CONTAINER_BINARYBUILDER,
+	[INSTRUMENTATION_OPERATION_BINARYBUILDER_INSERTBYTES] = TRACERECORDER_CONTAINER_BINARYBUILDER,
+	[INSTRUMENTATION_OPERATION_DYNAMICARRAY_DELETE] = TRACERECORDER_CONTAINER_DYNAMICARRAY,
+	[INSTRUMENTATION_OPERATION_DYNAMICARRAY_INSERT] = TRACERECORDER_CONTAINER_DYNAMICARRAY,
+	[INSTRUMENTATION_OPERATION_DYNAMICARRAY_PUSH] = TRACERECORDER_CONTAINER_DYNAMICARRAY,
+	[INSTRUMENTATION_OPERATION_DYNAMICSTRINGARRAY_DELETE] = TRACERECORDER_CONTAINER_DYNAMICSTRINGARRAY,
+	[INSTRUMENTATION_OPERATION_DYNAMICSTRINGARRAY_INSERTSUBSTRING] = TRACERECORDER_CONTAINER_DYNAMICSTRINGARRAY,
+	[INSTRUMENTATION_OPERATION_DICTIONARY_DELETEKEY] = TRACERECORDER_CONTAINER_DICTIONARY,
+	[INSTRUMENTATION_OPERATION_DICTIONARY_GETENTRY] = TRACERECORDER_CONTAINER_DICTIONARY,
+	[INSTRUMENTATION_OPERATION_DICTIONARY_SET] = TRACERECORDER_CONTAINER_DICTIONARY,
+	[INSTRUMENTATION_OPERATION_UNROLLEDLINKEDLIST_PUSH] = TRACERECORDER_CONTAINER_UNROLLEDLINKEDLIST,
+	[INSTRUMENTATION_OPERATION_SKIPLIST_DELETE] = TRACERECORDER_CONTAINER_SKIPLIST,
+	[INSTRUMENTATION_OPERATION_SKIPLIST_INSERT] = TRACERECORDER_CONTAINER_SKIPLIST
+};
+
+// Returns the kind of container the operation is called on
+tracerecorder_container_t TraceRecorder_GetOperationContainer(const instrumentation_operation_t _operation) {
+	return traceRecorderOperationContainers[_operation];
+}
+
+// Returns true if the records of the operation carry a key hash
+bool TraceRecorder_IsKeyedOperation(const instrumentation_operation_t _operation) {
+	const tracerecorder_container_t _container = traceRecorderOperationContainers[_operation];
+	return (_container == TRACERECORDER_CONTAINER_DICTIONARY) || (_container == TRACERECORDER_CONTAINER_SKIPLIST);
+}
+
+static inline size_t TraceRecorder_WriteVarint(uint8_t* const _destination, uint64_t _value) {
+	size_t _size = 0;
+	do {
+		const uint8_t _byte = (uint8_t)(_value & 0x7F);
+		_value >>= 7;
+		_destination[_size++] = _byte | (_value ? 0x80 : 0);
+	} while (_value);
+	return _size;
+}
+
+static inline void TraceRecorder_WriteUInt(uint8_t* const _destination, uint64_t _value, const size_t _size) {
+	for (size_t i = 0; i < _size; i++, _value >>= 8) {
+		_destination[i] = (uint8_t)_value;
+	}
+}
+
+static inline uint64_t TraceRecorder_ReadUInt(const uint8_t* const _source, const size_t _size) {
+	uint64_t _value = 0;
+	for (size_t i = _size; i--;) {
+		_value = (_value << 8) | _source[i];
+	}
+	return _value;
+}
+
+// returns the offset after the varint, 0 if the varint is truncated or too long
+static size_t TraceRecorder_ReadVarint(const uint8_t* restrict const _trace, const size_t _traceSize, size_t _offset, uint64_t* restrict const out_value) {
+	uint64_t _value = 0;
+	for (unsigned _shift = 0; (_offset < _traceSize) && (_shift < 64); _shift += 7) {
+		const uint8_t _byte = _trace[_offset++];
+		_value |= (uint64_t)(_byte & 0x7F) << _shift;
+		if (!(_byte & 0x80)) {
+			*out_value = _value;
+			return _offset;
+		}
+	}
+	return 0; // corrupted
+}
+
+/* Validates the header of a trace
+ * Returns the offset of the first record
+ * Returns 0 if the trace wasn't recorded by a compatible build
+ */
+size_t TraceRecorder_ReadHeader(const void* const _trace, const size_t _traceSize) {
+	const uint8_t* const _bytes = (const uint8_t*)_trace;
+	if ((_traceSize < TRACERECORDER_HEADERSIZE)
+	|| memcmp(_bytes, TRACERECORDER_MAGIC, 8)
+	|| (TraceRecorder_ReadUInt(_bytes + 8, 4) != TRACERECORDER_VERSION)
+	|| (TraceRecorder_ReadUInt(_bytes + 12, 4) != INSTRUMENTATION_OPERATION_COUNT)) {
+		return 0; // not a trace, or the operations are numbered differently
+	}
+	return TRACERECORDER_HEADERSIZE;
+}
+
+/* Decodes the record located at the offset
+ * Returns the offset of the next record
+ * Returns 0 if there are no more records, or if the record is corrupted
+ */
+size_t TraceRecorder_ReadRecord(const void* restrict const _trace, const size_t _traceSize, size_t _offset, tracerecorder_record_t* restrict const out_record) {
+	const uint8_t* const _bytes = (const uint8_t*)_trace;
+	if ((_offset >= _traceSize) || (_bytes[_offset] >= INSTRUMENTATION_OPERATION_COUNT)) {
+		return 0; // end of the trace, or unknown operation
+	}
+	out_record->operation = (instrumentation_operation_t)_bytes[_offset++];
+	if (!(_offset = TraceRecorder_ReadVarint(_bytes, _traceSize, _offset, &out_record->objectId))
+	|| !(_offset = TraceRecorder_ReadVarint(_bytes, _traceSize, _offset, &out_record->argument0))
+	|| !(_offset = TraceRecorder_ReadVarint(_bytes, _traceSize, _offset, &out_record->argument1))) {
+		return 0; // truncated record
+	}
+	out_record->keyHash = 0;
+	if (TraceRecorder_IsKeyedOperation(out_record->operation)) {
+		if ((_traceSize - _offset) < 8) {
+			return 0; // truncated record
+		}
+		out_record->keyHash = TraceRecorder_ReadUInt(_bytes + _offset, 8);
+		_offset += 8;
+	}
+	return _offset;
+}
+
+#ifdef DDS_TRACE_RECORDING
+
+#include "Dictionary.h"
+
+#include <stdatomic.h>
+
+typedef struct {
+	uintptr_t object;
+	uint8_t container;
+} tracerecorder_objectkey_t;
+
+static atomic_flag traceRecorderLock = ATOMIC_FLAG_INIT;
+static _Atomic(binarybuilder_t*) traceRecorderTrace; // NULL while not recording, read without the lock by the recorded calls
+static dictionary_t traceRecorderObjects;       // maps the living recorded objects to their objectId
+static uint64_t traceRecorderObjectCount;       // objectId of the next object that appears
+static size_t traceRecorderDroppedCount;        // calls that couldn't be recorded due to insufficient memory
+static _Thread_local bool traceRecorderIsBusy;  // the recorder's own container calls must not be recorded
+
+static inline void TraceRecorder_Lock(void) {
+	while (atomic_flag_test_and_set_explicit(&traceRecorderLock, memory_order_acquire));
+}
+
+static inline void TraceRecorder_Unlock(void) {
+	atomic_flag_clear_explicit(&traceRecorderLock, memory_order_release);
+}
+
+/* Starts appending the recorded calls at the write offset of the trace, starting with the trace header
+ * The trace must be an initialized auto expanding BinaryBuilder, it must not be used until TraceRecorder_Stop is called
+ * Returns false if a recording is already in progress, or due to insufficient memory
+ */
+bool TraceRecorder_Start(binarybuilder_t* const _trace) {
+	traceRecorderIsBusy = true;
+	TraceRecorder_Lock();
+	bool _isStarted = false;
+	if (!atomic_load_explicit(&traceRecorderTrace, memory_order_relaxed) && Dictionary_Init(&traceRecorderObjects)) {
+		uint8_t _header[TRACERECORDER_HEADERSIZE];
+		memcpy(_header, TRACERECORDER_MAGIC, 8);
+		TraceRecorder_WriteUInt(_header + 8, TRACERECORDER_VERSION, 4);
+		TraceRecorder_WriteUInt(_header + 12, INSTRUMENTATION_OPERATION_COUNT, 4);
+		if (UINTPTR_MAX != BinaryBuilder_SetBytes(_trace, _header, TRACERECORDER_HEADERSIZE)) {
+			traceRecorderObjectCount = 0;
+			traceRecorderDroppedCount = 0;
+			atomic_store_explicit(&traceRecorderTrace, _trace, memory_order_release);
+			_isStarted = true;
+		} else {
+			Dictionary_Free_Storage(&traceRecorderObjects);
+		}
+	}
+	TraceRecorder_Unlock();
+	traceRecorderIsBusy = false;
+	return _isStarted;
+}
+
+/* Stops the recording, the trace can be used again
+ * Returns how many calls couldn't be recorded due to insufficient memory
+ */
+size_t TraceRecorder_Stop(void) {
+	traceRecorderIsBusy = true;
+	TraceRecorder_Lock();
+	const size_t _droppedCount = traceRecorderDroppedCount;
+	if (atomic_load_explicit(&traceRecorderTrace, memory_order_relaxed)) {
+		atomic_store_explicit(&traceRecorderTrace, NULL, memory_order_release);
+		Dictionary_Free_Storage(&traceRecorderObjects);
+	}
+	TraceRecorder_Unlock();
+	traceRecorderIsBusy = false;
+	return _droppedCount;
+}
+
+// the key of an object inside traceRecorderObjects, objects of different containers may share an address
+static inline tracerecorder_objectkey_t TraceRecorder_GetObjectKey(const instrumentation_operation_t _operation, const void* const _object) {
+	tracerecorder_objectkey_t _objectKey;
+	memset(&_objectKey, 0, sizeof(_objectKey)); // the padding is part of the dictionary key
+	_objectKey.object = (uintptr_t)_object;
+	_objectKey.container = (uint8_t)traceRecorderOperationContainers[_operation];
+	return _objectKey;
+}
+
+// Appends a call to the trace, called by the containers through INSTRUMENTATION_TRACE
+void TraceRecorder_Record(
+	const instrumentation_operation_t _operation, const void* const _object,
+	const uint64_t _argument0, const uint64_t _argument1,
+	const void* const _key, const size_t _keySize
+) {
+	if (traceRecorderIsBusy || !atomic_load_explicit(&traceRecorderTrace, memory_order_acquire)) {
+		return; // not recording, or called by the recorder itself
+	}
+	traceRecorderIsBusy = true;
+	TraceRecorder_Lock();
+	binarybuilder_t* const _trace = atomic_load_explicit(&traceRecorderTrace, memory_order_relaxed); // the lock orders it
+	if (_trace) { // recording wasn't stopped while waiting
+		const tracerecorder_objectkey_t _objectKey = TraceRecorder_GetObjectKey(_operation, _object);
+		uint64_t _objectId;
+		const uint64_t* const _storedId = Dictionary_Get(&traceRecorderObjects, &_objectKey, sizeof(_objectKey), NULL);
+		if (_storedId) {
+			_objectId = *_storedId;
+		} else { // first call on this object
+			_objectId = traceRecorderObjectCount;
+			if (Dictionary_Set(&traceRecorderObjects, &_objectKey, sizeof(_objectKey), &_objectId, sizeof(_objectId))) {
+				traceRecorderObjectCount++;
+			} else {
+				_objectId = UINT64_MAX;
+			}
+		}
+
+		uint8_t _record[TRACERECORDER_MAXRECORDSIZE];
+		size_t _size = 0;
+		_record[_size++] = (uint8_t)_operation;
+		_size += TraceRecorder_WriteVarint(_record + _size, _objectId);
+		_size += TraceRecorder_WriteVarint(_record + _size, _argument0);
+		_size += TraceRecorder_WriteVarint(_record + _size, _argument1);
+		if (TraceRecorder_IsKeyedOperation(_operation)) {
+			TraceRecorder_WriteUInt(_record + _size, Hash_FNV1a(_key, _keySize), 8);
+			_size += 8;
+		}
+		if ((_objectId == UINT64_MAX)
+		|| (UINTPTR_MAX == BinaryBuilder_SetBytes(_trace, _record, _size))) {
+			traceRecorderDroppedCount++; // insufficient memory
+		}
+	}
+	TraceRecorder_Unlock();
+	traceRecorderIsBusy = false;
+}
+
+/* Forgets the objectId of an object whose storage is freed, called by the containers through INSTRUMENTATION_TRACE_FORGET
+ * _operation is any operation of the object's container
+ * The next object operated at the same address is recorded as a new object
+ */
+void TraceRecorder_Forget(const instrumentation_operation_t _operation, const void* const _object) {
+	if (traceRecorderIsBusy || !atomic_load_explicit(&traceRecorderTrace, memory_order_acquire)) {
+		return; // not recording, or called by the recorder itself
+	}
+	traceRecorderIsBusy = true;
+	TraceRecorder_Lock();
+	binarybuilder_t* const _trace = atomic_load_explicit(&traceRecorderTrace, memory_order_relaxed); // the lock orders it
+	if (_trace) { // recording wasn't stopped while waiting
+		const tracerecorder_objectkey_t _objectKey = TraceRecorder_GetObjectKey(_operation, _object);
+		Dictionary_DeleteKey(&traceRecorderObjects, &_objectKey, sizeof(_objectKey));
+	}
+	TraceRecorder_Unlock();
+	traceRecorderIsBusy = false;
+}
+
+#else
+
+bool TraceRecorder_Start(binarybuilder_t* const _trace) {
+	(void)_trace;
+	return false; // recording requires DDS_TRACE_RECORDING
+}
+
+size_t TraceRecorder_Stop(void) {
+	return 0;
+}
+
+#endif
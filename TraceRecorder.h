@@ -0,0 +1,78 @@
+/*
+ * @File: TraceRecorder.h
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Records the container operations into a compact binary trace that can be replayed offline
+ * @LastUpdate: October 19, 2026
+ *
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ *
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ *
+ * Compile every container with DDS_TRACE_RECORDING defined, and link TraceRecorder.c, BinaryBuilder.c and Dictionary.c.
+ * Between TraceRecorder_Start and TraceRecorder_Stop every call of the operations listed by instrumentation_operation_t
+ * is appended to the trace. Only the shape of the traffic is kept, keys are stored as their FNV-1a hash
+ * and the stored data as its size, so a trace captured in production carries none of its contents.
+ * Only those operations are recorded, see the table below. Every other call, such as the other getters,
+ * the iterations, the bulk operations and every call on the containers without traced operations, is missing
+ * from the trace, so a replay reproduces the hot mutations and lookups rather than the whole workload.
+ *
+ * Trace layout, integers are little endian:
+ *   header: "DDSTRACE", uint32_t version, uint32_t INSTRUMENTATION_OPERATION_COUNT of the recording build
+ *   record: uint8_t operation, varint objectId, varint argument0, varint argument1,
+ *           uint64_t keyHash (Dictionary and SkipList operations only)
+ * A varint stores 7 bits per byte, lowest bits first, the highest bit of a byte tells that another byte follows.
+ * objectId numbers the recorded container objects in order of first appearance.
+ * Freeing the storage of an object ends its objectId, the next object operated at its address gets a new one.
+ *
+ * Arguments per operation:
+ *   BinaryBuilder_Delete, BinaryBuilder_InsertBytes        write offset, length
+ *   DynamicArray_Delete, DynamicArray_Insert               index, element size
+ *   DynamicArray_Push, UnrolledLinkedList_Push             0, element size
+ *   DynamicStringArray_Delete                              index, 0
+ *   DynamicStringArray_InsertSubString                     index, length
+ *   Dictionary_DeleteKey, Dictionary_Get_Entry             key size, 0
+ *   Dictionary_Set                                         key size, data size
+ *   SkipList_Delete, SkipList_Insert                       0, element size
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "BinaryBuilder.h"
+#include "Instrumentation.h"
+
+#define TRACERECORDER_MAGIC "DDSTRACE"
+#define TRACERECORDER_VERSION 1
+#define TRACERECORDER_HEADERSIZE 16
+#define TRACERECORDER_MAXRECORDSIZE (1 + (3 * 10) + 8)
+
+typedef enum {
+	TRACERECORDER_CONTAINER_BINARYBUILDER,
+	TRACERECORDER_CONTAINER_DYNAMICARRAY,
+	TRACERECORDER_CONTAINER_DYNAMICSTRINGARRAY,
+	TRACERECORDER_CONTAINER_DICTIONARY,
+	TRACERECORDER_CONTAINER_UNROLLEDLINKEDLIST,
+	TRACERECORDER_CONTAINER_SKIPLIST
+} tracerecorder_container_t;
+
+typedef struct {
+    instrumentation_operation_t operation;
+    uint64_t objectId;  // which recorded object was operated
+    uint64_t argument0; // meaning depends on the operation
+    uint64_t argument1; // meaning depends on the operation
+    uint64_t keyHash;   // FNV-1a hash of the key, 0 if the operation has no key
+} tracerecorder_record_t;
+
+bool TraceRecorder_Start(binarybuilder_t* const _trace);
+size_t TraceRecorder_Stop(void);
+tracerecorder_container_t TraceRecorder_GetOperationContainer(const instrumentation_operation_t _operation);
+bool TraceRecorder_IsKeyedOperation(const instrumentation_operation_t _operation);
+size_t TraceRecorder_ReadHeader(const void* const _trace, const size_t _traceSize);
+size_t TraceRecorder_ReadRecord(const void* restrict const _trace, const size_t _traceSize, size_t _offset, tracerecorder_record_t* restrict const out_record);
@@ -29,8 +29,392 @@ int main(void) {
 }
 */
 
+#define _DEFAULT_SOURCE // strcasecmp(), and mmap() of the serialization images
+
+#include "Instrumentation.c"
 #include "BinaryBuilder.c"
 #include "StringBuilder.c"
+#include "DynamicArray.c"
+#include "DynamicStringArray.c"
+#include "Dictionary.c"
+#include "Serialization.c"
+#include "SlotMap.c"
+#include "Bitset.c"
+#include "CompressedBitmap.c"
+#include "HashSet.c"
+#include "HierarchicalDictionary.c"
+
+// prints the failed condition, then fails the test calling it
+#define UNITTEST_CHECK(_condition) do { \
+	if (!(_condition)) { \
+		printf("%s:%d: %s\n", __func__, __LINE__, #_condition); \
+		return false; \
+	} \
+} while (0)
+
+static bool UnitTest_Run(const char* const _name, bool (*const _test)(void)) {
+	const bool _isPassed = _test();
+	printf("%s: %s\n", _name, _isPassed ? "passed" : "FAILED");
+	return _isPassed;
+}
+
+static bool UnitTest_Serialization(void) {
+	dynamicarray_t* const _array = DynamicArray_Init(NULL, sizeof(uint32_t));
+	dynamicstringarray_t* const _stringArray = DynamicStringArray_Init(NULL);
+	dynamicstringarray_t* const _emptyStringArray = DynamicStringArray_Init(NULL);
+	dictionary_t* const _dictionary = Dictionary_Init(NULL);
+	UNITTEST_CHECK(_array && _stringArray && _emptyStringArray && _dictionary);
+	for (uint32_t i = 0; i < 1000; i++) {
+		UNITTEST_CHECK(DynamicArray_Push(_array, &i));
+	}
+	UNITTEST_CHECK(DynamicStringArray_Push(_stringArray, "Hello World!"));
+	UNITTEST_CHECK(!DynamicStringArray_Push(_stringArray, "")); // empty strings are rejected
+	UNITTEST_CHECK(DynamicStringArray_Push(_stringArray, "How Are you?"));
+	UNITTEST_CHECK(Dictionary_Set(_dictionary, "name", 4, "value", 5));
+	UNITTEST_CHECK(Dictionary_Set(_dictionary, "", 0, "empty key", 9));
+	UNITTEST_CHECK(Dictionary_Set(_dictionary, "empty data", 10, NULL, 0));
+
+	serialization_writer_t _writer;
+	_writer.image.data = NULL;
+	_writer.sections.array = NULL;
+	UNITTEST_CHECK(SerializationWriter_Init(&_writer));
+	UNITTEST_CHECK(SerializationWriter_AddDynamicArray(&_writer, _array));
+	UNITTEST_CHECK(SerializationWriter_Init(&_writer)); // re-initialization discards the added containers
+	UNITTEST_CHECK(SerializationWriter_AddDynamicArray(&_writer, _array));
+	UNITTEST_CHECK(SerializationWriter_AddDynamicStringArray(&_writer, _stringArray));
+	UNITTEST_CHECK(SerializationWriter_AddDictionary(&_writer, _dictionary));
+	UNITTEST_CHECK(SerializationWriter_AddDynamicStringArray(&_writer, _emptyStringArray));
+	UNITTEST_CHECK(SerializationWriter_Finish(&_writer));
+	UNITTEST_CHECK(!SerializationWriter_AddDynamicArray(&_writer, _array)); // finished images are read-only
+
+	serialization_file_t _file;
+	const size_t _imageSize = BinaryBuilder_GetCurrentSize(&_writer.image);
+	UNITTEST_CHECK(SerializationFile_OpenBuffer(&_file, _writer.image.data, _imageSize, true));
+	UNITTEST_CHECK(SerializationFile_GetSectionCount(&_file) == 4);
+	UNITTEST_CHECK(SerializationFile_GetSectionType(&_file, 0) == SERIALIZATION_SECTION_DYNAMICARRAY);
+
+	dynamicarray_t _loadedArray;
+	UNITTEST_CHECK(SerializationFile_GetDynamicArray(&_file, 0, &_loadedArray));
+	UNITTEST_CHECK((_loadedArray.elementCount == 1000) && (_loadedArray.elementSize == sizeof(uint32_t)));
+	UNITTEST_CHECK(!memcmp(_loadedArray.array, _array->array, 1000 * sizeof(uint32_t)));
+	UNITTEST_CHECK(!SerializationFile_GetDynamicArray(&_file, 1, &_loadedArray)); // not a DynamicArray
+
+	serialization_stringarrayview_t _stringView;
+	size_t _length;
+	UNITTEST_CHECK(SerializationFile_GetStringArrayView(&_file, 1, &_stringView));
+	UNITTEST_CHECK(SerializationStringArray_GetCount(&_stringView) == 2);
+	UNITTEST_CHECK(!strcmp(SerializationStringArray_Get(&_stringView, 0, &_length), "Hello World!") && (_length == 12));
+	UNITTEST_CHECK(!SerializationStringArray_Get(&_stringView, 2, NULL));
+	dynamicstringarray_t* const _loadedStringArray = SerializationFile_LoadDynamicStringArray(&_file, 1, NULL);
+	UNITTEST_CHECK(_loadedStringArray && (_loadedStringArray->elementCount == 2));
+	UNITTEST_CHECK(!strcmp(_loadedStringArray->array[1], "How Are you?"));
+	UNITTEST_CHECK(SerializationFile_GetStringArrayView(&_file, 3, &_stringView));
+	UNITTEST_CHECK(SerializationStringArray_GetCount(&_stringView) == 0);
+	UNITTEST_CHECK(!SerializationStringArray_Get(&_stringView, 0, NULL));
+
+	serialization_dictionaryview_t _dictionaryView;
+	size_t _dataSize;
+	UNITTEST_CHECK(SerializationFile_GetDictionaryView(&_file, 2, &_dictionaryView));
+	UNITTEST_CHECK(SerializationDictionary_GetCount(&_dictionaryView) == 3);
+	const void* _data = SerializationDictionary_Get(&_dictionaryView, "name", 4, &_dataSize);
+	UNITTEST_CHECK(_data && (_dataSize == 5) && !memcmp(_data, "value", 5));
+	_data = SerializationDictionary_Get(&_dictionaryView, "", 0, &_dataSize);
+	UNITTEST_CHECK(_data && (_dataSize == 9) && !memcmp(_data, "empty key", 9));
+	UNITTEST_CHECK(SerializationDictionary_Get(&_dictionaryView, "empty data", 10, &_dataSize) && (_dataSize == 0));
+	UNITTEST_CHECK(!SerializationDictionary_HasKey(&_dictionaryView, "missing", 7));
+	dictionary_t* const _loadedDictionary = SerializationFile_LoadDictionary(&_file, 2, NULL);
+	UNITTEST_CHECK(_loadedDictionary && (_loadedDictionary->elementCount == 3));
+	UNITTEST_CHECK(Dictionary_Has_Key(_loadedDictionary, "", 0));
+	SerializationFile_Close(&_file);
+
+	((uint8_t*)_writer.image.data)[_imageSize - 1] ^= 1; // corrupts the section table
+	UNITTEST_CHECK(!SerializationFile_OpenBuffer(&_file, _writer.image.data, _imageSize, true));
+	UNITTEST_CHECK(!SerializationFile_OpenBuffer(&_file, _writer.image.data, _imageSize - 1, false)); // truncated
+
+	Dictionary_Free(_loadedDictionary);
+	DynamicStringArray_Free(_loadedStringArray);
+	SerializationWriter_FreeStorage(&_writer);
+	Dictionary_Free(_dictionary);
+	DynamicStringArray_Free(_emptyStringArray);
+	DynamicStringArray_Free(_stringArray);
+	DynamicArray_Free(_array);
+	return true;
+}
+
+static bool UnitTest_SlotMap(void) {
+	slotmap_t _slotMap;
+	memset(&_slotMap, 0xA5, sizeof(slotmap_t)); // garbage, like an uninitialized local variable
+	_slotMap.elements.array = NULL;
+	_slotMap.denseSlots.array = NULL;
+	_slotMap.slots.array = NULL;
+	UNITTEST_CHECK(SlotMap_InitAll(&_slotMap, sizeof(uint64_t), 4));
+	slotmap_handle_t _handles[100];
+	for (uint64_t i = 0; i < 100; i++) {
+		_handles[i] = SlotMap_Insert(&_slotMap, &i);
+		UNITTEST_CHECK(_handles[i] != SLOTMAP_INVALIDHANDLE);
+	}
+	UNITTEST_CHECK(SlotMap_GetCount(&_slotMap) == 100);
+	for (uint64_t i = 0; i < 100; i++) {
+		const uint64_t* const _value = SlotMap_Get(&_slotMap, _handles[i]);
+		UNITTEST_CHECK(_value && (*_value == i));
+	}
+	UNITTEST_CHECK(!SlotMap_Contains(&_slotMap, SLOTMAP_INVALIDHANDLE));
+
+	for (uint64_t i = 0; i < 100; i += 2) {
+		UNITTEST_CHECK(SlotMap_Remove(&_slotMap, _handles[i]));
+		UNITTEST_CHECK(!SlotMap_Remove(&_slotMap, _handles[i])); // already removed
+		UNITTEST_CHECK(!SlotMap_Get(&_slotMap, _handles[i]));
+	}
+	UNITTEST_CHECK(SlotMap_GetCount(&_slotMap) == 50);
+	for (uint64_t i = 1; i < 100; i += 2) { // the moved elements keep their handles
+		const uint64_t* const _value = SlotMap_Get(&_slotMap, _handles[i]);
+		UNITTEST_CHECK(_value && (*_value == i));
+	}
+	for (size_t i = 0; i < SlotMap_GetCount(&_slotMap); i++) {
+		const uint64_t* const _value = SlotMap_Get(&_slotMap, SlotMap_GetHandleAt(&_slotMap, i));
+		UNITTEST_CHECK(_value && (*_value == ((uint64_t*)SlotMap_GetElements(&_slotMap))[i]));
+	}
+	UNITTEST_CHECK(SlotMap_GetHandleAt(&_slotMap, 50) == SLOTMAP_INVALIDHANDLE);
+
+	const uint64_t _reinsertedValue = 1000;
+	const slotmap_handle_t _reinsertedHandle = SlotMap_Insert(&_slotMap, &_reinsertedValue); // reuses a freed slot
+	UNITTEST_CHECK((uint32_t)_reinsertedHandle < 100);
+	UNITTEST_CHECK(*(uint64_t*)SlotMap_Get(&_slotMap, _reinsertedHandle) == _reinsertedValue);
+	for (uint64_t i = 0; i < 100; i += 2) { // a reused slot never revives a stale handle
+		UNITTEST_CHECK(!SlotMap_Contains(&_slotMap, _handles[i]));
+	}
+
+	UNITTEST_CHECK(SlotMap_Init(&_slotMap, sizeof(uint32_t)) == &_slotMap); // re-initialization empties it
+	UNITTEST_CHECK(SlotMap_GetCount(&_slotMap) == 0);
+	UNITTEST_CHECK(!SlotMap_Contains(&_slotMap, _handles[1]) && !SlotMap_Contains(&_slotMap, _reinsertedHandle));
+	const uint32_t _value = 7;
+	const slotmap_handle_t _handle = SlotMap_Insert(&_slotMap, &_value);
+	UNITTEST_CHECK(*(uint32_t*)SlotMap_Get(&_slotMap, _handle) == _value);
+	SlotMap_Clear(&_slotMap);
+	UNITTEST_CHECK((SlotMap_GetCount(&_slotMap) == 0) && !SlotMap_Contains(&_slotMap, _handle));
+	SlotMap_FreeStorage(&_slotMap);
+	return true;
+}
+
+static bool UnitTest_Bitset(void) {
+	bitset_t _bitset;
+	_bitset.words = NULL;
+	UNITTEST_CHECK(Bitset_InitAll(&_bitset, 10, BITSET_DEFAULT_EXPANSIONRATE));
+	UNITTEST_CHECK(!Bitset_Test(&_bitset, 0) && (Bitset_NextSetBit(&_bitset, 0) == SIZE_MAX));
+	for (size_t i = 0; i < 1000; i += 3) {
+		UNITTEST_CHECK(Bitset_Set(&_bitset, i)); // grows to hold the index
+	}
+	UNITTEST_CHECK((_bitset.bitCount == 999 + 1) && (Bitset_Count(&_bitset) == 334));
+	UNITTEST_CHECK(Bitset_Test(&_bitset, 999) && !Bitset_Test(&_bitset, 998) && !Bitset_Test(&_bitset, 1000));
+	UNITTEST_CHECK(Bitset_Rank(&_bitset, 999) == 333);
+	UNITTEST_CHECK((Bitset_NextSetBit(&_bitset, 1) == 3) && (Bitset_NextSetBit(&_bitset, 1000) == SIZE_MAX));
+	UNITTEST_CHECK((Bitset_NextClearBit(&_bitset, 0) == 1) && (Bitset_NextClearBit(&_bitset, 999) == 1000));
+	Bitset_Reset(&_bitset, 999);
+	UNITTEST_CHECK(!Bitset_Test(&_bitset, 999) && (Bitset_Count(&_bitset) == 333));
+
+	bitset_t* const _source = Bitset_Init(NULL);
+	UNITTEST_CHECK(_source && Bitset_Set(_source, 1) && Bitset_Set(_source, 3) && Bitset_Set(_source, 2000));
+	UNITTEST_CHECK(Bitset_Or(&_bitset, _source));
+	UNITTEST_CHECK((_bitset.bitCount == 2001) && Bitset_Test(&_bitset, 1) && Bitset_Test(&_bitset, 2000));
+	UNITTEST_CHECK(Bitset_And(&_bitset, _source));
+	UNITTEST_CHECK((Bitset_Count(&_bitset) == 3) && Bitset_Test(&_bitset, 3) && !Bitset_Test(&_bitset, 6));
+	UNITTEST_CHECK(Bitset_AndNot(&_bitset, _source) && (Bitset_Count(&_bitset) == 0));
+
+	UNITTEST_CHECK(Bitset_Resize(&_bitset, 70) && Bitset_Set(&_bitset, 69));
+	UNITTEST_CHECK(Bitset_Resize(&_bitset, 60) && Bitset_Resize(&_bitset, 70) && !Bitset_Test(&_bitset, 69)); // removed bits stay cleared
+	UNITTEST_CHECK(Bitset_Set(&_bitset, 5));
+	UNITTEST_CHECK(Bitset_Init(&_bitset) == &_bitset); // re-initialization clears every bit
+	UNITTEST_CHECK((_bitset.bitCount == 0) && !Bitset_Test(&_bitset, 5));
+	UNITTEST_CHECK(Bitset_Set(&_bitset, 5) && (Bitset_Count(&_bitset) == 1));
+	Bitset_Free(_source);
+	Bitset_FreeBuffer(&_bitset);
+	return true;
+}
+
+static bool UnitTest_CompressedBitmap(void) {
+	compressedbitmap_t _bitmap;
+	memset(&_bitmap, 0xA5, sizeof(compressedbitmap_t)); // garbage, like an uninitialized local variable
+	_bitmap.containers.array = NULL;
+	UNITTEST_CHECK(CompressedBitmap_Init(&_bitmap));
+	UNITTEST_CHECK(!CompressedBitmap_Contains(&_bitmap, 0) && (CompressedBitmap_GetCardinality(&_bitmap) == 0));
+	for (uint32_t i = 0; i < 5000; i++) { // more than COMPRESSEDBITMAP_ARRAYMAXCOUNT, becomes a bitmap container
+		UNITTEST_CHECK(CompressedBitmap_Add(&_bitmap, i));
+	}
+	UNITTEST_CHECK(CompressedBitmap_Add(&_bitmap, (1U << 20) + 3) && CompressedBitmap_Add(&_bitmap, UINT32_MAX));
+	UNITTEST_CHECK(CompressedBitmap_Add(&_bitmap, 42)); // already added
+	UNITTEST_CHECK(CompressedBitmap_GetCardinality(&_bitmap) == 5002);
+	UNITTEST_CHECK(CompressedBitmap_Contains(&_bitmap, 4999) && !CompressedBitmap_Contains(&_bitmap, 5000));
+	UNITTEST_CHECK(CompressedBitmap_Contains(&_bitmap, UINT32_MAX) && !CompressedBitmap_Contains(&_bitmap, 1U << 20));
+	UNITTEST_CHECK((CompressedBitmap_Rank(&_bitmap, 5000) == 5000) && (CompressedBitmap_Rank(&_bitmap, UINT32_MAX) == 5001));
+	uint32_t _value;
+	UNITTEST_CHECK(CompressedBitmap_NextValue(&_bitmap, 5000, &_value) && (_value == (1U << 20) + 3));
+	UNITTEST_CHECK(CompressedBitmap_NextValue(&_bitmap, UINT32_MAX, &_value) && (_value == UINT32_MAX));
+
+	for (uint32_t i = 0; i < 1000; i++) { // back below COMPRESSEDBITMAP_ARRAYMAXCOUNT
+		UNITTEST_CHECK(CompressedBitmap_Remove(&_bitmap, i));
+	}
+	UNITTEST_CHECK(!CompressedBitmap_Remove(&_bitmap, 0) && !CompressedBitmap_Remove(&_bitmap, 5000));
+	UNITTEST_CHECK(CompressedBitmap_GetCardinality(&_bitmap) == 4002);
+	UNITTEST_CHECK(CompressedBitmap_NextValue(&_bitmap, 0, &_value) && (_value == 1000));
+
+	binarybuilder_t _binaryBuilder;
+	_binaryBuilder.data = NULL;
+	UNITTEST_CHECK(BinaryBuilder_Init(&_binaryBuilder));
+	const uintptr_t _offset = CompressedBitmap_Serialize(&_bitmap, &_binaryBuilder);
+	UNITTEST_CHECK(_offset != UINTPTR_MAX);
+	const size_t _serializedSize = CompressedBitmap_GetSerializedSize(&_bitmap);
+	compressedbitmap_t* const _copy = CompressedBitmap_Init(NULL);
+	UNITTEST_CHECK(_copy);
+	UNITTEST_CHECK(CompressedBitmap_Deserialize(_copy, (uint8_t*)_binaryBuilder.data + _offset, _serializedSize) == _serializedSize);
+	UNITTEST_CHECK(CompressedBitmap_GetCardinality(_copy) == 4002);
+	for (bool _hasValue = CompressedBitmap_NextValue(&_bitmap, 0, &_value); _hasValue; _hasValue = (_value != UINT32_MAX) && CompressedBitmap_NextValue(&_bitmap, _value + 1, &_value)) {
+		UNITTEST_CHECK(CompressedBitmap_Contains(_copy, _value));
+	}
+	UNITTEST_CHECK(!CompressedBitmap_Deserialize(_copy, (uint8_t*)_binaryBuilder.data + _offset, _serializedSize - 1)); // truncated
+	UNITTEST_CHECK(CompressedBitmap_GetCardinality(_copy) == 0);
+
+	UNITTEST_CHECK(CompressedBitmap_Add(_copy, 1000) && CompressedBitmap_Add(_copy, 7));
+	UNITTEST_CHECK(CompressedBitmap_And(&_bitmap, _copy) && (CompressedBitmap_GetCardinality(&_bitmap) == 1));
+	UNITTEST_CHECK(CompressedBitmap_Or(&_bitmap, _copy) && (CompressedBitmap_GetCardinality(&_bitmap) == 2));
+	UNITTEST_CHECK(CompressedBitmap_Xor(&_bitmap, _copy) && (CompressedBitmap_GetCardinality(&_bitmap) == 0));
+
+	UNITTEST_CHECK(CompressedBitmap_Add(&_bitmap, 3));
+	UNITTEST_CHECK(CompressedBitmap_Init(&_bitmap) == &_bitmap); // re-initialization discards the values
+	UNITTEST_CHECK((CompressedBitmap_GetCardinality(&_bitmap) == 0) && !CompressedBitmap_Contains(&_bitmap, 3));
+	UNITTEST_CHECK(CompressedBitmap_Add(&_bitmap, 3) && CompressedBitmap_Contains(&_bitmap, 3));
+	CompressedBitmap_Free(_copy);
+	BinaryBuilder_FreeBuffer(&_binaryBuilder);
+	CompressedBitmap_FreeStorage(&_bitmap);
+	return true;
+}
+
+// every element collides, so each lookup walks a single probe run
+static uint64_t UnitTest_CollidingHash(const void* const _element, const size_t _elementSize) {
+	(void)_element;
+	(void)_elementSize;
+	return 0;
+}
+
+static bool UnitTest_HashSet(void) {
+	hashset_t _hashSet;
+	memset(&_hashSet, 0xA5, sizeof(hashset_t)); // garbage, like an uninitialized local variable
+	_hashSet.slots.array = NULL;
+	UNITTEST_CHECK(HashSet_InitAll(&_hashSet, sizeof(uint64_t), 4, NULL));
+	for (uint64_t i = 0; i < 1000; i++) { // 0 included, as the controls rather than the elements mark the empty slots
+		UNITTEST_CHECK(HashSet_Add(&_hashSet, &i));
+	}
+	const uint64_t _duplicate = 500;
+	UNITTEST_CHECK(HashSet_Add(&_hashSet, &_duplicate) && (HashSet_GetCount(&_hashSet) == 1000));
+	for (uint64_t i = 0; i < 1100; i++) {
+		UNITTEST_CHECK(HashSet_Contains(&_hashSet, &i) == (i < 1000));
+	}
+	for (uint64_t i = 0; i < 1000; i += 2) {
+		UNITTEST_CHECK(HashSet_Remove(&_hashSet, &i));
+		UNITTEST_CHECK(!HashSet_Remove(&_hashSet, &i)); // already removed
+	}
+	UNITTEST_CHECK(HashSet_GetCount(&_hashSet) == 500);
+	size_t _iterator = 0, _count = 0;
+	for (const uint64_t* _value; (_value = HashSet_GetNext(&_hashSet, &_iterator)); _count++) {
+		UNITTEST_CHECK(*_value & 1);
+	}
+	UNITTEST_CHECK(_count == 500);
+
+	UNITTEST_CHECK(HashSet_InitAll(&_hashSet, sizeof(uint16_t), 0, UnitTest_CollidingHash) == &_hashSet); // re-initialization empties it
+	UNITTEST_CHECK(HashSet_GetCount(&_hashSet) == 0);
+	const uint16_t _values[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+	UNITTEST_CHECK(HashSet_AddAll(&_hashSet, _values, 10) && (HashSet_GetCount(&_hashSet) == 10));
+	UNITTEST_CHECK(HashSet_Remove(&_hashSet, &_values[0]) && HashSet_Remove(&_hashSet, &_values[4]));
+	for (size_t i = 0; i < 10; i++) { // removing from the middle of the probe run keeps the rest reachable
+		UNITTEST_CHECK(HashSet_Contains(&_hashSet, &_values[i]) == ((i != 0) && (i != 4)));
+	}
+	HashSet_Clear(&_hashSet);
+	UNITTEST_CHECK((HashSet_GetCount(&_hashSet) == 0) && !HashSet_Contains(&_hashSet, &_values[1]));
+	UNITTEST_CHECK(HashSet_Add(&_hashSet, &_values[1]) && HashSet_Contains(&_hashSet, &_values[1]));
+	HashSet_FreeStorage(&_hashSet);
+	return true;
+}
+
+static bool UnitTest_HierarchicalDictionary(void) {
+	hierarchicaldictionary_t _dictionary;
+	memset(&_dictionary, 0xA5, sizeof(hierarchicaldictionary_t)); // garbage, like an uninitialized local variable
+	_dictionary.entries.array = NULL;
+	UNITTEST_CHECK(HierarchicalDictionary_InitAll(&_dictionary, 4));
+	UNITTEST_CHECK(HierarchicalDictionary_Set(&_dictionary, "server", 6, "host", 4, "localhost", 9));
+	UNITTEST_CHECK(HierarchicalDictionary_Set(&_dictionary, "server", 6, "port", 4, "80", 2));
+	UNITTEST_CHECK(HierarchicalDictionary_Set(&_dictionary, "client", 6, "host", 4, "example.com", 11)); // same key, another section
+	UNITTEST_CHECK(HierarchicalDictionary_Set(&_dictionary, "server", 6, "port", 4, "8080", 4)); // replaces the data
+	UNITTEST_CHECK(HierarchicalDictionary_GetCount(&_dictionary) == 3);
+	size_t _dataSize;
+	const char* _data = HierarchicalDictionary_Get(&_dictionary, "server", 6, "port", 4, &_dataSize);
+	UNITTEST_CHECK(_data && (_dataSize == 4) && !strcmp(_data, "8080"));
+	_data = HierarchicalDictionary_Get(&_dictionary, "client", 6, "host", 4, &_dataSize);
+	UNITTEST_CHECK(_data && (_dataSize == 11) && !strcmp(_data, "example.com"));
+	UNITTEST_CHECK(!HierarchicalDictionary_Get(&_dictionary, "client", 6, "port", 4, NULL));
+	UNITTEST_CHECK(!HierarchicalDictionary_Get(&_dictionary, "server", 5, "host", 4, NULL)); // a prefix of the section
+	UNITTEST_CHECK(!HierarchicalDictionary_Get(&_dictionary, "Server", 6, "host", 4, NULL)); // names are case sensitive
+	const uint8_t* const _zeroes = HierarchicalDictionary_Set(&_dictionary, "client", 6, "id", 2, NULL, 8);
+	UNITTEST_CHECK(_zeroes && !memcmp(_zeroes, "\0\0\0\0\0\0\0\0", 8));
+	UNITTEST_CHECK(HierarchicalDictionary_Set(&_dictionary, "client", 6, "host", 4, (void*)1, 11)); // keeps the data
+	UNITTEST_CHECK(!strcmp(HierarchicalDictionary_Get(&_dictionary, "client", 6, "host", 4, NULL), "example.com"));
+
+	size_t _count;
+	const hierarchicaldictionary_entry_t* _entries = HierarchicalDictionary_GetSection(&_dictionary, "server", 6, &_count);
+	UNITTEST_CHECK(_entries && (_count == 2));
+	for (size_t i = 0; i < _count; i++) {
+		UNITTEST_CHECK((_entries[i].sectionSize == 6) && !memcmp(_entries[i].section, "server", 6));
+	}
+	UNITTEST_CHECK(!HierarchicalDictionary_GetSection(&_dictionary, "missing", 7, NULL));
+
+	// a NULL section is the empty section
+	UNITTEST_CHECK(HierarchicalDictionary_Set(&_dictionary, NULL, 0, "global", 6, "1", 1));
+	UNITTEST_CHECK(HierarchicalDictionary_Has_Key(&_dictionary, "", 0, "global", 6));
+	UNITTEST_CHECK(HierarchicalDictionary_GetSection(&_dictionary, "", 0, &_count) && (_count == 1));
+	// an empty key holds a section without keys, and a NULL key is the empty key
+	UNITTEST_CHECK(HierarchicalDictionary_Set(&_dictionary, "empty", 5, NULL, 0, NULL, 0));
+	UNITTEST_CHECK(HierarchicalDictionary_Has_Key(&_dictionary, "empty", 5, "", 0));
+	UNITTEST_CHECK(HierarchicalDictionary_GetSection(&_dictionary, "empty", 5, &_count) && (_count == 1));
+	UNITTEST_CHECK(HierarchicalDictionary_Set(&_dictionary, NULL, 0, NULL, 0, "root", 4));
+	UNITTEST_CHECK(!strcmp(HierarchicalDictionary_Get(&_dictionary, "", 0, "", 0, NULL), "root"));
+	UNITTEST_CHECK(HierarchicalDictionary_GetCount(&_dictionary) == 7);
+
+	UNITTEST_CHECK(HierarchicalDictionary_DeleteKey(&_dictionary, "server", 6, "host", 4));
+	UNITTEST_CHECK(!HierarchicalDictionary_DeleteKey(&_dictionary, "server", 6, "host", 4)); // already deleted
+	UNITTEST_CHECK(HierarchicalDictionary_DeleteKey(&_dictionary, "empty", 5, NULL, 0));
+	UNITTEST_CHECK(!HierarchicalDictionary_GetSection(&_dictionary, "empty", 5, NULL)); // deleting its last key deletes the section
+	UNITTEST_CHECK(HierarchicalDictionary_DeleteSection(&_dictionary, "client", 6) == 2);
+	UNITTEST_CHECK(HierarchicalDictionary_DeleteSection(&_dictionary, "client", 6) == 0);
+	UNITTEST_CHECK(HierarchicalDictionary_DeleteSection(&_dictionary, NULL, 0) == 2);
+	UNITTEST_CHECK(HierarchicalDictionary_GetCount(&_dictionary) == 1);
+	UNITTEST_CHECK(!strcmp(HierarchicalDictionary_Get(&_dictionary, "server", 6, "port", 4, NULL), "8080"));
+
+	char _section[16], _key[16];
+	for (int i = 0; i < 50; i++) { // moves the entries while growing
+		const int _sectionSize = sprintf(_section, "section%d", i);
+		for (int j = 0; j < 20; j++) {
+			const int _keySize = sprintf(_key, "key%d", j);
+			UNITTEST_CHECK(HierarchicalDictionary_Set(&_dictionary, _section, _sectionSize, _key, _keySize, &j, sizeof(int)));
+		}
+	}
+	for (int i = 0; i < 50; i++) {
+		const int _sectionSize = sprintf(_section, "section%d", i);
+		UNITTEST_CHECK(HierarchicalDictionary_GetSection(&_dictionary, _section, _sectionSize, &_count) && (_count == 20));
+		for (int j = 0; j < 20; j++) {
+			const int _keySize = sprintf(_key, "key%d", j);
+			const int* const _value = HierarchicalDictionary_Get(&_dictionary, _section, _sectionSize, _key, _keySize, NULL);
+			UNITTEST_CHECK(_value && (*_value == j));
+		}
+	}
+
+	UNITTEST_CHECK(HierarchicalDictionary_Init(&_dictionary) == &_dictionary); // re-initialization discards the entries
+	UNITTEST_CHECK(HierarchicalDictionary_GetCount(&_dictionary) == 0);
+	UNITTEST_CHECK(!HierarchicalDictionary_Get(&_dictionary, "server", 6, "port", 4, NULL));
+	UNITTEST_CHECK(HierarchicalDictionary_Set(&_dictionary, "server", 6, "port", 4, "80", 2));
+	HierarchicalDictionary_Clear(&_dictionary);
+	UNITTEST_CHECK(!HierarchicalDictionary_Has_Key(&_dictionary, "server", 6, "port", 4));
+	HierarchicalDictionary_FreeStorage(&_dictionary);
+	return true;
+}
+
 stringbuilder_t stringBuilder;
 int main(void) {
     StringBuilder_InitWithMinSize(&stringBuilder, 59, 0.5);
@@ -42,5 +426,12 @@ int main(void) {
     StringBuilder_InsertString(&stringBuilder, "How Are you?");
     printf("%llu %llu %s\n", strlen(stringBuilder.string), stringBuilder.capacity, stringBuilder.string);
 
-    return 0;
+    bool _isPassed = true;
+    _isPassed = UnitTest_Run("Serialization", UnitTest_Serialization) && _isPassed;
+    _isPassed = UnitTest_Run("SlotMap", UnitTest_SlotMap) && _isPassed;
+    _isPassed = UnitTest_Run("Bitset", UnitTest_Bitset) && _isPassed;
+    _isPassed = UnitTest_Run("CompressedBitmap", UnitTest_CompressedBitmap) && _isPassed;
+    _isPassed = UnitTest_Run("HashSet", UnitTest_HashSet) && _isPassed;
+    _isPassed = UnitTest_Run("HierarchicalDictionary", UnitTest_HierarchicalDictionary) && _isPassed;
+    return _isPassed ? 0 : 1;
 }
\ No newline at end of file
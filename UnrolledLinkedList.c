@@ -0,0 +1,180 @@
+/*
+ * @File: UnrolledLinkedList.c
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Linked List whose nodes hold a fixed array of elements for cache friendly traversal
+ * @LastUpdate: October 19, 2026
+ * 
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ * 
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ */
+
+#include "UnrolledLinkedList.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Frees all the nodes of the list, making it look empty
+void UnrolledLinkedList_Clear(unrolledlinkedlist_t* const _object) {
+	unrolledlinkedlist_node_t* _node = _object->first;
+	while (_node) { // traverse
+		unrolledlinkedlist_node_t* const _deleted = _node;
+		_node = _node->next;
+		free(_deleted);
+		INSTRUMENTATION_FREE(&_object->instrumentation);
+	}
+	_object->first = NULL;
+	_object->last = NULL;
+	_object->elementCount = 0;
+}
+
+/* Frees an UnrolledLinkedList object
+ * CAUTION! Do not pass pointer to a permanent UnrolledLinkedList variable!
+ */
+void UnrolledLinkedList_Free(unrolledlinkedlist_t* _object) {
+	INSTRUMENTATION_TRACE_FORGET(INSTRUMENTATION_OPERATION_UNROLLEDLINKEDLIST_PUSH, _object);
+	UnrolledLinkedList_Clear(_object);
+	free((void*)_object);
+	INSTRUMENTATION_FREE(NULL);
+}
+
+// UnrolledLinkedList_Push without recording its latency nor its trace
+static inline bool UnrolledLinkedList_PushUntimed(unrolledlinkedlist_t* restrict const _object, const void* restrict const _value) {
+	unrolledlinkedlist_node_t* _node = _object->last;
+	if (!_node || (_node->elementCount >= _object->elementsPerNode)) { // last node is full
+		_node = malloc(sizeof(unrolledlinkedlist_node_t) + (_object->elementsPerNode * _object->elementSize));
+		if (!_node) {
+			return false; // insufficient memory
+		}
+		INSTRUMENTATION_ALLOCATION(&_object->instrumentation, sizeof(unrolledlinkedlist_node_t) + (_object->elementsPerNode * _object->elementSize));
+		INSTRUMENTATION_GROWTH(&_object->instrumentation, sizeof(unrolledlinkedlist_node_t) + (_object->elementsPerNode * _object->elementSize));
+		_node->next = NULL;
+		_node->elementCount = 0;
+		if (_object->last) { // last node exists
+			_object->last->next = _node; // chain the last node to the new node
+		} else {
+			_object->first = _node;
+		}
+		_object->last = _node;
+	}
+	memcpy(_node->elements + (_node->elementCount * _object->elementSize), _value, _object->elementSize);
+	_node->elementCount++;
+	_object->elementCount++;
+	return true;
+}
+
+// Appends a copy of the value at the end of the list, allocating a new node if necessary. See UnrolledLinkedList_Push
+bool UnrolledLinkedList_PushSlow(unrolledlinkedlist_t* restrict const _object, const void* restrict const _value) {
+	INSTRUMENTATION_TRACE(INSTRUMENTATION_OPERATION_UNROLLEDLINKEDLIST_PUSH, _object, 0, _object->elementSize, NULL, 0);
+	INSTRUMENTATION_LATENCY_BEGIN(_start);
+	const bool _isPushed = UnrolledLinkedList_PushUntimed(_object, _value);
+	INSTRUMENTATION_LATENCY_END(INSTRUMENTATION_OPERATION_UNROLLEDLINKEDLIST_PUSH, _start);
+	return _isPushed;
+}
+
+/*
+ * When trueOnce = true, Deletes only the first element which the InspectorFunction evaluated as true
+ * When trueOnce = false, Deletes all elements which the InspectorFunction evaluated as true
+ * The surviving elements are compacted inside their node, and a node is merged
+ * to its previous node when both of their elements fit in a single node
+ * Returns the number of elements deleted from the list
+ */
+size_t UnrolledLinkedList_DeleteElementByCondition(unrolledlinkedlist_t* const _object, bool (*InspectorFunction)(const void*), const bool trueOnce) {
+	size_t _deletedCount = 0;
+	const size_t _elementSize = _object->elementSize;
+	bool _isSettling = false; // only the following node needs to be visited so that it can be merged
+	unrolledlinkedlist_node_t* _prev = NULL;
+	unrolledlinkedlist_node_t* _node = _object->first;
+	while (_node) { // traverse
+		unrolledlinkedlist_node_t* const _nextNode = _node->next;
+		if (!_isSettling) { // inspect this node's elements
+			uint8_t* _writePtr = _node->elements;
+			const uint8_t* const _endPtr = _node->elements + (_node->elementCount * _elementSize);
+			for (const uint8_t* _readPtr = _node->elements; _readPtr < _endPtr; _readPtr += _elementSize) {
+				if ((trueOnce && _deletedCount) || !(*InspectorFunction)(_readPtr)) { // survivor
+					if (_writePtr != _readPtr) {
+						memcpy(_writePtr, _readPtr, _elementSize); // compact
+						INSTRUMENTATION_MOVE(&_object->instrumentation, _elementSize);
+					}
+					_writePtr += _elementSize;
+				} else {
+					_deletedCount++;
+				}
+			}
+			_node->elementCount = (size_t)(_writePtr - _node->elements) / _elementSize;
+		}
+
+		if (!_node->elementCount // node became empty
+		|| (_prev && ((_prev->elementCount + _node->elementCount) <= _object->elementsPerNode))) { // node is sparse enough to be merged with its previous node
+			if (_node->elementCount) {
+				memcpy(_prev->elements + (_prev->elementCount * _elementSize), _node->elements, _node->elementCount * _elementSize);
+				INSTRUMENTATION_MOVE(&_object->instrumentation, _node->elementCount * _elementSize);
+				_prev->elementCount += _node->elementCount;
+			}
+			if (_prev) {
+				_prev->next = _nextNode;
+			} else {
+				_object->first = _nextNode;
+			}
+			if (_object->last == _node) {
+				_object->last = _prev;
+			}
+			free(_node);
+			INSTRUMENTATION_FREE(&_object->instrumentation);
+		} else {
+			_prev = _node;
+		}
+
+		if (_isSettling) {
+			break;
+		}
+		_isSettling = trueOnce && _deletedCount;
+		_node = _nextNode;
+	}
+	_object->elementCount -= _deletedCount;
+	return _deletedCount;
+}
+
+// Executes the passed function to every elements on the list
+void UnrolledLinkedList_ExecuteFunctionForEachElement(const unrolledlinkedlist_t* const _object, void (*ExecutedFunction)(const void*)) {
+	const size_t _elementSize = _object->elementSize;
+	for (const unrolledlinkedlist_node_t* _node = _object->first; _node; _node = _node->next) {
+		const uint8_t* const _endPtr = _node->elements + (_node->elementCount * _elementSize);
+		for (const uint8_t* _elementPtr = _node->elements; _elementPtr < _endPtr; _elementPtr += _elementSize) {
+			(*ExecutedFunction)(_elementPtr);
+		}
+	}
+}
+
+/* Properly initializes the UnrolledLinkedList variable.
+ * Allocates memory to the UnrolledLinkedList variable if its current value is NULL
+ * A permanent variable must be zero filled or already initialized, its existing nodes are freed
+ * The list's nodes are allocated later as elements are pushed
+ */
+unrolledlinkedlist_t* UnrolledLinkedList_InitAll(unrolledlinkedlist_t* _object, const size_t _elementSize, const size_t _elementsPerNode) {
+	if (!_elementSize || !_elementsPerNode) {
+		return NULL; // invalid layout
+	}
+	if (!_object) { // if we are requesting to initialize it
+		_object = malloc(sizeof(unrolledlinkedlist_t));
+		if (!_object) {
+			return NULL; // failed allocating unrolledlinkedlist variable
+		}
+		INSTRUMENTATION_RESET(&_object->instrumentation);
+		INSTRUMENTATION_ALLOCATION(&_object->instrumentation, sizeof(unrolledlinkedlist_t));
+	} else {
+		UnrolledLinkedList_Clear(_object); // re-initialization must not leak the nodes
+		INSTRUMENTATION_RESET(&_object->instrumentation);
+	}
+	_object->first = NULL;
+	_object->last = NULL;
+	_object->elementCount = 0;
+	_object->elementSize = _elementSize;
+	_object->elementsPerNode = _elementsPerNode;
+	return _object; // initialization sucessful
+}
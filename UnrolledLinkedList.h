@@ -0,0 +1,66 @@
+/*
+ * @File: UnrolledLinkedList.h
+ * @Author: Aldrin John O. Manalansan (ajom)
+ * @Email: aldrinjohnolaermanalansan@gmail.com
+ * @Brief: Linked List whose nodes hold a fixed array of elements for cache friendly traversal
+ * @LastUpdate: October 18, 2026
+ * 
+ * Copyright (C) 2025  Aldrin John O. Manalansan  <aldrinjohnolaermanalansan@gmail.com>
+ * 
+ * This Source Code is served under Open-Source AJOM License
+ * You should have received a copy of License_OS-AJOM
+ * along with this source code. If not, see:
+ * <https://raw.githubusercontent.com/Aldrin-John-Olaer-Manalansan/AJOM_License/refs/heads/main/LICENSE_AJOM-OS>
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "Instrumentation.h"
+
+#define UNROLLEDLINKEDLIST_DEFAULT_ELEMENTSPERNODE 32
+
+typedef struct unrolledlinkedlist_node_t {
+    struct unrolledlinkedlist_node_t* next;
+    size_t elementCount;    // how much elements is currently valid in this node
+    uint8_t elements[];     // elementsPerNode * elementSize bytes
+} unrolledlinkedlist_node_t;
+
+typedef struct {
+    unrolledlinkedlist_node_t* first;
+    unrolledlinkedlist_node_t* last;
+    size_t elementCount;    // how much elements is currently valid in the entire list
+    size_t elementSize;     // size per element
+    size_t elementsPerNode; // max number of elements a node can hold
+#ifdef DDS_INSTRUMENTATION
+    instrumentation_counters_t instrumentation; // every node counts as one allocation and one growth
+#endif
+} unrolledlinkedlist_t;
+
+void UnrolledLinkedList_Clear(unrolledlinkedlist_t* const _object);
+void UnrolledLinkedList_Free(unrolledlinkedlist_t* _object);
+bool UnrolledLinkedList_PushSlow(unrolledlinkedlist_t* restrict const _object, const void* restrict const _value);
+size_t UnrolledLinkedList_DeleteElementByCondition(unrolledlinkedlist_t* const _object, bool (*InspectorFunction)(const void*), const bool trueOnce);
+void UnrolledLinkedList_ExecuteFunctionForEachElement(const unrolledlinkedlist_t* const _object, void (*ExecutedFunction)(const void*));
+unrolledlinkedlist_t* UnrolledLinkedList_InitAll(unrolledlinkedlist_t* _object, const size_t _elementSize, const size_t _elementsPerNode);
+
+#define UnrolledLinkedList_Init(_object, _elementSize) UnrolledLinkedList_InitAll(_object, _elementSize, UNROLLEDLINKEDLIST_DEFAULT_ELEMENTSPERNODE)
+
+// Appends a copy of the value at the end of the list
+// copies the value inline while the last node has room, only a new node calls UnrolledLinkedList_PushSlow
+static inline bool UnrolledLinkedList_Push(unrolledlinkedlist_t* restrict const _object, const void* restrict const _value) {
+#ifdef INSTRUMENTATION_INLINE_FASTPATHS
+	unrolledlinkedlist_node_t* const _node = _object->last;
+	if (_node && (_node->elementCount < _object->elementsPerNode)) {
+		memcpy(_node->elements + (_node->elementCount * _object->elementSize), _value, _object->elementSize);
+		_node->elementCount++;
+		_object->elementCount++;
+		return true;
+	}
+#endif
+	return UnrolledLinkedList_PushSlow(_object, _value);
+}